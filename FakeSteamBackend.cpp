@@ -0,0 +1,1241 @@
+// |------------------------------------|
+// |  !FOLLOW URBAN SHADOWS ON SOCIALS! |
+// |------------------------------------|
+//            \ (^ᴗ^) /
+//             \     /
+//              -----
+//              |   |
+//              |   |
+//              |_  |_
+////////////////////////////////////////////////////////////
+// STEAM P2P SESSIONS - Unreal 5.5 + Steamworks SDK 1.57 //
+//////////////////////////////////////////////////////////////////
+// LICENSE AGREEMENT // LICENSE AGREEMENT // LICENSE AGREEMENT //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                                                                                                                                                                                                                                          //
+// Last Updated: 03/12/2024                                                                                                                                                                                                                                //
+//                                                                                                                                                                                                                                                        //
+// 1. Grant of License                                                                                                                                                                                                                                   //
+// This license permits anyone to use, modify, and distribute the provided code (the "Code") in projects free of charge under the following conditions:                                                                                                 //
+// 1.1. The Code must only be used for lawful purposes.                                                                                                                                                                                                //
+// 1.2. The user must include proper credit in their project as described in Section 3 below.                                                                                                                                                         //
+//                                                                                                                                                                                                                                                   //
+// 2. Restrictions                                                                                                                                                                                                                                  //
+// 2.1. This Code cannot be sold, sublicensed, or redistributed as a standalone product or as part of a similar development toolkit.                                                                                                               //
+// 2.2. The Code must not be used for projects that violate local laws or promote harmful, discriminatory, or illegal activities.                                                                                                                 //
+// 2.3. The user must not remove, alter, or obscure this license agreement, attribution requirements, or copyright notices within the Code.                                                                                                      //
+//                                                                                                                                                                                                                                              //
+// 3. Attribution                                                                                                                                                                                                                              //
+// 3.1. The user must include the following credit in a visible location within their project (e.g., splash screen, credits screen, or documentation):                                                                                        //
+// "Steam Multiplayer Code developed by Adrian Szajewski. Used under license."                                                                                                                                                               //
+// 3.2. For distributed or published projects, a link to https://adrianszajewskidev.wordpress.com/ or other contact details must also be included if applicable.                                                                            //
+//                                                                                                                                                                                                                                         //
+// 4. Breach of Agreement                                                                                                                                                                                                                 //
+// 4.1. If this license is violated, the licensor reserves the right to revoke the user's rights to use the Code immediately.                                                                                                            //
+// 4.2. The licensor may take legal action to recover damages or enforce compliance, depending on the severity of the violation.                                                                                                        //
+// 4.3. Users found in breach of this license may be required to:                                                                                                                                                                      //
+// Remove the Code from their project(s).                                                                                                                                                                                             //
+// Cease distribution of any projects using the Code.                                                                                                                                                                                //
+//                                                                                                                                                                                                                                  //
+// 5. Disclaimer                                                                                                                                                                                                                   //
+// 5.1. The Code is provided "as is" without any warranty, express or implied. The licensor is not liable for any damages arising from the use or misuse of the Code.                                                             //
+// 5.2. It is the user's responsibility to ensure compatibility and safe usage of the Code in their projects.                                                                                                                    //
+//                                                                                                                                                                                                                              //
+// 6. Governing Law                                                                                                                                                                                                            //
+// This agreement shall be governed and construed in accordance with the laws of Poland. Any disputes arising under or in connection with this license will be subject to the exclusive jurisdiction of the courts of Poland. //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// INCLUDE //
+////////////
+#include "FakeSteamBackend.h"
+#include "SteamLobbyMetadata.h"
+#include "SteamPingLocation.h"
+#include "SteamFriendsCache.h"
+////////////////////////////////
+// Fake Steam - Internals    //
+////////////////////////////////////////////////////////////////////////
+// 1. IDs are real CSteamID layouts (chat lobbies, individual users)  //
+// 2. Every avatar is 184x184 with a colour derived from its handle  //
+// 3. Callbacks leave a min-heap ordered by (due time, sequence)    //
+// 4. Ping locations are points in a 200x200 ms square             //
+// 5. Leaderboard scores are seeded by the board name             //
+///////////////////////////////////////////////////////////////////
+namespace FakeSteam
+{
+    constexpr uint32 AvatarSize = 184;
+    constexpr uint32 PingLocationMagic = 0xFA4E5EED;
+    constexpr float PingSquareMs = 200.f;
+    constexpr int32 PingBaseMs = 10; // Relay hop even when both points coincide
+    constexpr uint32 LeaderboardAccountBase = 0x00F00000; // Leaderboard-only players, clear of MakeUser IDs
+    constexpr int32 MaxLeaderboardScore = 100000;
+    constexpr int32 ChatLogSize = 256; // Entries kept per lobby
+    constexpr int32 MaxChatMsgBytes = 4096; // Steam's limit for one lobby chat message
+
+    void WritePingPoint(SteamNetworkPingLocation_t& Location, const FVector2f& Point)
+    {
+        FMemory::Memzero(Location);
+        FMemory::Memcpy(Location.m_data, &PingLocationMagic, sizeof(uint32));
+        FMemory::Memcpy(Location.m_data + sizeof(uint32), &Point, sizeof(FVector2f));
+    }
+
+    bool ReadPingPoint(const SteamNetworkPingLocation_t& Location, FVector2f& OutPoint)
+    {
+        uint32 Magic = 0;
+        FMemory::Memcpy(&Magic, Location.m_data, sizeof(uint32));
+        FMemory::Memcpy(&OutPoint, Location.m_data + sizeof(uint32), sizeof(FVector2f));
+        return Magic == PingLocationMagic;
+    }
+
+    TArray<ANSICHAR> ToAnsi(const char* Value)
+    {
+        const int32 Len = Value ? FCStringAnsi::Strlen(Value) : 0;
+        TArray<ANSICHAR> Result;
+        Result.SetNumUninitialized(Len + 1);
+        if (Len > 0)
+        {
+            FMemory::Memcpy(Result.GetData(), Value, Len);
+        }
+        Result[Len] = '\0';
+        return Result;
+    }
+
+    TArray<ANSICHAR> PingPointString(const FVector2f& Point)
+    {
+        return ToAnsi(TCHAR_TO_UTF8(*FString::Printf(TEXT("fake=%d,%d"), FMath::RoundToInt(Point.X), FMath::RoundToInt(Point.Y))));
+    }
+
+    struct FPendingOrder
+    {
+        template<typename T>
+        bool operator()(const T& A, const T& B) const
+        {
+            return A.DueTime < B.DueTime || (A.DueTime == B.DueTime && A.Sequence < B.Sequence);
+        }
+    };
+
+    bool Compare(int32 Diff, ELobbyComparison Comparison)
+    {
+        switch (Comparison)
+        {
+        case k_ELobbyComparisonEqualToOrLessThan: return Diff <= 0;
+        case k_ELobbyComparisonLessThan: return Diff < 0;
+        case k_ELobbyComparisonEqual: return Diff == 0;
+        case k_ELobbyComparisonGreaterThan: return Diff > 0;
+        case k_ELobbyComparisonEqualToOrGreaterThan: return Diff >= 0;
+        case k_ELobbyComparisonNotEqual: return Diff != 0;
+        default: return false;
+        }
+    }
+}
+//////////////////////////
+// Constructor - Notes //
+////////////////////////////////////////////////////////
+// 1. Nothing is simulated until Init() is called.    //
+//////////////////////////////////////////////////////
+FFakeSteamBackend::FFakeSteamBackend(const FFakeSteamConfig& InConfig)
+    : Config(InConfig), bRunning(false), Now(0.0), NextSequence(0), NextAPICall(1), NextAccountID(1000), LocalPingPoint(FVector2f::ZeroVector)
+    , bStatsReceived(false), NumStatWrites(0), NumStatsStores(0), NumLeaderboardUploads(0), NextDownloadHandle(1)
+{
+}
+/////////////////////////
+// 1. Lifecycle       //
+////////////////////////////////////////////
+// 1.1 - Populate the simulated world    //
+// 1.2 - Tear down                      //
+// 1.3 - Advance clock, run callbacks  //
+// 1.4 - Post a delayed callback      //
+// 1.5 - Add a lobby immediately     //
+// 1.6 - Simulated churn            //
+/////////////////////////////////////
+// - 1.1 - //
+bool FFakeSteamBackend::Init()
+{
+    if (bRunning)
+    {
+        return true;
+    }
+    else
+    {
+        Random.Initialize(Config.Seed);
+        LocalUser = MakeUser(TEXT("LocalPlayer"));
+        OnlineUsers.Add(LocalUser.ConvertToUint64());
+
+        // Own stream, so adding ping points left every other seeded value where it was
+        FRandomStream PingRandom(Config.Seed + 1);
+        LocalPingPoint = FVector2f(PingRandom.FRandRange(0.f, FakeSteam::PingSquareMs), PingRandom.FRandRange(0.f, FakeSteam::PingSquareMs));
+
+        const int32 MaxMembers = FMath::Max(Config.MaxMembersPerLobby, 1);
+        const auto GameKey = StringCast<ANSICHAR>(*Config.GameKey);
+        Lobbies.Reserve(Config.NumLobbies);
+
+        for (int32 i = 0; i < Config.NumLobbies; ++i)
+        {
+            FFakeLobby& Lobby = Lobbies.AddDefaulted_GetRef();
+            Lobby.LobbyID = MakeLobbyID();
+            Lobby.MaxMembers = MaxMembers;
+            Lobby.Owner = MakeUser(FString::Printf(TEXT("Player_%d_0"), i));
+            Lobby.Members.Add(Lobby.Owner);
+
+            const int32 NumMembers = Random.RandRange(1, MaxMembers);
+            for (int32 m = 1; m < NumMembers; ++m)
+            {
+                Lobby.Members.Add(MakeUser(FString::Printf(TEXT("Player_%d_%d"), i, m)));
+            }
+
+            // Published the same way a real host does it
+            FLobbyMetadata Metadata;
+            Metadata.HostName = FString::Printf(TEXT("Player_%d_0"), i);
+            Metadata.GameMode = (i % 2) ? TEXT("Coop") : TEXT("Versus");
+            TUtf8StringBuilder<256> Blob;
+            Metadata.Encode(Blob);
+
+            Lobby.Data.Add(FName(FLobbyMetadata::BlobKey), FakeSteam::ToAnsi((const char*)Blob.ToString()));
+            Lobby.Data.Add(FName("GameKey"), FakeSteam::ToAnsi(GameKey.Get()));
+            Lobby.Data.Add(FName("Region"), FakeSteam::ToAnsi("Auto"));
+
+            const FVector2f HostPoint(PingRandom.FRandRange(0.f, FakeSteam::PingSquareMs), PingRandom.FRandRange(0.f, FakeSteam::PingSquareMs));
+            Lobby.Data.Add(FName(FSteamPingLocationCache::LobbyKey), FakeSteam::PingPointString(HostPoint));
+            LobbyLookup.Add(Lobby.LobbyID.ConvertToUint64(), Lobbies.Num() - 1);
+            if (i < Config.NumFriends)
+            {
+                Friends.Add(Lobby.Owner);
+                if (i % 3 != 2)
+                {
+                    OnlineUsers.Add(Lobby.Owner.ConvertToUint64());
+                }
+                if (i % 3 == 0)
+                {
+                    const FString Connect = FString::Printf(TEXT("%s%llu"), UTF8_TO_TCHAR(FSteamFriendsCache::ConnectLobbyPrefix), Lobby.LobbyID.ConvertToUint64());
+                    RichPresence.FindOrAdd(Lobby.Owner.ConvertToUint64()).Add(FName(FSteamFriendsCache::ConnectKey), FakeSteam::ToAnsi(TCHAR_TO_UTF8(*Connect)));
+                }
+            }
+        }
+
+        bRunning = true;
+        return true;
+    }
+}
+// - 1.2 - //
+void FFakeSteamBackend::Shutdown()
+{
+    bRunning = false;
+    Lobbies.Empty();
+    LobbyLookup.Empty();
+    UserNames.Empty();
+    Friends.Empty();
+    OnlineUsers.Empty();
+    RichPresence.Empty();
+    PendingCallbacks.Empty();
+    LastLobbyList.Empty();
+    PendingListRequest = FLobbyListRequest();
+
+    // Stats and leaderboards stay, like on Steam's servers, the next session requests them again
+    bStatsReceived = false;
+    Downloads.Empty();
+}
+// - 1.3 - //
+void FFakeSteamBackend::Tick(float DeltaTime)
+{
+    Now += DeltaTime;
+    while (PendingCallbacks.Num() > 0 && PendingCallbacks.HeapTop().DueTime <= Now)
+    {
+        FPendingCallback Pending;
+        PendingCallbacks.HeapPop(Pending, FakeSteam::FPendingOrder(), EAllowShrinking::No);
+        if (Pending.Apply)
+        {
+            Pending.Apply(Pending.Payload.GetData());
+        }
+        CallbackRouter.Dispatch(Pending.CallbackId, Pending.Payload.GetData());
+        CallbackRouter.DispatchCallResult(Pending.APICall, Pending.CallbackId, Pending.Payload.GetData(), false);
+
+        // Steam frees downloaded entries once their callback returns
+        if (Pending.CallbackId == LeaderboardScoresDownloaded_t::k_iCallback)
+        {
+            Downloads.Remove(((LeaderboardScoresDownloaded_t*)Pending.Payload.GetData())->m_hSteamLeaderboardEntries);
+        }
+    }
+}
+// - 1.4 - //
+template<typename CallbackType>
+SteamAPICall_t FFakeSteamBackend::Post(const CallbackType& Payload, TFunction<void(void*)> Apply, double DelaySeconds)
+{
+    if (DelaySeconds < 0.0)
+    {
+        DelaySeconds = Random.FRandRange(Config.MinLatencyMs, FMath::Max(Config.MinLatencyMs, Config.MaxLatencyMs)) / 1000.0;
+    }
+
+    FPendingCallback Pending;
+    Pending.DueTime = Now + DelaySeconds;
+    Pending.Sequence = NextSequence++;
+    Pending.CallbackId = CallbackType::k_iCallback;
+    Pending.APICall = NextAPICall++;
+    Pending.Payload.SetNumUninitialized(sizeof(CallbackType));
+    FMemory::Memcpy(Pending.Payload.GetData(), &Payload, sizeof(CallbackType));
+    Pending.Apply = MoveTemp(Apply);
+    const SteamAPICall_t APICall = Pending.APICall;
+    PendingCallbacks.HeapPush(MoveTemp(Pending), FakeSteam::FPendingOrder());
+
+    return APICall;
+}
+// - 1.5 - //
+CSteamID FFakeSteamBackend::AddSimulatedLobby(int32 NumMembers, int32 MaxMembers)
+{
+    FFakeLobby& Lobby = Lobbies.AddDefaulted_GetRef();
+    Lobby.LobbyID = MakeLobbyID();
+    Lobby.MaxMembers = FMath::Max(MaxMembers, NumMembers);
+    for (int32 m = 0; m < NumMembers; ++m)
+    {
+        Lobby.Members.Add(MakeUser(FString::Printf(TEXT("Member_%u_%d"), Lobby.LobbyID.GetAccountID(), m)));
+    }
+    Lobby.Owner = Lobby.Members.Num() > 0 ? Lobby.Members[0] : LocalUser;
+    Lobby.Data.Add(FName("GameKey"), FakeSteam::ToAnsi(StringCast<ANSICHAR>(*Config.GameKey).Get()));
+    LobbyLookup.Add(Lobby.LobbyID.ConvertToUint64(), Lobbies.Num() - 1);
+    return Lobby.LobbyID;
+}
+// - 1.6 - //
+CSteamID FFakeSteamBackend::AddSimulatedMember(CSteamID LobbyID)
+{
+    const CSteamID MemberID = MakeUser(FString::Printf(TEXT("Member_%u_%u"), LobbyID.GetAccountID(), NextAccountID));
+
+    LobbyChatUpdate_t Update = {};
+    Update.m_ulSteamIDLobby = LobbyID.ConvertToUint64();
+    Update.m_ulSteamIDUserChanged = MemberID.ConvertToUint64();
+    Update.m_ulSteamIDMakingChange = MemberID.ConvertToUint64();
+    Update.m_rgfChatMemberStateChange = k_EChatMemberStateChangeEntered;
+    Post(Update, [this, LobbyID, MemberID](void*)
+    {
+        if (FFakeLobby* Lobby = FindLobby(LobbyID))
+        {
+            Lobby->Members.AddUnique(MemberID);
+        }
+    });
+    return MemberID;
+}
+
+void FFakeSteamBackend::RemoveSimulatedMember(CSteamID LobbyID, CSteamID MemberID)
+{
+    LobbyChatUpdate_t Update = {};
+    Update.m_ulSteamIDLobby = LobbyID.ConvertToUint64();
+    Update.m_ulSteamIDUserChanged = MemberID.ConvertToUint64();
+    Update.m_ulSteamIDMakingChange = MemberID.ConvertToUint64();
+    Update.m_rgfChatMemberStateChange = k_EChatMemberStateChangeLeft;
+    Post(Update, [this, LobbyID, MemberID](void*)
+    {
+        if (FFakeLobby* Lobby = FindLobby(LobbyID))
+        {
+            Lobby->Members.Remove(MemberID);
+            Lobby->MemberData.Remove(MemberID.ConvertToUint64());
+            if (Lobby->Owner == MemberID && Lobby->Members.Num() > 0)
+            {
+                // Steam hands the lobby to someone else and tells everyone through the lobby data
+                Lobby->Owner = Lobby->Members[0];
+
+                LobbyDataUpdate_t OwnerUpdate = {};
+                OwnerUpdate.m_ulSteamIDLobby = LobbyID.ConvertToUint64();
+                OwnerUpdate.m_ulSteamIDMember = LobbyID.ConvertToUint64();
+                OwnerUpdate.m_bSuccess = true;
+                Post(OwnerUpdate);
+            }
+        }
+    });
+}
+
+void FFakeSteamBackend::SetSimulatedMemberData(CSteamID LobbyID, CSteamID MemberID, const char* Key, const char* Value)
+{
+    LobbyDataUpdate_t Update = {};
+    Update.m_ulSteamIDLobby = LobbyID.ConvertToUint64();
+    Update.m_ulSteamIDMember = MemberID.ConvertToUint64();
+    Update.m_bSuccess = true;
+    Post(Update, [this, LobbyID, MemberID, Key = FName(Key), Value = FakeSteam::ToAnsi(Value)](void*)
+    {
+        if (FFakeLobby* Lobby = FindLobby(LobbyID))
+        {
+            Lobby->MemberData.FindOrAdd(MemberID.ConvertToUint64()).Add(Key, Value);
+        }
+    });
+}
+
+void FFakeSteamBackend::SendSimulatedChatMsg(CSteamID LobbyID, CSteamID MemberID, const void* Data, int32 Size)
+{
+    PostChatMsg(LobbyID, MemberID, Data, FMath::Min(Size, FakeSteam::MaxChatMsgBytes));
+}
+
+void FFakeSteamBackend::SetSimulatedLobbyData(CSteamID LobbyID, const char* Key, const char* Value)
+{
+    LobbyDataUpdate_t Update = {};
+    Update.m_ulSteamIDLobby = LobbyID.ConvertToUint64();
+    Update.m_ulSteamIDMember = LobbyID.ConvertToUint64();
+    Update.m_bSuccess = true;
+    Post(Update, [this, LobbyID, Key = FName(Key), Value = FakeSteam::ToAnsi(Value)](void*)
+    {
+        if (FFakeLobby* Lobby = FindLobby(LobbyID))
+        {
+            Lobby->Data.Add(Key, Value);
+        }
+    });
+}
+
+void FFakeSteamBackend::SetSimulatedRichPresence(CSteamID UserID, const char* Key, const char* Value)
+{
+    FriendRichPresenceUpdate_t Update = {};
+    Update.m_steamIDFriend = UserID;
+    Post(Update, [this, UserID, Key = FName(Key), Value = FakeSteam::ToAnsi(Value)](void*)
+    {
+        TMap<FName, TArray<ANSICHAR>>& Presence = RichPresence.FindOrAdd(UserID.ConvertToUint64());
+        if (Value.Num() > 1)
+        {
+            Presence.Add(Key, Value);
+        }
+        else
+        {
+            Presence.Remove(Key);
+        }
+    });
+}
+/////////////////////////
+// 2. Matchmaking     //
+////////////////////////////////////////////
+// 2.1 - Create lobby                    //
+// 2.2 - Join lobby                     //
+// 2.3 - Leave lobby                   //
+// 2.4 - Request lobby list           //
+// 2.5 - Lobby list filters          //
+// 2.6 - Lobby queries              //
+// 2.7 - Lobby + member data       //
+// 2.8 - Lobby chat               //
+///////////////////////////////////
+// - 2.1 - //
+SteamAPICall_t FFakeSteamBackend::CreateLobby(ELobbyType LobbyType, int32 MaxMembers)
+{
+    LobbyCreated_t Created = {};
+    if (RollFailure())
+    {
+        Created.m_eResult = k_EResultFail;
+        return Post(Created);
+    }
+    else
+    {
+        const CSteamID LobbyID = MakeLobbyID();
+        Created.m_eResult = k_EResultOK;
+        Created.m_ulSteamIDLobby = LobbyID.ConvertToUint64();
+
+        return Post(Created, [this, LobbyID, MaxMembers](void*)
+        {
+            FFakeLobby& Lobby = Lobbies.AddDefaulted_GetRef();
+            Lobby.LobbyID = LobbyID;
+            Lobby.Owner = LocalUser;
+            Lobby.MaxMembers = MaxMembers;
+            Lobby.Members.Add(LocalUser);
+            LobbyLookup.Add(LobbyID.ConvertToUint64(), Lobbies.Num() - 1);
+
+            // Steam follows LobbyCreated_t with LobbyEnter_t for the creator
+            LobbyEnter_t Entered = {};
+            Entered.m_ulSteamIDLobby = LobbyID.ConvertToUint64();
+            Entered.m_EChatRoomEnterResponse = k_EChatRoomEnterResponseSuccess;
+            Post(Entered, nullptr, 0.0);
+        });
+    }
+}
+// - 2.2 - //
+SteamAPICall_t FFakeSteamBackend::JoinLobby(CSteamID LobbyID)
+{
+    LobbyEnter_t Entered = {};
+    Entered.m_ulSteamIDLobby = LobbyID.ConvertToUint64();
+    const bool bFail = RollFailure();
+
+    // Outcome is decided when the callback lands, the lobby may fill up in the meantime
+    return Post(Entered, [this, LobbyID, bFail](void* Payload)
+    {
+        LobbyEnter_t* Result = (LobbyEnter_t*)Payload;
+        FFakeLobby* Lobby = FindLobby(LobbyID);
+        if (bFail)
+        {
+            Result->m_EChatRoomEnterResponse = k_EChatRoomEnterResponseError;
+        }
+        else if (!Lobby)
+        {
+            Result->m_EChatRoomEnterResponse = k_EChatRoomEnterResponseDoesntExist;
+        }
+        else if (Lobby->Members.Contains(LocalUser))
+        {
+            Result->m_EChatRoomEnterResponse = k_EChatRoomEnterResponseSuccess;
+        }
+        else if (Lobby->Members.Num() >= Lobby->MaxMembers)
+        {
+            Result->m_EChatRoomEnterResponse = k_EChatRoomEnterResponseFull;
+        }
+        else
+        {
+            Lobby->Members.Add(LocalUser);
+            Result->m_EChatRoomEnterResponse = k_EChatRoomEnterResponseSuccess;
+        }
+    });
+}
+// - 2.3 - //
+void FFakeSteamBackend::LeaveLobby(CSteamID LobbyID)
+{
+    FFakeLobby* Lobby = FindLobby(LobbyID);
+    if (Lobby && Lobby->Members.Remove(LocalUser) > 0)
+    {
+        Lobby->MemberData.Remove(LocalUser.ConvertToUint64());
+        if (Lobby->Members.Num() == 0)
+        {
+            // Last one out closes the lobby, swap the tail into its place
+            const int32 Index = LobbyLookup.FindAndRemoveChecked(LobbyID.ConvertToUint64());
+            Lobbies.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+            if (Lobbies.IsValidIndex(Index))
+            {
+                LobbyLookup.Add(Lobbies[Index].LobbyID.ConvertToUint64(), Index);
+            }
+        }
+        else if (Lobby->Owner == LocalUser)
+        {
+            Lobby->Owner = Lobby->Members[0];
+        }
+    }
+}
+// - 2.4 - //
+SteamAPICall_t FFakeSteamBackend::RequestLobbyList()
+{
+    LobbyMatchList_t Matches = {};
+    const bool bFail = RollFailure();
+
+    // Filters apply to this request only, same as Steam
+    FLobbyListRequest Request = MoveTemp(PendingListRequest);
+    PendingListRequest = FLobbyListRequest();
+
+    return Post(Matches, [this, Request = MoveTemp(Request), bFail](void* Payload)
+    {
+        LastLobbyList.Reset();
+        if (!bFail)
+        {
+            for (const FFakeLobby& Lobby : Lobbies)
+            {
+                if (PassesFilters(Lobby, Request))
+                {
+                    LastLobbyList.Add(Lobby.LobbyID);
+                }
+            }
+
+            if (Request.NearValue.IsSet())
+            {
+                const FName Key = Request.NearValue->Key;
+                const int32 Target = Request.NearValue->Value;
+                LastLobbyList.StableSort([this, Key, Target](const CSteamID& A, const CSteamID& B)
+                {
+                    return FMath::Abs(GetLobbyNumber(*FindLobby(A), Key) - Target) < FMath::Abs(GetLobbyNumber(*FindLobby(B), Key) - Target);
+                });
+            }
+
+            if (LastLobbyList.Num() > Request.ResultCount)
+            {
+                LastLobbyList.SetNum(Request.ResultCount, EAllowShrinking::No);
+            }
+        }
+        ((LobbyMatchList_t*)Payload)->m_nLobbiesMatching = LastLobbyList.Num();
+    });
+}
+// - 2.5 - //
+void FFakeSteamBackend::AddRequestLobbyListStringFilter(const char* Key, const char* Value, ELobbyComparison Comparison)
+{
+    FLobbyListFilter& Filter = PendingListRequest.Filters.AddDefaulted_GetRef();
+    Filter.Key = FName(Key);
+    Filter.StringValue = FakeSteam::ToAnsi(Value);
+    Filter.Comparison = Comparison;
+}
+
+void FFakeSteamBackend::AddRequestLobbyListNumericalFilter(const char* Key, int32 Value, ELobbyComparison Comparison)
+{
+    FLobbyListFilter& Filter = PendingListRequest.Filters.AddDefaulted_GetRef();
+    Filter.Key = FName(Key);
+    Filter.NumericValue = Value;
+    Filter.Comparison = Comparison;
+    Filter.bNumeric = true;
+}
+
+void FFakeSteamBackend::AddRequestLobbyListNearValueFilter(const char* Key, int32 Value)
+{
+    PendingListRequest.NearValue = TPair<FName, int32>(FName(Key), Value);
+}
+
+void FFakeSteamBackend::AddRequestLobbyListFilterSlotsAvailable(int32 SlotsAvailable)
+{
+    PendingListRequest.SlotsAvailable = SlotsAvailable;
+}
+
+void FFakeSteamBackend::AddRequestLobbyListResultCountFilter(int32 MaxResults)
+{
+    PendingListRequest.ResultCount = MaxResults;
+}
+// - 2.6 - //
+CSteamID FFakeSteamBackend::GetLobbyByIndex(int32 Index)
+{
+    return LastLobbyList.IsValidIndex(Index) ? LastLobbyList[Index] : CSteamID();
+}
+
+int32 FFakeSteamBackend::GetNumLobbyMembers(CSteamID LobbyID)
+{
+    const FFakeLobby* Lobby = FindLobby(LobbyID);
+    return Lobby ? Lobby->Members.Num() : 0;
+}
+
+CSteamID FFakeSteamBackend::GetLobbyMemberByIndex(CSteamID LobbyID, int32 Index)
+{
+    const FFakeLobby* Lobby = FindLobby(LobbyID);
+    return Lobby && Lobby->Members.IsValidIndex(Index) ? Lobby->Members[Index] : CSteamID();
+}
+
+int32 FFakeSteamBackend::GetLobbyMemberLimit(CSteamID LobbyID)
+{
+    const FFakeLobby* Lobby = FindLobby(LobbyID);
+    return Lobby ? Lobby->MaxMembers : 0;
+}
+
+CSteamID FFakeSteamBackend::GetLobbyOwner(CSteamID LobbyID)
+{
+    const FFakeLobby* Lobby = FindLobby(LobbyID);
+    return Lobby ? Lobby->Owner : CSteamID();
+}
+
+bool FFakeSteamBackend::SetLobbyOwner(CSteamID LobbyID, CSteamID NewOwner)
+{
+    // Only the owner may hand the lobby over, and only to a member
+    const FFakeLobby* Lobby = FindLobby(LobbyID);
+    if (!Lobby || Lobby->Owner != LocalUser || !Lobby->Members.Contains(NewOwner))
+    {
+        return false;
+    }
+    else
+    {
+        LobbyDataUpdate_t Update = {};
+        Update.m_ulSteamIDLobby = LobbyID.ConvertToUint64();
+        Update.m_ulSteamIDMember = LobbyID.ConvertToUint64();
+        Update.m_bSuccess = true;
+        Post(Update, [this, LobbyID, NewOwner](void*)
+        {
+            FFakeLobby* Target = FindLobby(LobbyID);
+            if (Target && Target->Members.Contains(NewOwner))
+            {
+                Target->Owner = NewOwner;
+            }
+        });
+        return true;
+    }
+}
+// - 2.7 - //
+const char* FFakeSteamBackend::GetLobbyData(CSteamID LobbyID, const char* Key)
+{
+    // FNAME_Find keeps unknown keys from growing the name table
+    const FFakeLobby* Lobby = FindLobby(LobbyID);
+    const TArray<ANSICHAR>* Value = Lobby ? Lobby->Data.Find(FName(Key, FNAME_Find)) : nullptr;
+    return Value ? Value->GetData() : "";
+}
+
+bool FFakeSteamBackend::SetLobbyData(CSteamID LobbyID, const char* Key, const char* Value)
+{
+    FFakeLobby* Lobby = FindLobby(LobbyID);
+    if (!Lobby || Lobby->Owner != LocalUser)
+    {
+        return false;
+    }
+    else
+    {
+        Lobby->Data.Add(FName(Key), FakeSteam::ToAnsi(Value));
+
+        LobbyDataUpdate_t Update = {};
+        Update.m_ulSteamIDLobby = LobbyID.ConvertToUint64();
+        Update.m_ulSteamIDMember = LobbyID.ConvertToUint64();
+        Update.m_bSuccess = true;
+        Post(Update);
+        return true;
+    }
+}
+
+const char* FFakeSteamBackend::GetLobbyMemberData(CSteamID LobbyID, CSteamID UserID, const char* Key)
+{
+    const FFakeLobby* Lobby = FindLobby(LobbyID);
+    const TMap<FName, TArray<ANSICHAR>>* MemberData = Lobby ? Lobby->MemberData.Find(UserID.ConvertToUint64()) : nullptr;
+    const TArray<ANSICHAR>* Value = MemberData ? MemberData->Find(FName(Key, FNAME_Find)) : nullptr;
+    return Value ? Value->GetData() : "";
+}
+
+void FFakeSteamBackend::SetLobbyMemberData(CSteamID LobbyID, const char* Key, const char* Value)
+{
+    // Steam drops the write when we are not in the lobby
+    FFakeLobby* Lobby = FindLobby(LobbyID);
+    if (Lobby && Lobby->Members.Contains(LocalUser))
+    {
+        Lobby->MemberData.FindOrAdd(LocalUser.ConvertToUint64()).Add(FName(Key), FakeSteam::ToAnsi(Value));
+
+        LobbyDataUpdate_t Update = {};
+        Update.m_ulSteamIDLobby = LobbyID.ConvertToUint64();
+        Update.m_ulSteamIDMember = LocalUser.ConvertToUint64();
+        Update.m_bSuccess = true;
+        Post(Update);
+    }
+}
+// - 2.8 - //
+bool FFakeSteamBackend::SendLobbyChatMsg(CSteamID LobbyID, const void* Data, int32 Size)
+{
+    // Steam refuses empty or oversized messages and lobbies we are not in
+    const FFakeLobby* Lobby = FindLobby(LobbyID);
+    if (!Lobby || !Lobby->Members.Contains(LocalUser) || Size <= 0 || Size > FakeSteam::MaxChatMsgBytes)
+    {
+        return false;
+    }
+    else
+    {
+        PostChatMsg(LobbyID, LocalUser, Data, Size);
+        return true;
+    }
+}
+
+int32 FFakeSteamBackend::GetLobbyChatEntry(CSteamID LobbyID, int32 ChatID, CSteamID* OutUser, void* OutBuffer, int32 BufferSize, EChatEntryType* OutType)
+{
+    const FFakeLobby* Lobby = FindLobby(LobbyID);
+    const FFakeChatEntry* Entry = Lobby && ChatID >= 0 && Lobby->ChatLog.Num() > 0 ? &Lobby->ChatLog[ChatID % Lobby->ChatLog.Num()] : nullptr;
+    if (!Entry || Entry->ChatID != ChatID)
+    {
+        return 0;
+    }
+
+    // Truncated to the buffer, like Steam
+    const int32 Copied = FMath::Clamp(BufferSize, 0, Entry->Data.Num());
+    FMemory::Memcpy(OutBuffer, Entry->Data.GetData(), Copied);
+    if (OutUser)
+    {
+        *OutUser = Entry->User;
+    }
+    if (OutType)
+    {
+        *OutType = k_EChatEntryTypeChatMsg;
+    }
+    return Copied;
+}
+/////////////////////////
+// 3. Friends + Utils //
+////////////////////////////////////////////
+// 3.1 - Persona names                   //
+// 3.2 - Avatars                        //
+// 3.3 - Ping locations                //
+// 3.4 - Rich presence                //
+///////////////////////////////////////
+// - 3.1 - //
+const char* FFakeSteamBackend::GetFriendPersonaName(CSteamID SteamID)
+{
+    const TArray<ANSICHAR>* Name = UserNames.Find(SteamID.ConvertToUint64());
+    return Name ? Name->GetData() : "[unknown]";
+}
+// - 3.2 - //
+int FFakeSteamBackend::GetLargeFriendAvatar(CSteamID SteamID)
+{
+    return UserNames.Contains(SteamID.ConvertToUint64()) ? (int)SteamID.GetAccountID() : 0;
+}
+
+bool FFakeSteamBackend::GetImageSize(int Image, uint32* OutWidth, uint32* OutHeight)
+{
+    // Pure function of the handle, safe on the avatar worker
+    if (Image <= 0)
+    {
+        return false;
+    }
+    else
+    {
+        *OutWidth = FakeSteam::AvatarSize;
+        *OutHeight = FakeSteam::AvatarSize;
+        return true;
+    }
+}
+
+bool FFakeSteamBackend::GetImageRGBA(int Image, uint8* OutBuffer, int BufferSize)
+{
+    const int32 NumPixels = FakeSteam::AvatarSize * FakeSteam::AvatarSize;
+    if (Image <= 0 || BufferSize < NumPixels * 4)
+    {
+        return false;
+    }
+    else
+    {
+        const uint32 Colour = ((uint32)Image * 2654435761u) | 0xFF000000u;
+        uint32* Pixels = (uint32*)OutBuffer;
+        for (int32 i = 0; i < NumPixels; ++i)
+        {
+            Pixels[i] = Colour;
+        }
+        return true;
+    }
+}
+// - 3.3 - //
+float FFakeSteamBackend::GetLocalPingLocation(SteamNetworkPingLocation_t& OutLocation)
+{
+    // Measured once at Init, the simulated world never moves
+    if (!bRunning)
+    {
+        return -1.f;
+    }
+    else
+    {
+        FakeSteam::WritePingPoint(OutLocation, LocalPingPoint);
+        return 0.f;
+    }
+}
+
+int32 FFakeSteamBackend::EstimatePingTimeBetweenTwoLocations(const SteamNetworkPingLocation_t& A, const SteamNetworkPingLocation_t& B)
+{
+    FVector2f PointA, PointB;
+    if (!FakeSteam::ReadPingPoint(A, PointA) || !FakeSteam::ReadPingPoint(B, PointB))
+    {
+        return -1;
+    }
+    else
+    {
+        return FakeSteam::PingBaseMs + FMath::RoundToInt(FVector2f::Distance(PointA, PointB));
+    }
+}
+
+void FFakeSteamBackend::ConvertPingLocationToString(const SteamNetworkPingLocation_t& Location, char* OutBuffer, int32 BufferSize)
+{
+    FVector2f Point;
+    const TArray<ANSICHAR> String = FakeSteam::ReadPingPoint(Location, Point) ? FakeSteam::PingPointString(Point) : FakeSteam::ToAnsi("");
+    if (BufferSize > 0)
+    {
+        FCStringAnsi::Strncpy(OutBuffer, String.GetData(), BufferSize);
+    }
+}
+
+bool FFakeSteamBackend::ParsePingLocationString(const char* String, SteamNetworkPingLocation_t& OutLocation)
+{
+    const char* Comma = String ? FCStringAnsi::Strchr(String, ',') : nullptr;
+    if (!Comma || FCStringAnsi::Strncmp(String, "fake=", 5) != 0)
+    {
+        return false;
+    }
+    else
+    {
+        const float X = (float)FCStringAnsi::Atoi(String + 5);
+        const float Y = (float)FCStringAnsi::Atoi(Comma + 1);
+        FakeSteam::WritePingPoint(OutLocation, FVector2f(X, Y));
+        return true;
+    }
+}
+// - 3.4 - //
+const char* FFakeSteamBackend::GetFriendRichPresence(CSteamID SteamID, const char* Key)
+{
+    const TMap<FName, TArray<ANSICHAR>>* Presence = RichPresence.Find(SteamID.ConvertToUint64());
+    const TArray<ANSICHAR>* Value = Presence ? Presence->Find(FName(Key)) : nullptr;
+    return Value ? Value->GetData() : "";
+}
+
+bool FFakeSteamBackend::SetRichPresence(const char* Key, const char* Value)
+{
+    // Our own presence, nobody simulated watches it
+    TMap<FName, TArray<ANSICHAR>>& Presence = RichPresence.FindOrAdd(LocalUser.ConvertToUint64());
+    if (Value && Value[0] != '\0')
+    {
+        Presence.Add(FName(Key), FakeSteam::ToAnsi(Value));
+    }
+    else
+    {
+        Presence.Remove(FName(Key));
+    }
+    return true;
+}
+/////////////////////////
+// 4. User Stats      //
+////////////////////////////////////////////
+// 4.1 - Stats + achievements            //
+// 4.2 - Store stats                    //
+// 4.3 - Find leaderboard              //
+// 4.4 - Upload score                 //
+// 4.5 - Download entries            //
+//////////////////////////////////////
+// - 4.1 - //
+bool FFakeSteamBackend::RequestCurrentStats()
+{
+    UserStatsReceived_t Received = {};
+    Received.m_steamIDUser = LocalUser;
+    Received.m_eResult = RollFailure() ? k_EResultFail : k_EResultOK;
+    Post(Received, [this](void* Payload)
+    {
+        bStatsReceived |= ((UserStatsReceived_t*)Payload)->m_eResult == k_EResultOK;
+    });
+    return true;
+}
+
+bool FFakeSteamBackend::GetStatInt(const char* Name, int32* OutValue)
+{
+    if (!bStatsReceived)
+    {
+        return false;
+    }
+    else
+    {
+        const int32* Value = IntStats.Find(FName(Name));
+        *OutValue = Value ? *Value : 0;
+        return true;
+    }
+}
+
+bool FFakeSteamBackend::GetStatFloat(const char* Name, float* OutValue)
+{
+    if (!bStatsReceived)
+    {
+        return false;
+    }
+    else
+    {
+        const float* Value = FloatStats.Find(FName(Name));
+        *OutValue = Value ? *Value : 0.f;
+        return true;
+    }
+}
+
+bool FFakeSteamBackend::SetStatInt(const char* Name, int32 Value)
+{
+    if (!bStatsReceived)
+    {
+        return false;
+    }
+    else
+    {
+        IntStats.Add(FName(Name), Value);
+        ++NumStatWrites;
+        return true;
+    }
+}
+
+bool FFakeSteamBackend::SetStatFloat(const char* Name, float Value)
+{
+    if (!bStatsReceived)
+    {
+        return false;
+    }
+    else
+    {
+        FloatStats.Add(FName(Name), Value);
+        ++NumStatWrites;
+        return true;
+    }
+}
+
+bool FFakeSteamBackend::GetAchievement(const char* Name, bool* OutAchieved)
+{
+    if (!bStatsReceived)
+    {
+        return false;
+    }
+    else
+    {
+        *OutAchieved = Achievements.Contains(FName(Name));
+        return true;
+    }
+}
+
+bool FFakeSteamBackend::SetAchievement(const char* Name)
+{
+    if (!bStatsReceived)
+    {
+        return false;
+    }
+    else
+    {
+        Achievements.Add(FName(Name));
+        ++NumStatWrites;
+        return true;
+    }
+}
+// - 4.2 - //
+bool FFakeSteamBackend::StoreStats()
+{
+    if (!bStatsReceived)
+    {
+        return false;
+    }
+    else
+    {
+        ++NumStatsStores;
+        UserStatsStored_t Stored = {};
+        Stored.m_eResult = RollFailure() ? k_EResultFail : k_EResultOK;
+        Post(Stored);
+        return true;
+    }
+}
+// - 4.3 - //
+SteamAPICall_t FFakeSteamBackend::FindLeaderboard(const char* Name)
+{
+    LeaderboardFindResult_t Found = {};
+    if (RollFailure())
+    {
+        return Post(Found);
+    }
+    else
+    {
+        return Post(Found, [this, BoardName = FName(Name)](void* Payload)
+        {
+            LeaderboardFindResult_t* Result = (LeaderboardFindResult_t*)Payload;
+            Result->m_hSteamLeaderboard = FindOrAddLeaderboard(BoardName);
+            Result->m_bLeaderboardFound = 1;
+        });
+    }
+}
+// - 4.4 - //
+SteamAPICall_t FFakeSteamBackend::UploadLeaderboardScore(SteamLeaderboard_t Leaderboard, ELeaderboardUploadScoreMethod Method, int32 Score)
+{
+    ++NumLeaderboardUploads;
+    LeaderboardScoreUploaded_t Uploaded = {};
+    Uploaded.m_hSteamLeaderboard = Leaderboard;
+    Uploaded.m_nScore = Score;
+    const bool bFail = RollFailure();
+
+    return Post(Uploaded, [this, Leaderboard, Method, Score, bFail](void* Payload)
+    {
+        LeaderboardScoreUploaded_t* Result = (LeaderboardScoreUploaded_t*)Payload;
+        FFakeLeaderboard* Board = GetLeaderboard(Leaderboard);
+        if (bFail || !Board)
+        {
+            return;
+        }
+
+        auto IsLocal = [this](const LeaderboardEntry_t& Entry) { return Entry.m_steamIDUser == LocalUser; };
+        const int32 Index = Board->Entries.IndexOfByPredicate(IsLocal);
+        const bool bChanged = Index == INDEX_NONE || Method == k_ELeaderboardUploadScoreMethodForceUpdate || Score > Board->Entries[Index].m_nScore;
+        Result->m_bSuccess = 1;
+        Result->m_bScoreChanged = bChanged;
+        Result->m_nGlobalRankPrevious = Index != INDEX_NONE ? Board->Entries[Index].m_nGlobalRank : 0;
+
+        if (bChanged)
+        {
+            LeaderboardEntry_t Entry = {};
+            Entry.m_steamIDUser = LocalUser;
+            Entry.m_nScore = Score;
+            Entry.m_hUGC = k_UGCHandleInvalid;
+            if (Index != INDEX_NONE)
+            {
+                Board->Entries[Index] = Entry;
+            }
+            else
+            {
+                Board->Entries.Add(Entry);
+            }
+            RankLeaderboard(*Board);
+        }
+        Result->m_nGlobalRankNew = Board->Entries[Board->Entries.IndexOfByPredicate(IsLocal)].m_nGlobalRank;
+    });
+}
+// - 4.5 - //
+SteamAPICall_t FFakeSteamBackend::DownloadLeaderboardEntries(SteamLeaderboard_t Leaderboard, ELeaderboardDataRequest Request, int32 RangeStart, int32 RangeEnd)
+{
+    LeaderboardScoresDownloaded_t Downloaded = {};
+    Downloaded.m_hSteamLeaderboard = Leaderboard;
+
+    // Rows are picked when the callback lands, uploads in the meantime show up in them
+    return Post(Downloaded, [this, Leaderboard, Request, RangeStart, RangeEnd](void* Payload)
+    {
+        LeaderboardScoresDownloaded_t* Result = (LeaderboardScoresDownloaded_t*)Payload;
+        const FFakeLeaderboard* Board = GetLeaderboard(Leaderboard);
+        if (!Board)
+        {
+            return;
+        }
+
+        TArray<LeaderboardEntry_t>& Rows = Downloads.Add(NextDownloadHandle);
+        if (Request == k_ELeaderboardDataRequestFriends)
+        {
+            TSet<uint64> Circle;
+            Circle.Add(LocalUser.ConvertToUint64());
+            for (const CSteamID& Friend : Friends)
+            {
+                Circle.Add(Friend.ConvertToUint64());
+            }
+            for (const LeaderboardEntry_t& Entry : Board->Entries)
+            {
+                if (Circle.Contains(Entry.m_steamIDUser.ConvertToUint64()))
+                {
+                    Rows.Add(Entry);
+                }
+            }
+        }
+        else
+        {
+            // Global ranges are 1-based ranks, around-user ranges are offsets from the local entry
+            int32 First = RangeStart - 1;
+            int32 Last = RangeEnd - 1;
+            if (Request == k_ELeaderboardDataRequestGlobalAroundUser)
+            {
+                const int32 UserIndex = Board->Entries.IndexOfByPredicate([this](const LeaderboardEntry_t& Entry) { return Entry.m_steamIDUser == LocalUser; });
+                First = UserIndex != INDEX_NONE ? UserIndex + RangeStart : 0;
+                Last = UserIndex != INDEX_NONE ? UserIndex + RangeEnd : -1;
+            }
+
+            First = FMath::Max(First, 0);
+            Last = FMath::Min(Last, Board->Entries.Num() - 1);
+            for (int32 i = First; i <= Last; ++i)
+            {
+                Rows.Add(Board->Entries[i]);
+            }
+        }
+        Result->m_hSteamLeaderboardEntries = NextDownloadHandle++;
+        Result->m_cEntryCount = Rows.Num();
+    });
+}
+
+bool FFakeSteamBackend::GetDownloadedLeaderboardEntry(SteamLeaderboardEntries_t Entries, int32 Index, LeaderboardEntry_t* OutEntry)
+{
+    const TArray<LeaderboardEntry_t>* Rows = Downloads.Find(Entries);
+    if (!Rows || !Rows->IsValidIndex(Index))
+    {
+        return false;
+    }
+    else
+    {
+        *OutEntry = (*Rows)[Index];
+        return true;
+    }
+}
+/////////////////////////
+// 5. Helpers         //
+////////////////////////////////////////////
+// 5.1 - Make IDs                        //
+// 5.2 - Lookups                        //
+// 5.3 - Filters                       //
+// 5.4 - Leaderboards                 //
+// 5.5 - Lobby chat log              //
+//////////////////////////////////////
+// - 5.1 - //
+CSteamID FFakeSteamBackend::MakeUser(const FString& Name)
+{
+    const CSteamID UserID(NextAccountID++, 1, k_EUniversePublic, k_EAccountTypeIndividual);
+    UserNames.Add(UserID.ConvertToUint64(), FakeSteam::ToAnsi(TCHAR_TO_UTF8(*Name)));
+    return UserID;
+}
+
+CSteamID FFakeSteamBackend::MakeLobbyID()
+{
+    return CSteamID(NextAccountID++, k_EChatInstanceFlagLobby, k_EUniversePublic, k_EAccountTypeChat);
+}
+// - 5.2 - //
+FFakeSteamBackend::FFakeLobby* FFakeSteamBackend::FindLobby(CSteamID LobbyID)
+{
+    const int32* Index = LobbyLookup.Find(LobbyID.ConvertToUint64());
+    return Index ? &Lobbies[*Index] : nullptr;
+}
+
+bool FFakeSteamBackend::RollFailure()
+{
+    return Config.FailureRate > 0.f && Random.FRand() < Config.FailureRate;
+}
+// - 5.3 - //
+bool FFakeSteamBackend::PassesFilters(const FFakeLobby& Lobby, const FLobbyListRequest& Request) const
+{
+    if (Request.SlotsAvailable > 0 && Lobby.MaxMembers - Lobby.Members.Num() < Request.SlotsAvailable)
+    {
+        return false;
+    }
+
+    for (const FLobbyListFilter& Filter : Request.Filters)
+    {
+        if (Filter.bNumeric)
+        {
+            if (!FakeSteam::Compare(GetLobbyNumber(Lobby, Filter.Key) - Filter.NumericValue, Filter.Comparison))
+            {
+                return false;
+            }
+        }
+        else
+        {
+            const TArray<ANSICHAR>* Value = Lobby.Data.Find(Filter.Key);
+            const int32 Diff = FCStringAnsi::Strcmp(Value ? Value->GetData() : "", Filter.StringValue.GetData());
+            if (!FakeSteam::Compare(Diff, Filter.Comparison))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+int32 FFakeSteamBackend::GetLobbyNumber(const FFakeLobby& Lobby, FName Key) const
+{
+    const TArray<ANSICHAR>* Value = Lobby.Data.Find(Key);
+    return Value ? FCStringAnsi::Atoi(Value->GetData()) : 0;
+}
+// - 5.4 - //
+FFakeSteamBackend::FFakeLeaderboard* FFakeSteamBackend::GetLeaderboard(SteamLeaderboard_t Handle)
+{
+    return Handle > 0 && Handle <= (SteamLeaderboard_t)Leaderboards.Num() ? &Leaderboards[Handle - 1] : nullptr;
+}
+
+SteamLeaderboard_t FFakeSteamBackend::FindOrAddLeaderboard(FName Name)
+{
+    const int32 Existing = Leaderboards.IndexOfByPredicate([Name](const FFakeLeaderboard& Board) { return Board.Name == Name; });
+    if (Existing != INDEX_NONE)
+    {
+        return Existing + 1;
+    }
+
+    // Own stream per board, so finding boards in another order leaves their scores where they were
+    FRandomStream BoardRandom(Config.Seed + (int32)FCrc::StrCrc32(*Name.ToString()));
+    FFakeLeaderboard& Board = Leaderboards.AddDefaulted_GetRef();
+    Board.Name = Name;
+    Board.Entries.Reserve(Config.NumLeaderboardEntries + Friends.Num() + 1);
+
+    auto AddEntry = [&Board, &BoardRandom](CSteamID UserID)
+    {
+        LeaderboardEntry_t Entry = {};
+        Entry.m_steamIDUser = UserID;
+        Entry.m_nScore = BoardRandom.RandRange(0, FakeSteam::MaxLeaderboardScore);
+        Entry.m_hUGC = k_UGCHandleInvalid;
+        Board.Entries.Add(Entry);
+    };
+    for (int32 i = 0; i < Config.NumLeaderboardEntries; ++i)
+    {
+        AddEntry(CSteamID(FakeSteam::LeaderboardAccountBase + i, 1, k_EUniversePublic, k_EAccountTypeIndividual));
+    }
+    for (const CSteamID& Friend : Friends)
+    {
+        AddEntry(Friend);
+    }
+
+    RankLeaderboard(Board);
+    return Leaderboards.Num();
+}
+
+void FFakeSteamBackend::RankLeaderboard(FFakeLeaderboard& Board)
+{
+    Board.Entries.StableSort([](const LeaderboardEntry_t& A, const LeaderboardEntry_t& B) { return A.m_nScore > B.m_nScore; });
+    for (int32 i = 0; i < Board.Entries.Num(); ++i)
+    {
+        Board.Entries[i].m_nGlobalRank = i + 1;
+    }
+}
+// - 5.5 - //
+void FFakeSteamBackend::PostChatMsg(CSteamID LobbyID, CSteamID UserID, const void* Data, int32 Size)
+{
+    LobbyChatMsg_t Message = {};
+    Message.m_ulSteamIDLobby = LobbyID.ConvertToUint64();
+    Message.m_ulSteamIDUser = UserID.ConvertToUint64();
+    Message.m_eChatEntryType = (uint8)k_EChatEntryTypeChatMsg;
+
+    // Logged when it lands, so chat IDs follow delivery order like on Steam
+    Post(Message, [this, LobbyID, UserID, Body = TArray<uint8>((const uint8*)Data, Size)](void* Payload)
+    {
+        FFakeLobby* Lobby = FindLobby(LobbyID);
+        if (!Lobby)
+        {
+            return;
+        }
+        else if (Lobby->ChatLog.Num() == 0)
+        {
+            Lobby->ChatLog.SetNum(FakeSteam::ChatLogSize);
+        }
+
+        FFakeChatEntry& Entry = Lobby->ChatLog[Lobby->NextChatID % FakeSteam::ChatLogSize];
+        Entry.ChatID = Lobby->NextChatID++;
+        Entry.User = UserID;
+        Entry.Data.Reset();
+        Entry.Data.Append(Body);
+        ((LobbyChatMsg_t*)Payload)->m_iChatID = Entry.ChatID;
+    });
+}
+///////////////////////////////////////////
+// MORE COMING SOON  // A.S. - hajddeen //
+/////////////////////////////////////////
@@ -0,0 +1,309 @@
+// |------------------------------------|
+// |  !FOLLOW URBAN SHADOWS ON SOCIALS! |
+// |------------------------------------|
+//            \ (^ᴗ^) /
+//             \     /
+//              -----
+//              |   |
+//              |   |
+//              |_  |_ 
+////////////////////////////////////////////////////////////
+// STEAM P2P SESSIONS - Unreal 5.5 + Steamworks SDK 1.57 //
+//////////////////////////////////////////////////////////////////
+// LICENSE AGREEMENT // LICENSE AGREEMENT // LICENSE AGREEMENT //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                                                                                                                                                                                                                                          //
+// Last Updated: 03/12/2024                                                                                                                                                                                                                                //
+//                                                                                                                                                                                                                                                        //
+// 1. Grant of License                                                                                                                                                                                                                                   //
+// This license permits anyone to use, modify, and distribute the provided code (the "Code") in projects free of charge under the following conditions:                                                                                                 //
+// 1.1. The Code must only be used for lawful purposes.                                                                                                                                                                                                //
+// 1.2. The user must include proper credit in their project as described in Section 3 below.                                                                                                                                                         //
+//                                                                                                                                                                                                                                                   //
+// 2. Restrictions                                                                                                                                                                                                                                  //
+// 2.1. This Code cannot be sold, sublicensed, or redistributed as a standalone product or as part of a similar development toolkit.                                                                                                               //
+// 2.2. The Code must not be used for projects that violate local laws or promote harmful, discriminatory, or illegal activities.                                                                                                                 //
+// 2.3. The user must not remove, alter, or obscure this license agreement, attribution requirements, or copyright notices within the Code.                                                                                                      //
+//                                                                                                                                                                                                                                              //
+// 3. Attribution                                                                                                                                                                                                                              //
+// 3.1. The user must include the following credit in a visible location within their project (e.g., splash screen, credits screen, or documentation):                                                                                        //
+// "Steam Multiplayer Code developed by Adrian Szajewski. Used under license."                                                                                                                                                               //
+// 3.2. For distributed or published projects, a link to https://adrianszajewskidev.wordpress.com/ or other contact details must also be included if applicable.                                                                            //
+//                                                                                                                                                                                                                                         //
+// 4. Breach of Agreement                                                                                                                                                                                                                 //
+// 4.1. If this license is violated, the licensor reserves the right to revoke the user's rights to use the Code immediately.                                                                                                            //
+// 4.2. The licensor may take legal action to recover damages or enforce compliance, depending on the severity of the violation.                                                                                                        //
+// 4.3. Users found in breach of this license may be required to:                                                                                                                                                                      //
+// Remove the Code from their project(s).                                                                                                                                                                                             //
+// Cease distribution of any projects using the Code.                                                                                                                                                                                //
+//                                                                                                                                                                                                                                  //
+// 5. Disclaimer                                                                                                                                                                                                                   //
+// 5.1. The Code is provided "as is" without any warranty, express or implied. The licensor is not liable for any damages arising from the use or misuse of the Code.                                                             //
+// 5.2. It is the user's responsibility to ensure compatibility and safe usage of the Code in their projects.                                                                                                                    //
+//                                                                                                                                                                                                                              //
+// 6. Governing Law                                                                                                                                                                                                            //
+// This agreement shall be governed and construed in accordance with the laws of Poland. Any disputes arising under or in connection with this license will be subject to the exclusive jurisdiction of the courts of Poland. //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+/////////////////////////////////////////////////////////
+// INCLUDE //
+////////////
+#include "CoreMinimal.h"
+#include "Math/RandomStream.h"
+#include "SteamBackend.h"
+#include "FakeSteamBackend.generated.h"
+
+///////////////////////////////////////
+// FAKE STEAM - SIMULATION SETTINGS //
+///////////////////////////////////////
+USTRUCT(BlueprintType)
+struct FFakeSteamConfig
+{
+    GENERATED_BODY()
+
+    // Same seed + same tick deltas = same lobbies, latencies and failures
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fake Steam")
+    int32 Seed = 1337;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fake Steam")
+    int32 NumLobbies = 1000;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fake Steam")
+    int32 MaxMembersPerLobby = 4;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fake Steam")
+    FString GameKey = TEXT("urbanshadows");
+
+    // Callback latency is picked uniformly in [Min, Max]
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fake Steam")
+    float MinLatencyMs = 20.f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fake Steam")
+    float MaxLatencyMs = 120.f;
+
+    // Chance [0..1] that CreateLobby / JoinLobby / RequestLobbyList fails
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fake Steam")
+    float FailureRate = 0.f;
+
+    // Hosts of the first NumFriends lobbies are the local user's friends. Every third is offline,
+    // of the rest every other one publishes its lobby through rich presence
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fake Steam")
+    int32 NumFriends = 100;
+
+    // Every leaderboard exists on first find and starts with this many scores, friends included
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fake Steam")
+    int32 NumLeaderboardEntries = 1000;
+};
+////////////////////////////////////////////////
+// IN-PROCESS STEAM SIMULATOR (NO CLIENT)     //
+////////////////////////////////////////////////
+// Runs on a simulated clock advanced by Tick, so CI runs are reproducible.
+class URBANSHADOWS_API FFakeSteamBackend : public ISteamBackend
+{
+public:
+    explicit FFakeSteamBackend(const FFakeSteamConfig& InConfig);
+
+    //////////////////////////////////////////////
+    // 1. Lifecycle                            //
+    ////////////////////////////////////////////
+    virtual bool Init() override;
+    virtual void Shutdown() override;
+    virtual bool IsRunning() const override { return bRunning; }
+    virtual bool IsFake() const override { return true; }
+    virtual void Tick(float DeltaTime) override;
+
+    int32 GetNumLobbies() const { return Lobbies.Num(); }
+    int32 GetNumPendingCallbacks() const { return PendingCallbacks.Num(); }
+    double GetSimulatedTime() const { return Now; }
+
+    // Adds a lobby with a fixed member count right away (no callback), for harnesses
+    CSteamID AddSimulatedLobby(int32 NumMembers, int32 MaxMembers);
+
+    // Member churn as other clients cause it, each lands later as LobbyChatUpdate_t / LobbyDataUpdate_t
+    CSteamID AddSimulatedMember(CSteamID LobbyID);
+    void RemoveSimulatedMember(CSteamID LobbyID, CSteamID MemberID);
+    void SetSimulatedMemberData(CSteamID LobbyID, CSteamID MemberID, const char* Key, const char* Value);
+    void SendSimulatedChatMsg(CSteamID LobbyID, CSteamID MemberID, const void* Data, int32 Size);
+    // Lobby data written by whoever owns the lobby now, ownership is not checked
+    void SetSimulatedLobbyData(CSteamID LobbyID, const char* Key, const char* Value);
+
+    // A friend's rich presence changing, lands later as FriendRichPresenceUpdate_t
+    void SetSimulatedRichPresence(CSteamID UserID, const char* Key, const char* Value);
+
+    // What reached "Steam" so far, to compare batched and per-event writes
+    int32 GetNumStatWrites() const { return NumStatWrites; }
+    int32 GetNumStatsStores() const { return NumStatsStores; }
+    int32 GetNumLeaderboardUploads() const { return NumLeaderboardUploads; }
+
+    //////////////////////////////////////////////
+    // 2. ISteamBackend                        //
+    ////////////////////////////////////////////
+    virtual CSteamID GetLocalSteamID() override { return LocalUser; }
+    virtual const char* GetPersonaName() override { return GetFriendPersonaName(LocalUser); }
+
+    virtual SteamAPICall_t CreateLobby(ELobbyType LobbyType, int32 MaxMembers) override;
+    virtual SteamAPICall_t JoinLobby(CSteamID LobbyID) override;
+    virtual void LeaveLobby(CSteamID LobbyID) override;
+    virtual SteamAPICall_t RequestLobbyList() override;
+    virtual void AddRequestLobbyListStringFilter(const char* Key, const char* Value, ELobbyComparison Comparison) override;
+    virtual void AddRequestLobbyListNumericalFilter(const char* Key, int32 Value, ELobbyComparison Comparison) override;
+    virtual void AddRequestLobbyListNearValueFilter(const char* Key, int32 Value) override;
+    virtual void AddRequestLobbyListFilterSlotsAvailable(int32 SlotsAvailable) override;
+    virtual void AddRequestLobbyListDistanceFilter(ELobbyDistanceFilter Distance) override {} // Single simulated region
+    virtual void AddRequestLobbyListResultCountFilter(int32 MaxResults) override;
+    virtual CSteamID GetLobbyByIndex(int32 Index) override;
+    virtual int32 GetNumLobbyMembers(CSteamID LobbyID) override;
+    virtual CSteamID GetLobbyMemberByIndex(CSteamID LobbyID, int32 Index) override;
+    virtual int32 GetLobbyMemberLimit(CSteamID LobbyID) override;
+    virtual CSteamID GetLobbyOwner(CSteamID LobbyID) override;
+    virtual bool SetLobbyOwner(CSteamID LobbyID, CSteamID NewOwner) override;
+    virtual const char* GetLobbyData(CSteamID LobbyID, const char* Key) override;
+    virtual bool SetLobbyData(CSteamID LobbyID, const char* Key, const char* Value) override;
+    virtual const char* GetLobbyMemberData(CSteamID LobbyID, CSteamID UserID, const char* Key) override;
+    virtual void SetLobbyMemberData(CSteamID LobbyID, const char* Key, const char* Value) override;
+    virtual bool SendLobbyChatMsg(CSteamID LobbyID, const void* Data, int32 Size) override;
+    virtual int32 GetLobbyChatEntry(CSteamID LobbyID, int32 ChatID, CSteamID* OutUser, void* OutBuffer, int32 BufferSize, EChatEntryType* OutType) override;
+
+    virtual const char* GetFriendPersonaName(CSteamID SteamID) override;
+    virtual int GetLargeFriendAvatar(CSteamID SteamID) override;
+    virtual int32 GetFriendCount() override { return Friends.Num(); }
+    virtual CSteamID GetFriendByIndex(int32 Index) override { return Friends.IsValidIndex(Index) ? Friends[Index] : k_steamIDNil; }
+    virtual bool IsFriend(CSteamID SteamID) override { return Friends.Contains(SteamID); }
+    virtual EPersonaState GetFriendPersonaState(CSteamID SteamID) override { return OnlineUsers.Contains(SteamID.ConvertToUint64()) ? k_EPersonaStateOnline : k_EPersonaStateOffline; }
+    virtual const char* GetFriendRichPresence(CSteamID SteamID, const char* Key) override;
+    virtual bool SetRichPresence(const char* Key, const char* Value) override;
+
+    virtual bool GetImageSize(int Image, uint32* OutWidth, uint32* OutHeight) override;
+    virtual bool GetImageRGBA(int Image, uint8* OutBuffer, int BufferSize) override;
+
+    // Locations are points on a plane, the estimate is their distance in ms
+    virtual void InitRelayNetworkAccess() override {}
+    virtual float GetLocalPingLocation(SteamNetworkPingLocation_t& OutLocation) override;
+    virtual int32 EstimatePingTimeBetweenTwoLocations(const SteamNetworkPingLocation_t& A, const SteamNetworkPingLocation_t& B) override;
+    virtual void ConvertPingLocationToString(const SteamNetworkPingLocation_t& Location, char* OutBuffer, int32 BufferSize) override;
+    virtual bool ParsePingLocationString(const char* String, SteamNetworkPingLocation_t& OutLocation) override;
+
+    // No schema, any name is a stat or achievement. Values live as long as the backend
+    virtual bool RequestCurrentStats() override;
+    virtual bool GetStatInt(const char* Name, int32* OutValue) override;
+    virtual bool GetStatFloat(const char* Name, float* OutValue) override;
+    virtual bool SetStatInt(const char* Name, int32 Value) override;
+    virtual bool SetStatFloat(const char* Name, float Value) override;
+    virtual bool GetAchievement(const char* Name, bool* OutAchieved) override;
+    virtual bool SetAchievement(const char* Name) override;
+    virtual bool StoreStats() override;
+    virtual SteamAPICall_t FindLeaderboard(const char* Name) override;
+    virtual SteamAPICall_t UploadLeaderboardScore(SteamLeaderboard_t Leaderboard, ELeaderboardUploadScoreMethod Method, int32 Score) override;
+    virtual SteamAPICall_t DownloadLeaderboardEntries(SteamLeaderboard_t Leaderboard, ELeaderboardDataRequest Request, int32 RangeStart, int32 RangeEnd) override;
+    virtual bool GetDownloadedLeaderboardEntry(SteamLeaderboardEntries_t Entries, int32 Index, LeaderboardEntry_t* OutEntry) override;
+
+private:
+    //////////////////////////////////////////////
+    // 1. Simulated State                      //
+    ////////////////////////////////////////////
+    struct FFakeChatEntry
+    {
+        int32 ChatID = INDEX_NONE;
+        CSteamID User;
+        TArray<uint8> Data; // Capacity kept when the entry is reused
+    };
+
+    struct FFakeLobby
+    {
+        CSteamID LobbyID;
+        CSteamID Owner;
+        int32 MaxMembers = 0;
+        TArray<CSteamID> Members;
+        TMap<FName, TArray<ANSICHAR>> Data; // Values NUL terminated, pointers stay valid until the key is rewritten
+        TMap<uint64, TMap<FName, TArray<ANSICHAR>>> MemberData; // Same storage per member SteamID
+        TArray<FFakeChatEntry> ChatLog; // Ring of the latest entries, older chat IDs read as gone
+        int32 NextChatID = 0;
+    };
+
+    struct FPendingCallback
+    {
+        double DueTime = 0.0;
+        uint64 Sequence = 0;
+        int32 CallbackId = 0;
+        SteamAPICall_t APICall = k_uAPICallInvalid; // Call result handle, the callback also goes out as a broadcast
+        TArray<uint8> Payload;
+        TFunction<void(void*)> Apply; // State change applied when the callback lands, may patch the payload
+    };
+
+    struct FFakeLeaderboard
+    {
+        FName Name;
+        TArray<LeaderboardEntry_t> Entries; // Best score first, m_nGlobalRank kept in step
+    };
+
+    struct FLobbyListFilter
+    {
+        FName Key;
+        TArray<ANSICHAR> StringValue;
+        int32 NumericValue = 0;
+        ELobbyComparison Comparison = k_ELobbyComparisonEqual;
+        bool bNumeric = false;
+    };
+
+    FFakeSteamConfig Config;
+    FRandomStream Random;
+    bool bRunning;
+    double Now;
+    uint64 NextSequence;
+    SteamAPICall_t NextAPICall;
+    uint32 NextAccountID;
+    CSteamID LocalUser;
+    FVector2f LocalPingPoint;
+
+    TArray<FFakeLobby> Lobbies;
+    TMap<uint64, int32> LobbyLookup;          // Lobby SteamID -> index in Lobbies
+    TMap<uint64, TArray<ANSICHAR>> UserNames; // User SteamID -> persona name
+    TArray<CSteamID> Friends;                 // Fixed after Init, so the friends list is safe off the game thread
+    TSet<uint64> OnlineUsers;
+    TMap<uint64, TMap<FName, TArray<ANSICHAR>>> RichPresence; // User SteamID -> key -> value
+    TArray<FPendingCallback> PendingCallbacks; // Min-heap on (DueTime, Sequence)
+
+    bool bStatsReceived;
+    TMap<FName, int32> IntStats;
+    TMap<FName, float> FloatStats;
+    TSet<FName> Achievements;
+    int32 NumStatWrites;
+    int32 NumStatsStores;
+    int32 NumLeaderboardUploads;
+
+    TArray<FFakeLeaderboard> Leaderboards; // Handle = index + 1
+    TMap<SteamLeaderboardEntries_t, TArray<LeaderboardEntry_t>> Downloads; // Dropped once their callback was dispatched
+    SteamLeaderboardEntries_t NextDownloadHandle;
+
+    struct FLobbyListRequest
+    {
+        TArray<FLobbyListFilter> Filters;
+        TOptional<TPair<FName, int32>> NearValue;
+        int32 SlotsAvailable = 0;
+        int32 ResultCount = 50;
+    };
+
+    FLobbyListRequest PendingListRequest; // Filters collected for the next RequestLobbyList
+    TArray<CSteamID> LastLobbyList;       // What GetLobbyByIndex reads
+
+    //////////////////////////////////////////////
+    // 2. Helpers                              //
+    ////////////////////////////////////////////
+    CSteamID MakeUser(const FString& Name);
+    CSteamID MakeLobbyID();
+    FFakeLobby* FindLobby(CSteamID LobbyID);
+    bool RollFailure();
+    bool PassesFilters(const FFakeLobby& Lobby, const FLobbyListRequest& Request) const;
+    int32 GetLobbyNumber(const FFakeLobby& Lobby, FName Key) const;
+    FFakeLeaderboard* GetLeaderboard(SteamLeaderboard_t Handle);
+    SteamLeaderboard_t FindOrAddLeaderboard(FName Name);
+    static void RankLeaderboard(FFakeLeaderboard& Board);
+    void PostChatMsg(CSteamID LobbyID, CSteamID UserID, const void* Data, int32 Size);
+
+    // DelaySeconds < 0 picks a random latency from the config
+    template<typename CallbackType>
+    SteamAPICall_t Post(const CallbackType& Payload, TFunction<void(void*)> Apply = nullptr, double DelaySeconds = -1.0);
+};
+///////////////////////////////////////////
+// MORE COMING SOON  // A.S. - hajddeen //
+/////////////////////////////////////////
@@ -0,0 +1,144 @@
+// |------------------------------------|
+// |  !FOLLOW URBAN SHADOWS ON SOCIALS! |
+// |------------------------------------|
+//            \ (^ᴗ^) /
+//             \     /
+//              -----
+//              |   |
+//              |   |
+//              |_  |_
+////////////////////////////////////////////////////////////
+// STEAM P2P SESSIONS - Unreal 5.5 + Steamworks SDK 1.57 //
+//////////////////////////////////////////////////////////////////
+// LICENSE AGREEMENT // LICENSE AGREEMENT // LICENSE AGREEMENT //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                                                                                                                                                                                                                                          //
+// Last Updated: 03/12/2024                                                                                                                                                                                                                                //
+//                                                                                                                                                                                                                                                        //
+// 1. Grant of License                                                                                                                                                                                                                                   //
+// This license permits anyone to use, modify, and distribute the provided code (the "Code") in projects free of charge under the following conditions:                                                                                                 //
+// 1.1. The Code must only be used for lawful purposes.                                                                                                                                                                                                //
+// 1.2. The user must include proper credit in their project as described in Section 3 below.                                                                                                                                                         //
+//                                                                                                                                                                                                                                                   //
+// 2. Restrictions                                                                                                                                                                                                                                  //
+// 2.1. This Code cannot be sold, sublicensed, or redistributed as a standalone product or as part of a similar development toolkit.                                                                                                               //
+// 2.2. The Code must not be used for projects that violate local laws or promote harmful, discriminatory, or illegal activities.                                                                                                                 //
+// 2.3. The user must not remove, alter, or obscure this license agreement, attribution requirements, or copyright notices within the Code.                                                                                                      //
+//                                                                                                                                                                                                                                              //
+// 3. Attribution                                                                                                                                                                                                                              //
+// 3.1. The user must include the following credit in a visible location within their project (e.g., splash screen, credits screen, or documentation):                                                                                        //
+// "Steam Multiplayer Code developed by Adrian Szajewski. Used under license."                                                                                                                                                               //
+// 3.2. For distributed or published projects, a link to https://adrianszajewskidev.wordpress.com/ or other contact details must also be included if applicable.                                                                            //
+//                                                                                                                                                                                                                                         //
+// 4. Breach of Agreement                                                                                                                                                                                                                 //
+// 4.1. If this license is violated, the licensor reserves the right to revoke the user's rights to use the Code immediately.                                                                                                            //
+// 4.2. The licensor may take legal action to recover damages or enforce compliance, depending on the severity of the violation.                                                                                                        //
+// 4.3. Users found in breach of this license may be required to:                                                                                                                                                                      //
+// Remove the Code from their project(s).                                                                                                                                                                                             //
+// Cease distribution of any projects using the Code.                                                                                                                                                                                //
+//                                                                                                                                                                                                                                  //
+// 5. Disclaimer                                                                                                                                                                                                                   //
+// 5.1. The Code is provided "as is" without any warranty, express or implied. The licensor is not liable for any damages arising from the use or misuse of the Code.                                                             //
+// 5.2. It is the user's responsibility to ensure compatibility and safe usage of the Code in their projects.                                                                                                                    //
+//                                                                                                                                                                                                                              //
+// 6. Governing Law                                                                                                                                                                                                            //
+// This agreement shall be governed and construed in accordance with the laws of Poland. Any disputes arising under or in connection with this license will be subject to the exclusive jurisdiction of the courts of Poland. //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////
+// INCLUDE //
+////////////
+#include "SteamMultiplayer.h"
+#include "FakeSteamBackend.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+/////////////////////////////////////
+// Fake Backend Tests - Internals //
+///////////////////////////////////////////////////////////////////////////
+// 1. No Steam client, no world: the fake is pumped right here           //
+// 2. Simulated steps are 1ms, same clock the benchmark commandlet uses //
+/////////////////////////////////////////////////////////////////////////
+namespace FakeSteamBackendTests
+{
+    constexpr float SimStepSeconds = 0.001f;
+    constexpr int32 MaxSimSteps = 60 * 1000; // One simulated minute per wait
+
+    // Pumps the fake until nothing is queued, false if it never drained
+    bool Drain(FFakeSteamBackend& Fake)
+    {
+        for (int32 Step = 0; Step < MaxSimSteps; ++Step)
+        {
+            if (Fake.GetNumPendingCallbacks() == 0)
+            {
+                return true;
+            }
+            Fake.Tick(SimStepSeconds);
+        }
+        return Fake.GetNumPendingCallbacks() == 0;
+    }
+}
+/////////////////////////
+// 1. Matchmaking     //
+////////////////////////////////////////
+// 1.1 - Host, list and join a lobby //
+//////////////////////////////////////
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFakeSteamBackendHostListJoinTest, "UrbanShadows.Steam.FakeBackend.HostListJoin", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+// - 1.1 - //
+bool FFakeSteamBackendHostListJoinTest::RunTest(const FString& Parameters)
+{
+    // A bare game instance has no world, hosting and joining log that they cannot travel
+    AddExpectedError(TEXT("World is not valid|does not exist"), EAutomationExpectedErrorFlags::Contains, 0);
+
+    USteamMultiplayer* Instance = NewObject<USteamMultiplayer>(GetTransientPackage());
+    Instance->AddToRoot();
+    Instance->bUseFakeSteamBackend = true;
+    Instance->FakeSteamConfig.NumLobbies = 10;
+    Instance->FakeSteamConfig.FailureRate = 0.f;
+    Instance->FakeSteamConfig.NumFriends = 0;
+    Instance->InitializeSteam();
+
+    ISteamBackend* Backend = Instance->GetSteamBackend();
+    FFakeSteamBackend* Fake = Backend && Backend->IsFake() ? static_cast<FFakeSteamBackend*>(Backend) : nullptr;
+    if (TestNotNull(TEXT("Fake backend"), Fake) && TestTrue(TEXT("Steam initialized"), Instance->IsSteamInitialized()))
+    {
+        // Host
+        Instance->HostGameWithSteamMatchmaking();
+        TestTrue(TEXT("Host drained"), FakeSteamBackendTests::Drain(*Fake));
+        const FSteamLobbyId HostedLobby = Instance->GetCurrentLobbyId();
+        TestTrue(TEXT("Hosting sets CurrentLobbyId"), HostedLobby.IsValid());
+
+        // List, one page so the paging ticker is never needed
+        FLobbySearchQuery Query;
+        Query.MinOpenSlots = 1;
+        Query.PageSize = Query.MaxResults;
+        Instance->FindLobbies(Query);
+        TestTrue(TEXT("List drained"), FakeSteamBackendTests::Drain(*Fake));
+        TestTrue(TEXT("Hosted lobby is listed"), Instance->FoundLobbies.ContainsByPredicate([HostedLobby](const FLobbyInfoData& Lobby)
+        {
+            return Lobby.LobbyId == HostedLobby;
+        }));
+
+        // Join one of the simulated lobbies
+        const FLobbyInfoData* Target = Instance->FoundLobbies.FindByPredicate([HostedLobby](const FLobbyInfoData& Lobby)
+        {
+            return Lobby.LobbyId != HostedLobby;
+        });
+        if (TestNotNull(TEXT("Another lobby is listed"), Target))
+        {
+            const FSteamLobbyId TargetLobby = Target->LobbyId;
+            Instance->JoinLobby(TargetLobby);
+            TestTrue(TEXT("Join drained"), FakeSteamBackendTests::Drain(*Fake));
+            TestTrue(TEXT("Joining sets CurrentLobbyId"), Instance->GetCurrentLobbyId() == TargetLobby);
+        }
+    }
+
+    Instance->StopLobbySearchPaging();
+    Instance->ShutdownSteam();
+    Instance->RemoveFromRoot();
+    Instance->MarkAsGarbage();
+    return true;
+}
+#endif // WITH_DEV_AUTOMATION_TESTS
+///////////////////////////////////////////
+// MORE COMING SOON  // A.S. - hajddeen //
+/////////////////////////////////////////
@@ -0,0 +1,155 @@
+// |------------------------------------|
+// |  !FOLLOW URBAN SHADOWS ON SOCIALS! |
+// |------------------------------------|
+//            \ (^ᴗ^) /
+//             \     /
+//              -----
+//              |   |
+//              |   |
+//              |_  |_
+////////////////////////////////////////////////////////////
+// STEAM P2P SESSIONS - Unreal 5.5 + Steamworks SDK 1.57 //
+//////////////////////////////////////////////////////////////////
+// LICENSE AGREEMENT // LICENSE AGREEMENT // LICENSE AGREEMENT //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                                                                                                                                                                                                                                          //
+// Last Updated: 03/12/2024                                                                                                                                                                                                                                //
+//                                                                                                                                                                                                                                                        //
+// 1. Grant of License                                                                                                                                                                                                                                   //
+// This license permits anyone to use, modify, and distribute the provided code (the "Code") in projects free of charge under the following conditions:                                                                                                 //
+// 1.1. The Code must only be used for lawful purposes.                                                                                                                                                                                                //
+// 1.2. The user must include proper credit in their project as described in Section 3 below.                                                                                                                                                         //
+//                                                                                                                                                                                                                                                   //
+// 2. Restrictions                                                                                                                                                                                                                                  //
+// 2.1. This Code cannot be sold, sublicensed, or redistributed as a standalone product or as part of a similar development toolkit.                                                                                                               //
+// 2.2. The Code must not be used for projects that violate local laws or promote harmful, discriminatory, or illegal activities.                                                                                                                 //
+// 2.3. The user must not remove, alter, or obscure this license agreement, attribution requirements, or copyright notices within the Code.                                                                                                      //
+//                                                                                                                                                                                                                                              //
+// 3. Attribution                                                                                                                                                                                                                              //
+// 3.1. The user must include the following credit in a visible location within their project (e.g., splash screen, credits screen, or documentation):                                                                                        //
+// "Steam Multiplayer Code developed by Adrian Szajewski. Used under license."                                                                                                                                                               //
+// 3.2. For distributed or published projects, a link to https://adrianszajewskidev.wordpress.com/ or other contact details must also be included if applicable.                                                                            //
+//                                                                                                                                                                                                                                         //
+// 4. Breach of Agreement                                                                                                                                                                                                                 //
+// 4.1. If this license is violated, the licensor reserves the right to revoke the user's rights to use the Code immediately.                                                                                                            //
+// 4.2. The licensor may take legal action to recover damages or enforce compliance, depending on the severity of the violation.                                                                                                        //
+// 4.3. Users found in breach of this license may be required to:                                                                                                                                                                      //
+// Remove the Code from their project(s).                                                                                                                                                                                             //
+// Cease distribution of any projects using the Code.                                                                                                                                                                                //
+//                                                                                                                                                                                                                                  //
+// 5. Disclaimer                                                                                                                                                                                                                   //
+// 5.1. The Code is provided "as is" without any warranty, express or implied. The licensor is not liable for any damages arising from the use or misuse of the Code.                                                             //
+// 5.2. It is the user's responsibility to ensure compatibility and safe usage of the Code in their projects.                                                                                                                    //
+//                                                                                                                                                                                                                              //
+// 6. Governing Law                                                                                                                                                                                                            //
+// This agreement shall be governed and construed in accordance with the laws of Poland. Any disputes arising under or in connection with this license will be subject to the exclusive jurisdiction of the courts of Poland. //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////
+// INCLUDE //
+////////////
+#include "SteamAsync.h"
+//////////////////////////
+// Constructor - Notes //
+////////////////////////////////////////////////////////
+// 1. Anything still pending is cancelled on destroy. //
+//////////////////////////////////////////////////////
+FSteamAsyncCalls::FSteamAsyncCalls(ISteamBackend& InBackend)
+    : Backend(InBackend)
+{
+}
+
+FSteamAsyncCalls::~FSteamAsyncCalls()
+{
+    CancelAll();
+}
+/////////////////////////
+// 1. Async Calls     //
+////////////////////////////////////////
+// 1.1 - Cancel one call             //
+// 1.2 - Cancel everything          //
+// 1.3 - Result landed             //
+// 1.4 - Stop waiting             //
+///////////////////////////////////
+// - 1.1 - //
+bool FSteamAsyncCalls::Cancel(SteamAPICall_t Call)
+{
+    if (!PendingCalls.Contains(Call))
+    {
+        return false;
+    }
+    else
+    {
+        GiveUp(Call, ESteamAsyncStatus::Cancelled);
+        return true;
+    }
+}
+// - 1.2 - //
+void FSteamAsyncCalls::CancelAll()
+{
+    // Nothing may call back into us after this, late watchers included
+    for (SteamAPICall_t Call : LateCalls)
+    {
+        Backend.CancelCallResult(Call);
+    }
+    LateCalls.Reset();
+
+    TArray<SteamAPICall_t> Calls;
+    PendingCalls.GetKeys(Calls);
+    for (SteamAPICall_t Call : Calls)
+    {
+        // A continuation may have started and cancelled more calls meanwhile
+        if (PendingCalls.Contains(Call))
+        {
+            PendingCalls[Call].bWatchLate = false;
+            GiveUp(Call, ESteamAsyncStatus::Cancelled);
+        }
+    }
+}
+// - 1.3 - //
+bool FSteamAsyncCalls::Finish(SteamAPICall_t Call)
+{
+    FPendingCall Pending;
+    if (!PendingCalls.RemoveAndCopyValue(Call, Pending))
+    {
+        return false;
+    }
+    else
+    {
+        if (Pending.TimeoutHandle.IsValid())
+        {
+            FTSTicker::GetCoreTicker().RemoveTicker(Pending.TimeoutHandle);
+        }
+        return true;
+    }
+}
+// - 1.4 - //
+void FSteamAsyncCalls::GiveUp(SteamAPICall_t Call, ESteamAsyncStatus Status)
+{
+    FPendingCall Pending;
+    if (!PendingCalls.RemoveAndCopyValue(Call, Pending))
+    {
+        return;
+    }
+    else
+    {
+        if (Pending.TimeoutHandle.IsValid())
+        {
+            FTSTicker::GetCoreTicker().RemoveTicker(Pending.TimeoutHandle);
+        }
+
+        if (Pending.bWatchLate)
+        {
+            LateCalls.Add(Call);
+        }
+        else
+        {
+            Backend.CancelCallResult(Call);
+        }
+
+        // Last, the continuation may start new calls
+        Pending.Abandon(Status);
+    }
+}
+///////////////////////////////////////////
+// MORE COMING SOON  // A.S. - hajddeen //
+/////////////////////////////////////////
@@ -0,0 +1,200 @@
+// |------------------------------------|
+// |  !FOLLOW URBAN SHADOWS ON SOCIALS! |
+// |------------------------------------|
+//            \ (^ᴗ^) /
+//             \     /
+//              -----
+//              |   |
+//              |   |
+//              |_  |_ 
+////////////////////////////////////////////////////////////
+// STEAM P2P SESSIONS - Unreal 5.5 + Steamworks SDK 1.57 //
+//////////////////////////////////////////////////////////////////
+// LICENSE AGREEMENT // LICENSE AGREEMENT // LICENSE AGREEMENT //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                                                                                                                                                                                                                                          //
+// Last Updated: 03/12/2024                                                                                                                                                                                                                                //
+//                                                                                                                                                                                                                                                        //
+// 1. Grant of License                                                                                                                                                                                                                                   //
+// This license permits anyone to use, modify, and distribute the provided code (the "Code") in projects free of charge under the following conditions:                                                                                                 //
+// 1.1. The Code must only be used for lawful purposes.                                                                                                                                                                                                //
+// 1.2. The user must include proper credit in their project as described in Section 3 below.                                                                                                                                                         //
+//                                                                                                                                                                                                                                                   //
+// 2. Restrictions                                                                                                                                                                                                                                  //
+// 2.1. This Code cannot be sold, sublicensed, or redistributed as a standalone product or as part of a similar development toolkit.                                                                                                               //
+// 2.2. The Code must not be used for projects that violate local laws or promote harmful, discriminatory, or illegal activities.                                                                                                                 //
+// 2.3. The user must not remove, alter, or obscure this license agreement, attribution requirements, or copyright notices within the Code.                                                                                                      //
+//                                                                                                                                                                                                                                              //
+// 3. Attribution                                                                                                                                                                                                                              //
+// 3.1. The user must include the following credit in a visible location within their project (e.g., splash screen, credits screen, or documentation):                                                                                        //
+// "Steam Multiplayer Code developed by Adrian Szajewski. Used under license."                                                                                                                                                               //
+// 3.2. For distributed or published projects, a link to https://adrianszajewskidev.wordpress.com/ or other contact details must also be included if applicable.                                                                            //
+//                                                                                                                                                                                                                                         //
+// 4. Breach of Agreement                                                                                                                                                                                                                 //
+// 4.1. If this license is violated, the licensor reserves the right to revoke the user's rights to use the Code immediately.                                                                                                            //
+// 4.2. The licensor may take legal action to recover damages or enforce compliance, depending on the severity of the violation.                                                                                                        //
+// 4.3. Users found in breach of this license may be required to:                                                                                                                                                                      //
+// Remove the Code from their project(s).                                                                                                                                                                                             //
+// Cease distribution of any projects using the Code.                                                                                                                                                                                //
+//                                                                                                                                                                                                                                  //
+// 5. Disclaimer                                                                                                                                                                                                                   //
+// 5.1. The Code is provided "as is" without any warranty, express or implied. The licensor is not liable for any damages arising from the use or misuse of the Code.                                                             //
+// 5.2. It is the user's responsibility to ensure compatibility and safe usage of the Code in their projects.                                                                                                                    //
+//                                                                                                                                                                                                                              //
+// 6. Governing Law                                                                                                                                                                                                            //
+// This agreement shall be governed and construed in accordance with the laws of Poland. Any disputes arising under or in connection with this license will be subject to the exclusive jurisdiction of the courts of Poland. //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+/////////////////////////////////////////////////////////
+// INCLUDE //
+////////////
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Containers/Ticker.h"
+#include "Templates/Identity.h"
+#include "SteamBackend.h"
+#include "SteamAsync.generated.h"
+
+/////////////////////////////////////////////////////////////////////////////////////
+// STEAM ASYNC CALLS - NOTES                                                       //
+/////////////////////////////////////////////////////////////////////////////////////
+// 1. Every request waits on its own SteamAPICall_t, so any number of them can    //
+//    be in flight and a late answer never lands on somebody else's request.     //
+// 2. Futures resolve on the game thread, Next/Then continuations run right     //
+//    there, while Steam state still matches the result.                       //
+// 3. Timeouts and Cancel only stop waiting, Steam still finishes the call.    //
+//    OnLateResult sees answers that arrive after that (e.g. to leave a lobby //
+//    nobody is waiting for any more).                                       //
+//////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////
+// HOW AN ASYNC STEAM REQUEST ENDED   //
+////////////////////////////////////////
+UENUM(BlueprintType)
+enum class ESteamAsyncStatus : uint8
+{
+    Completed, // Steam answered with a success
+    Failed,    // Steam answered with an error (see SteamResult) or refused the request
+    IOFailure, // Steam could not deliver the answer
+    TimedOut,
+    Cancelled
+};
+////////////////////////////////////////
+// RESULT CARRIED BY THE FUTURE       //
+////////////////////////////////////////
+template<typename ValueType>
+struct TSteamAsyncResult
+{
+    ESteamAsyncStatus Status = ESteamAsyncStatus::Failed;
+    int32 SteamResult = 0; // EResult / EChatRoomEnterResponse as Steam sent it, 0 when it never answered
+    ValueType Value = ValueType();
+
+    TSteamAsyncResult() {}
+    explicit TSteamAsyncResult(ESteamAsyncStatus InStatus) : Status(InStatus) {}
+
+    bool IsSuccess() const { return Status == ESteamAsyncStatus::Completed; }
+};
+////////////////////////////////////////////////
+// CALL RESULT -> TFUTURE, WITH TIMEOUTS      //
+////////////////////////////////////////////////
+// Game thread only. Destroy it before the backend it watches.
+class URBANSHADOWS_API FSteamAsyncCalls
+{
+public:
+    explicit FSteamAsyncCalls(ISteamBackend& InBackend);
+    ~FSteamAsyncCalls();
+
+    // Read turns the raw result into the future's value as soon as it lands, false marks a Steam-side failure.
+    // Without Read the raw result itself is the value. PreparedType must match the router preparer for ResultType.
+    template<typename ResultType, typename ValueType = ResultType, typename PreparedType = void>
+    TFuture<TSteamAsyncResult<ValueType>> Watch(SteamAPICall_t Call, float TimeoutSeconds,
+        TIdentity_T<TFunction<bool(const ResultType&, const PreparedType*, TSteamAsyncResult<ValueType>&)>> Read = nullptr,
+        TFunction<void(const ResultType&)> OnLateResult = nullptr);
+
+    // Resolves the future as Cancelled, false when the call was not pending
+    bool Cancel(SteamAPICall_t Call);
+    void CancelAll();
+
+    bool IsPending(SteamAPICall_t Call) const { return PendingCalls.Contains(Call); }
+    int32 GetNumPending() const { return PendingCalls.Num(); }
+
+private:
+    struct FPendingCall
+    {
+        TFunction<void(ESteamAsyncStatus)> Abandon; // Resolves the promise without a result
+        FTSTicker::FDelegateHandle TimeoutHandle;
+        bool bWatchLate = false;                    // Keep listening after giving up, for OnLateResult
+    };
+
+    ISteamBackend& Backend;
+    TMap<SteamAPICall_t, FPendingCall> PendingCalls;
+    TSet<SteamAPICall_t> LateCalls; // Given up on, still bound for OnLateResult
+
+    bool Finish(SteamAPICall_t Call);
+    void GiveUp(SteamAPICall_t Call, ESteamAsyncStatus Status);
+};
+// - Watch - //
+template<typename ResultType, typename ValueType, typename PreparedType>
+TFuture<TSteamAsyncResult<ValueType>> FSteamAsyncCalls::Watch(SteamAPICall_t Call, float TimeoutSeconds,
+    TIdentity_T<TFunction<bool(const ResultType&, const PreparedType*, TSteamAsyncResult<ValueType>&)>> Read,
+    TFunction<void(const ResultType&)> OnLateResult)
+{
+    using FResult = TSteamAsyncResult<ValueType>;
+    TSharedRef<TPromise<FResult>, ESPMode::ThreadSafe> Promise = MakeShared<TPromise<FResult>, ESPMode::ThreadSafe>();
+    TFuture<FResult> Future = Promise->GetFuture();
+
+    if (Call == k_uAPICallInvalid)
+    {
+        // Steam refused the request outright (offline, bad arguments)
+        Promise->SetValue(FResult(ESteamAsyncStatus::Failed));
+        return Future;
+    }
+
+    FPendingCall& Pending = PendingCalls.Add(Call);
+    Pending.Abandon = [Promise](ESteamAsyncStatus Status) { Promise->SetValue(FResult(Status)); };
+    Pending.bWatchLate = (bool)OnLateResult;
+    if (TimeoutSeconds > 0.f)
+    {
+        Pending.TimeoutHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([this, Call](float DeltaTime)
+        {
+            // Returning false removes this ticker, GiveUp must not remove it again
+            if (FPendingCall* Timed = PendingCalls.Find(Call))
+            {
+                Timed->TimeoutHandle.Reset();
+                GiveUp(Call, ESteamAsyncStatus::TimedOut);
+            }
+            return false;
+        }), TimeoutSeconds);
+    }
+
+    Backend.WatchCallResult<ResultType>(Call, [this, Call, Promise, Read = MoveTemp(Read), OnLateResult = MoveTemp(OnLateResult)](ResultType* Result, bool bIOFailure, const void* Prepared)
+    {
+        if (!Finish(Call))
+        {
+            LateCalls.Remove(Call);
+            if (Result && OnLateResult)
+            {
+                OnLateResult(*Result);
+            }
+            return;
+        }
+
+        FResult Value(Result ? ESteamAsyncStatus::Completed : ESteamAsyncStatus::IOFailure);
+        if (Result && Read)
+        {
+            Value.Status = Read(*Result, (const PreparedType*)Prepared, Value) ? ESteamAsyncStatus::Completed : ESteamAsyncStatus::Failed;
+        }
+        else if (Result)
+        {
+            if constexpr (std::is_same_v<ValueType, ResultType>)
+            {
+                Value.Value = *Result;
+            }
+        }
+        Promise->SetValue(MoveTemp(Value));
+    });
+    return Future;
+}
+///////////////////////////////////////////
+// MORE COMING SOON  // A.S. - hajddeen //
+/////////////////////////////////////////
@@ -0,0 +1,226 @@
+// |------------------------------------|
+// |  !FOLLOW URBAN SHADOWS ON SOCIALS! |
+// |------------------------------------|
+//            \ (^ᴗ^) /
+//             \     /
+//              -----
+//              |   |
+//              |   |
+//              |_  |_
+////////////////////////////////////////////////////////////
+// STEAM P2P SESSIONS - Unreal 5.5 + Steamworks SDK 1.57 //
+//////////////////////////////////////////////////////////////////
+// LICENSE AGREEMENT // LICENSE AGREEMENT // LICENSE AGREEMENT //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                                                                                                                                                                                                                                          //
+// Last Updated: 03/12/2024                                                                                                                                                                                                                                //
+//                                                                                                                                                                                                                                                        //
+// 1. Grant of License                                                                                                                                                                                                                                   //
+// This license permits anyone to use, modify, and distribute the provided code (the "Code") in projects free of charge under the following conditions:                                                                                                 //
+// 1.1. The Code must only be used for lawful purposes.                                                                                                                                                                                                //
+// 1.2. The user must include proper credit in their project as described in Section 3 below.                                                                                                                                                         //
+//                                                                                                                                                                                                                                                   //
+// 2. Restrictions                                                                                                                                                                                                                                  //
+// 2.1. This Code cannot be sold, sublicensed, or redistributed as a standalone product or as part of a similar development toolkit.                                                                                                               //
+// 2.2. The Code must not be used for projects that violate local laws or promote harmful, discriminatory, or illegal activities.                                                                                                                 //
+// 2.3. The user must not remove, alter, or obscure this license agreement, attribution requirements, or copyright notices within the Code.                                                                                                      //
+//                                                                                                                                                                                                                                              //
+// 3. Attribution                                                                                                                                                                                                                              //
+// 3.1. The user must include the following credit in a visible location within their project (e.g., splash screen, credits screen, or documentation):                                                                                        //
+// "Steam Multiplayer Code developed by Adrian Szajewski. Used under license."                                                                                                                                                               //
+// 3.2. For distributed or published projects, a link to https://adrianszajewskidev.wordpress.com/ or other contact details must also be included if applicable.                                                                            //
+//                                                                                                                                                                                                                                         //
+// 4. Breach of Agreement                                                                                                                                                                                                                 //
+// 4.1. If this license is violated, the licensor reserves the right to revoke the user's rights to use the Code immediately.                                                                                                            //
+// 4.2. The licensor may take legal action to recover damages or enforce compliance, depending on the severity of the violation.                                                                                                        //
+// 4.3. Users found in breach of this license may be required to:                                                                                                                                                                      //
+// Remove the Code from their project(s).                                                                                                                                                                                             //
+// Cease distribution of any projects using the Code.                                                                                                                                                                                //
+//                                                                                                                                                                                                                                  //
+// 5. Disclaimer                                                                                                                                                                                                                   //
+// 5.1. The Code is provided "as is" without any warranty, express or implied. The licensor is not liable for any damages arising from the use or misuse of the Code.                                                             //
+// 5.2. It is the user's responsibility to ensure compatibility and safe usage of the Code in their projects.                                                                                                                    //
+//                                                                                                                                                                                                                              //
+// 6. Governing Law                                                                                                                                                                                                            //
+// This agreement shall be governed and construed in accordance with the laws of Poland. Any disputes arising under or in connection with this license will be subject to the exclusive jurisdiction of the courts of Poland. //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////
+// INCLUDE //
+////////////
+#include "SteamAsyncActions.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+////////////////////////////////
+// Async Actions - Internals //
+////////////////////////////////////////////////////////////////////
+// 1. Results land on the game thread, the node may be gone by then //
+//////////////////////////////////////////////////////////////////
+namespace SteamAsyncActions
+{
+    template<typename ValueType>
+    TFuture<TSteamAsyncResult<ValueType>> MakeFailed()
+    {
+        return MakeFulfilledPromise<TSteamAsyncResult<ValueType>>(TSteamAsyncResult<ValueType>(ESteamAsyncStatus::Failed)).GetFuture();
+    }
+}
+/////////////////////////
+// 1. Shared          //
+////////////////////////////////////////
+// 1.1 - Find the game instance      //
+// 1.2 - Send the request           //
+// 1.3 - Stop waiting              //
+// 1.4 - Cancel the sent call     //
+///////////////////////////////////
+// - 1.1 - //
+void USteamAsyncActionBase::Setup(const UObject* WorldContextObject, float InTimeoutSeconds)
+{
+    TimeoutSeconds = InTimeoutSeconds;
+
+    UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull) : nullptr;
+    SteamMultiplayer = World ? Cast<USteamMultiplayer>(World->GetGameInstance()) : nullptr;
+    RegisterWithGameInstance(WorldContextObject);
+}
+// - 1.2 - //
+void USteamAsyncActionBase::Activate()
+{
+    if (!SteamMultiplayer.IsValid())
+    {
+        UE_LOG(LogSteamMultiplayer, Error, TEXT("%s needs a USteamMultiplayer game instance."), *GetClass()->GetName());
+    }
+    StartRequest(SteamMultiplayer.Get());
+}
+// - 1.3 - //
+void USteamAsyncActionBase::Cancel()
+{
+    if (USteamMultiplayer* Instance = SteamMultiplayer.Get())
+    {
+        CancelRequest(*Instance);
+    }
+}
+// - 1.4 - //
+void USteamAsyncActionBase::CancelRequest(USteamMultiplayer& Instance)
+{
+    Instance.CancelSteamCall(Call);
+}
+/////////////////////////
+// 2. Nodes           //
+////////////////////////////////////////
+// 2.1 - Create lobby                //
+// 2.2 - Find lobbies               //
+// 2.3 - Join lobby                //
+// 2.4 - Quick match              //
+///////////////////////////////////
+// - 2.1 - //
+USteamCreateLobbyAction* USteamCreateLobbyAction::CreateSteamLobby(const UObject* WorldContextObject, ESteamLobbyVisibility Visibility, int32 MaxMembers, float TimeoutSeconds)
+{
+    USteamCreateLobbyAction* Action = NewObject<USteamCreateLobbyAction>();
+    Action->Visibility = Visibility;
+    Action->MaxMembers = MaxMembers;
+    Action->Setup(WorldContextObject, TimeoutSeconds);
+    return Action;
+}
+
+void USteamCreateLobbyAction::StartRequest(USteamMultiplayer* Instance)
+{
+    TFuture<TSteamAsyncResult<FSteamLobbyId>> Future = Instance
+        ? Instance->CreateLobbyAsync((ELobbyType)Visibility, MaxMembers, TimeoutSeconds, &Call)
+        : SteamAsyncActions::MakeFailed<FSteamLobbyId>();
+
+    Future.Next([WeakThis = TWeakObjectPtr<USteamCreateLobbyAction>(this)](TSteamAsyncResult<FSteamLobbyId> Result)
+    {
+        if (USteamCreateLobbyAction* This = WeakThis.Get())
+        {
+            FOnSteamLobbyRequestDone& Pin = Result.IsSuccess() ? This->OnSuccess : This->OnFailure;
+            Pin.Broadcast(Result.Value, Result.Status, Result.SteamResult);
+            This->SetReadyToDestroy();
+        }
+    });
+}
+// - 2.2 - //
+USteamFindLobbiesAction* USteamFindLobbiesAction::FindSteamLobbies(const UObject* WorldContextObject, const FLobbySearchQuery& Query, float TimeoutSeconds)
+{
+    USteamFindLobbiesAction* Action = NewObject<USteamFindLobbiesAction>();
+    Action->Query = Query;
+    Action->Setup(WorldContextObject, TimeoutSeconds);
+    return Action;
+}
+
+void USteamFindLobbiesAction::StartRequest(USteamMultiplayer* Instance)
+{
+    TFuture<TSteamAsyncResult<TArray<FLobbyInfoData>>> Future = Instance
+        ? Instance->FindLobbiesAsync(Query, TimeoutSeconds, &Call)
+        : SteamAsyncActions::MakeFailed<TArray<FLobbyInfoData>>();
+
+    Future.Next([WeakThis = TWeakObjectPtr<USteamFindLobbiesAction>(this)](TSteamAsyncResult<TArray<FLobbyInfoData>> Result)
+    {
+        if (USteamFindLobbiesAction* This = WeakThis.Get())
+        {
+            FOnSteamLobbySearchDone& Pin = Result.IsSuccess() ? This->OnSuccess : This->OnFailure;
+            Pin.Broadcast(Result.Value, Result.Status);
+            This->SetReadyToDestroy();
+        }
+    });
+}
+// - 2.3 - //
+USteamJoinLobbyAction* USteamJoinLobbyAction::JoinSteamLobby(const UObject* WorldContextObject, FSteamLobbyId LobbyId, float TimeoutSeconds)
+{
+    USteamJoinLobbyAction* Action = NewObject<USteamJoinLobbyAction>();
+    Action->LobbyId = LobbyId;
+    Action->Setup(WorldContextObject, TimeoutSeconds);
+    return Action;
+}
+
+void USteamJoinLobbyAction::StartRequest(USteamMultiplayer* Instance)
+{
+    TFuture<TSteamAsyncResult<FSteamLobbyId>> Future = Instance
+        ? Instance->JoinLobbyAsync(LobbyId, TimeoutSeconds, &Call)
+        : SteamAsyncActions::MakeFailed<FSteamLobbyId>();
+
+    Future.Next([WeakThis = TWeakObjectPtr<USteamJoinLobbyAction>(this)](TSteamAsyncResult<FSteamLobbyId> Result)
+    {
+        if (USteamJoinLobbyAction* This = WeakThis.Get())
+        {
+            FOnSteamLobbyRequestDone& Pin = Result.IsSuccess() ? This->OnSuccess : This->OnFailure;
+            Pin.Broadcast(Result.Value, Result.Status, Result.SteamResult);
+            This->SetReadyToDestroy();
+        }
+    });
+}
+// - 2.4 - //
+USteamQuickMatchAction* USteamQuickMatchAction::QuickMatchSteam(const UObject* WorldContextObject, const FSteamQuickMatchSettings& Settings)
+{
+    USteamQuickMatchAction* Action = NewObject<USteamQuickMatchAction>();
+    Action->Settings = Settings;
+    Action->Setup(WorldContextObject, Settings.DeadlineSeconds);
+    return Action;
+}
+
+void USteamQuickMatchAction::StartRequest(USteamMultiplayer* Instance)
+{
+    TFuture<TSteamAsyncResult<FSteamLobbyId>> Future = Instance
+        ? Instance->QuickMatchAsync(Settings)
+        : SteamAsyncActions::MakeFailed<FSteamLobbyId>();
+
+    Future.Next([WeakThis = TWeakObjectPtr<USteamQuickMatchAction>(this)](TSteamAsyncResult<FSteamLobbyId> Result)
+    {
+        if (USteamQuickMatchAction* This = WeakThis.Get())
+        {
+            This->bFinished = true;
+            FOnSteamLobbyRequestDone& Pin = Result.IsSuccess() ? This->OnSuccess : This->OnFailure;
+            Pin.Broadcast(Result.Value, Result.Status, Result.SteamResult);
+            This->SetReadyToDestroy();
+        }
+    });
+}
+
+void USteamQuickMatchAction::CancelRequest(USteamMultiplayer& Instance)
+{
+    // One quick match per game instance, while ours has not finished it is the running one
+    if (!bFinished)
+    {
+        Instance.CancelQuickMatch();
+    }
+}
+///////////////////////////////////////////
+// MORE COMING SOON  // A.S. - hajddeen //
+/////////////////////////////////////////
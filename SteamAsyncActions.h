@@ -0,0 +1,206 @@
+// |------------------------------------|
+// |  !FOLLOW URBAN SHADOWS ON SOCIALS! |
+// |------------------------------------|
+//            \ (^ᴗ^) /
+//             \     /
+//              -----
+//              |   |
+//              |   |
+//              |_  |_ 
+////////////////////////////////////////////////////////////
+// STEAM P2P SESSIONS - Unreal 5.5 + Steamworks SDK 1.57 //
+//////////////////////////////////////////////////////////////////
+// LICENSE AGREEMENT // LICENSE AGREEMENT // LICENSE AGREEMENT //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                                                                                                                                                                                                                                          //
+// Last Updated: 03/12/2024                                                                                                                                                                                                                                //
+//                                                                                                                                                                                                                                                        //
+// 1. Grant of License                                                                                                                                                                                                                                   //
+// This license permits anyone to use, modify, and distribute the provided code (the "Code") in projects free of charge under the following conditions:                                                                                                 //
+// 1.1. The Code must only be used for lawful purposes.                                                                                                                                                                                                //
+// 1.2. The user must include proper credit in their project as described in Section 3 below.                                                                                                                                                         //
+//                                                                                                                                                                                                                                                   //
+// 2. Restrictions                                                                                                                                                                                                                                  //
+// 2.1. This Code cannot be sold, sublicensed, or redistributed as a standalone product or as part of a similar development toolkit.                                                                                                               //
+// 2.2. The Code must not be used for projects that violate local laws or promote harmful, discriminatory, or illegal activities.                                                                                                                 //
+// 2.3. The user must not remove, alter, or obscure this license agreement, attribution requirements, or copyright notices within the Code.                                                                                                      //
+//                                                                                                                                                                                                                                              //
+// 3. Attribution                                                                                                                                                                                                                              //
+// 3.1. The user must include the following credit in a visible location within their project (e.g., splash screen, credits screen, or documentation):                                                                                        //
+// "Steam Multiplayer Code developed by Adrian Szajewski. Used under license."                                                                                                                                                               //
+// 3.2. For distributed or published projects, a link to https://adrianszajewskidev.wordpress.com/ or other contact details must also be included if applicable.                                                                            //
+//                                                                                                                                                                                                                                         //
+// 4. Breach of Agreement                                                                                                                                                                                                                 //
+// 4.1. If this license is violated, the licensor reserves the right to revoke the user's rights to use the Code immediately.                                                                                                            //
+// 4.2. The licensor may take legal action to recover damages or enforce compliance, depending on the severity of the violation.                                                                                                        //
+// 4.3. Users found in breach of this license may be required to:                                                                                                                                                                      //
+// Remove the Code from their project(s).                                                                                                                                                                                             //
+// Cease distribution of any projects using the Code.                                                                                                                                                                                //
+//                                                                                                                                                                                                                                  //
+// 5. Disclaimer                                                                                                                                                                                                                   //
+// 5.1. The Code is provided "as is" without any warranty, express or implied. The licensor is not liable for any damages arising from the use or misuse of the Code.                                                             //
+// 5.2. It is the user's responsibility to ensure compatibility and safe usage of the Code in their projects.                                                                                                                    //
+//                                                                                                                                                                                                                              //
+// 6. Governing Law                                                                                                                                                                                                            //
+// This agreement shall be governed and construed in accordance with the laws of Poland. Any disputes arising under or in connection with this license will be subject to the exclusive jurisdiction of the courts of Poland. //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+/////////////////////////////////////////////////////////
+// INCLUDE //
+////////////
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "SteamMultiplayer.h"
+#include "SteamAsyncActions.generated.h"
+
+///////////////////////////////////////
+// LOBBY VISIBILITY - MIRRORS ELobbyType //
+///////////////////////////////////////
+UENUM(BlueprintType)
+enum class ESteamLobbyVisibility : uint8
+{
+    Private,
+    FriendsOnly,
+    Public,
+    Invisible // Joinable, never listed
+};
+////////////////
+// DELEGATES //
+////////////////
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnSteamLobbyRequestDone, FSteamLobbyId, LobbyId, ESteamAsyncStatus, Status, int32, SteamResult);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnSteamLobbySearchDone, const TArray<FLobbyInfoData>&, Lobbies, ESteamAsyncStatus, Status);
+//////////////////////////////////////////////////
+// SHARED PART OF THE LATENT STEAM NODES         //
+//////////////////////////////////////////////////
+// Each node owns one Steam request, Cancel on the returned object stops waiting on it.
+UCLASS(Abstract)
+class URBANSHADOWS_API USteamAsyncActionBase : public UBlueprintAsyncActionBase
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Activate() override;
+
+    // Failure pin fires with Cancelled, Steam still finishes the request on its side
+    UFUNCTION(BlueprintCallable, Category = "Steam|Async")
+    void Cancel();
+
+protected:
+    TWeakObjectPtr<USteamMultiplayer> SteamMultiplayer;
+    float TimeoutSeconds = 10.f;
+    SteamAPICall_t Call = k_uAPICallInvalid;
+
+    void Setup(const UObject* WorldContextObject, float InTimeoutSeconds);
+
+    // Instance is null when the game instance is not a USteamMultiplayer
+    virtual void StartRequest(USteamMultiplayer* Instance) PURE_VIRTUAL(USteamAsyncActionBase::StartRequest, );
+
+    // Stops what StartRequest sent, by default the one call in Call
+    virtual void CancelRequest(USteamMultiplayer& Instance);
+};
+///////////////////////////////
+// CREATE LOBBY (LATENT)     //
+///////////////////////////////
+UCLASS()
+class URBANSHADOWS_API USteamCreateLobbyAction : public USteamAsyncActionBase
+{
+    GENERATED_BODY()
+
+public:
+    // Only creates the lobby, HostGameWithSteamMatchmaking also publishes metadata and travels
+    UFUNCTION(BlueprintCallable, Category = "Steam|Async", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+    static USteamCreateLobbyAction* CreateSteamLobby(const UObject* WorldContextObject, ESteamLobbyVisibility Visibility = ESteamLobbyVisibility::Public, int32 MaxMembers = 4, float TimeoutSeconds = 10.f);
+
+    UPROPERTY(BlueprintAssignable)
+    FOnSteamLobbyRequestDone OnSuccess;
+
+    UPROPERTY(BlueprintAssignable)
+    FOnSteamLobbyRequestDone OnFailure;
+
+protected:
+    virtual void StartRequest(USteamMultiplayer* Instance) override;
+
+private:
+    ESteamLobbyVisibility Visibility = ESteamLobbyVisibility::Public;
+    int32 MaxMembers = 4;
+};
+///////////////////////////////
+// FIND LOBBIES (LATENT)     //
+///////////////////////////////
+UCLASS()
+class URBANSHADOWS_API USteamFindLobbiesAction : public USteamAsyncActionBase
+{
+    GENERATED_BODY()
+
+public:
+    // Results come back on the pin only, several searches can run side by side
+    UFUNCTION(BlueprintCallable, Category = "Steam|Async", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+    static USteamFindLobbiesAction* FindSteamLobbies(const UObject* WorldContextObject, const FLobbySearchQuery& Query, float TimeoutSeconds = 10.f);
+
+    UPROPERTY(BlueprintAssignable)
+    FOnSteamLobbySearchDone OnSuccess;
+
+    UPROPERTY(BlueprintAssignable)
+    FOnSteamLobbySearchDone OnFailure;
+
+protected:
+    virtual void StartRequest(USteamMultiplayer* Instance) override;
+
+private:
+    FLobbySearchQuery Query;
+};
+///////////////////////////////
+// JOIN LOBBY (LATENT)       //
+///////////////////////////////
+UCLASS()
+class URBANSHADOWS_API USteamJoinLobbyAction : public USteamAsyncActionBase
+{
+    GENERATED_BODY()
+
+public:
+    // Same travel as JoinLobby once entered, SteamResult carries the EChatRoomEnterResponse
+    UFUNCTION(BlueprintCallable, Category = "Steam|Async", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+    static USteamJoinLobbyAction* JoinSteamLobby(const UObject* WorldContextObject, FSteamLobbyId LobbyId, float TimeoutSeconds = 10.f);
+
+    UPROPERTY(BlueprintAssignable)
+    FOnSteamLobbyRequestDone OnSuccess;
+
+    UPROPERTY(BlueprintAssignable)
+    FOnSteamLobbyRequestDone OnFailure;
+
+protected:
+    virtual void StartRequest(USteamMultiplayer* Instance) override;
+
+private:
+    FSteamLobbyId LobbyId;
+};
+///////////////////////////////
+// QUICK MATCH (LATENT)      //
+///////////////////////////////
+UCLASS()
+class URBANSHADOWS_API USteamQuickMatchAction : public USteamAsyncActionBase
+{
+    GENERATED_BODY()
+
+public:
+    // Search + raced joins, the winner travels like JoinLobby. Settings.DeadlineSeconds bounds the whole node.
+    UFUNCTION(BlueprintCallable, Category = "Steam|Async", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+    static USteamQuickMatchAction* QuickMatchSteam(const UObject* WorldContextObject, const FSteamQuickMatchSettings& Settings);
+
+    UPROPERTY(BlueprintAssignable)
+    FOnSteamLobbyRequestDone OnSuccess;
+
+    UPROPERTY(BlueprintAssignable)
+    FOnSteamLobbyRequestDone OnFailure;
+
+protected:
+    virtual void StartRequest(USteamMultiplayer* Instance) override;
+    virtual void CancelRequest(USteamMultiplayer& Instance) override;
+
+private:
+    FSteamQuickMatchSettings Settings;
+    bool bFinished = false; // A newer quick match cancels ours, Cancel must not hit that one afterwards
+};
+///////////////////////////////////////////
+// MORE COMING SOON  // A.S. - hajddeen //
+/////////////////////////////////////////
@@ -0,0 +1,311 @@
+// |------------------------------------|
+// |  !FOLLOW URBAN SHADOWS ON SOCIALS! |
+// |------------------------------------|
+//            \ (^ᴗ^) /
+//             \     /
+//              -----
+//              |   |
+//              |   |
+//              |_  |_
+////////////////////////////////////////////////////////////
+// STEAM P2P SESSIONS - Unreal 5.5 + Steamworks SDK 1.57 //
+//////////////////////////////////////////////////////////////////
+// LICENSE AGREEMENT // LICENSE AGREEMENT // LICENSE AGREEMENT //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                                                                                                                                                                                                                                          //
+// Last Updated: 03/12/2024                                                                                                                                                                                                                                //
+//                                                                                                                                                                                                                                                        //
+// 1. Grant of License                                                                                                                                                                                                                                   //
+// This license permits anyone to use, modify, and distribute the provided code (the "Code") in projects free of charge under the following conditions:                                                                                                 //
+// 1.1. The Code must only be used for lawful purposes.                                                                                                                                                                                                //
+// 1.2. The user must include proper credit in their project as described in Section 3 below.                                                                                                                                                         //
+//                                                                                                                                                                                                                                                   //
+// 2. Restrictions                                                                                                                                                                                                                                  //
+// 2.1. This Code cannot be sold, sublicensed, or redistributed as a standalone product or as part of a similar development toolkit.                                                                                                               //
+// 2.2. The Code must not be used for projects that violate local laws or promote harmful, discriminatory, or illegal activities.                                                                                                                 //
+// 2.3. The user must not remove, alter, or obscure this license agreement, attribution requirements, or copyright notices within the Code.                                                                                                      //
+//                                                                                                                                                                                                                                              //
+// 3. Attribution                                                                                                                                                                                                                              //
+// 3.1. The user must include the following credit in a visible location within their project (e.g., splash screen, credits screen, or documentation):                                                                                        //
+// "Steam Multiplayer Code developed by Adrian Szajewski. Used under license."                                                                                                                                                               //
+// 3.2. For distributed or published projects, a link to https://adrianszajewskidev.wordpress.com/ or other contact details must also be included if applicable.                                                                            //
+//                                                                                                                                                                                                                                         //
+// 4. Breach of Agreement                                                                                                                                                                                                                 //
+// 4.1. If this license is violated, the licensor reserves the right to revoke the user's rights to use the Code immediately.                                                                                                            //
+// 4.2. The licensor may take legal action to recover damages or enforce compliance, depending on the severity of the violation.                                                                                                        //
+// 4.3. Users found in breach of this license may be required to:                                                                                                                                                                      //
+// Remove the Code from their project(s).                                                                                                                                                                                             //
+// Cease distribution of any projects using the Code.                                                                                                                                                                                //
+//                                                                                                                                                                                                                                  //
+// 5. Disclaimer                                                                                                                                                                                                                   //
+// 5.1. The Code is provided "as is" without any warranty, express or implied. The licensor is not liable for any damages arising from the use or misuse of the Code.                                                             //
+// 5.2. It is the user's responsibility to ensure compatibility and safe usage of the Code in their projects.                                                                                                                    //
+//                                                                                                                                                                                                                              //
+// 6. Governing Law                                                                                                                                                                                                            //
+// This agreement shall be governed and construed in accordance with the laws of Poland. Any disputes arising under or in connection with this license will be subject to the exclusive jurisdiction of the courts of Poland. //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// INCLUDE //
+////////////
+#include "SteamAvatarAtlas.h"
+#include "SteamMultiplayerStats.h"
+#include "RenderingThread.h"
+#include "TextureResource.h"
+///////////////////////
+// Atlas Layout     //
+//////////////////////////////////////////////////////////////////////////////////
+// 1. Steam large avatars are 184x184, slots keep a 2px gutter against bleeding //
+// 2. Avatar sits 1px in, its edge pixels are repeated into the gutter         //
+// 3. 11 x 11 slots per 2048 page, recycling kicks in after MaxPages pages    //
+///////////////////////////////////////////////////////////////////////////////
+namespace SteamAvatarAtlas
+{
+    constexpr int32 PageSize = 2048;
+    constexpr int32 SlotSize = 184;
+    constexpr int32 SlotStride = SlotSize + 2;
+    constexpr int32 SlotsPerRow = PageSize / SlotStride;
+    constexpr int32 SlotsPerPage = SlotsPerRow * SlotsPerRow;
+    constexpr int32 MaxPages = 4;
+
+    // Avatar plus a 1px ring of its own edge pixels, bilinear taps past the UV rect land on it
+    TArray<uint8> PadWithEdges(const TArray<uint8>& RGBA, uint32 Width, uint32 Height)
+    {
+        const uint32 PaddedWidth = Width + 2;
+        TArray<uint8> Padded;
+        Padded.SetNumUninitialized(PaddedWidth * (Height + 2) * 4);
+        for (uint32 Y = 0; Y < Height + 2; ++Y)
+        {
+            const uint32 SourceY = FMath::Clamp<int32>((int32)Y - 1, 0, (int32)Height - 1);
+            const uint8* Source = RGBA.GetData() + SourceY * Width * 4;
+            uint8* Dest = Padded.GetData() + Y * PaddedWidth * 4;
+            FMemory::Memcpy(Dest, Source, 4);
+            FMemory::Memcpy(Dest + 4, Source, Width * 4);
+            FMemory::Memcpy(Dest + (Width + 1) * 4, Source + (Width - 1) * 4, 4);
+        }
+        return Padded;
+    }
+}
+/////////////////////////
+// 1. Lifecycle       //
+///////////////////////////////
+// 1.1 - Release all pages  //
+/////////////////////////////
+// - 1.1 - //
+void USteamAvatarAtlasSubsystem::Deinitialize()
+{
+    ClearAtlas();
+    Pages.Empty();
+    SET_MEMORY_STAT(STAT_SteamAvatarAtlasMemory, 0);
+    FreeSlots.Empty();
+    Super::Deinitialize();
+}
+/////////////////////////
+// 2. Atlas Slots     //
+//////////////////////////////////////////////////////
+// 2.1 - Find an already packed avatar             //
+// 2.2 - Pack a new avatar                        //
+// 2.3 - Release a slot                          //
+// 2.4 - Upload queued avatars in one batch     //
+// 2.5 - Clear all slots                       //
+// 2.6 - Get atlas stats                      //
+// 2.7 - Claim a free or least recently used //
+// 2.8 - Fill atlas texture + UV rect       //
+/////////////////////////////////////////////
+// - 2.1 - //
+bool USteamAvatarAtlasSubsystem::FindAvatar(uint64 SteamID, int AvatarHandle, FLobbyPlayerInfo& OutPlayerInfo)
+{
+    FSteamAvatarAtlasSlot* Slot = Slots.Find(SteamID);
+    if (Slot && Slot->AvatarHandle == AvatarHandle)
+    {
+        Slot->LastUsed = ++AtlasClock;
+        FillPlayerInfo(*Slot, OutPlayerInfo);
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+// - 2.2 - //
+bool USteamAvatarAtlasSubsystem::AddAvatar(uint64 SteamID, int AvatarHandle, uint32 Width, uint32 Height, TArray<uint8>&& RGBA, FLobbyPlayerInfo& OutPlayerInfo)
+{
+    if (Width == 0 || Height == 0 || Width > (uint32)SteamAvatarAtlas::SlotSize || Height > (uint32)SteamAvatarAtlas::SlotSize)
+    {
+        UE_LOG(LogSteamMultiplayer, Error, TEXT("Avatar %ux%u does not fit an atlas slot."), Width, Height);
+        return false;
+    }
+    else
+    {
+        // Same member with a new image keeps its slot, the new pixels simply overwrite it
+        FSteamAvatarAtlasSlot* Slot = Slots.Find(SteamID);
+        if (!Slot)
+        {
+            int32 Page = INDEX_NONE;
+            int32 SlotIndex = INDEX_NONE;
+            if (!ClaimSlot(Page, SlotIndex))
+            {
+                UE_LOG(LogSteamMultiplayer, Error, TEXT("Failed to claim an avatar atlas slot."));
+                return false;
+            }
+            Slot = &Slots.Add(SteamID);
+            Slot->Page = Page;
+            Slot->Slot = SlotIndex;
+        }
+
+        Slot->AvatarHandle = AvatarHandle;
+        Slot->Width = Width;
+        Slot->Height = Height;
+        Slot->LastUsed = ++AtlasClock;
+
+        // A reused slot still holds the last avatar's gutter, the padded upload overwrites it too
+        PendingUploads.Add({ Slot->Page, Slot->Slot, Width + 2, Height + 2, SteamAvatarAtlas::PadWithEdges(RGBA, Width, Height) });
+        FillPlayerInfo(*Slot, OutPlayerInfo);
+        return true;
+    }
+}
+// - 2.3 - //
+void USteamAvatarAtlasSubsystem::ReleaseAvatar(uint64 SteamID)
+{
+    FSteamAvatarAtlasSlot Removed;
+    if (Slots.RemoveAndCopyValue(SteamID, Removed))
+    {
+        FreeSlots[Removed.Page].Add(Removed.Slot);
+    }
+}
+// - 2.4 - //
+void USteamAvatarAtlasSubsystem::FlushUploads()
+{
+    STEAM_MP_SCOPE(STAT_SteamAvatarAtlasFlush);
+
+    if (PendingUploads.Num() == 0)
+    {
+        return;
+    }
+    else
+    {
+        TArray<FTextureResource*> PageResources;
+        for (UTexture2DDynamic* Page : Pages)
+        {
+            PageResources.Add(Page ? Page->GetResource() : nullptr);
+        }
+
+        ENQUEUE_RENDER_COMMAND(UploadSteamAvatarAtlas)(
+            [PageResources = MoveTemp(PageResources), Uploads = MoveTemp(PendingUploads)](FRHICommandListImmediate& RHICmdList)
+            {
+                for (const FPendingUpload& Upload : Uploads)
+                {
+                    FTextureResource* Resource = PageResources[Upload.Page];
+                    if (Resource && Resource->GetTexture2DRHI())
+                    {
+                        const uint32 DestX = (Upload.Slot % SteamAvatarAtlas::SlotsPerRow) * SteamAvatarAtlas::SlotStride;
+                        const uint32 DestY = (Upload.Slot / SteamAvatarAtlas::SlotsPerRow) * SteamAvatarAtlas::SlotStride;
+                        const FUpdateTextureRegion2D Region(DestX, DestY, 0, 0, Upload.Width, Upload.Height);
+                        RHICmdList.UpdateTexture2D(Resource->GetTexture2DRHI(), 0, Region, Upload.Width * 4, Upload.RGBA.GetData());
+                    }
+                }
+            });
+        PendingUploads.Reset();
+    }
+}
+// - 2.5 - //
+void USteamAvatarAtlasSubsystem::ClearAtlas()
+{
+    Slots.Empty();
+    PendingUploads.Empty();
+    for (int32 Page = 0; Page < FreeSlots.Num(); ++Page)
+    {
+        FreeSlots[Page].Reset();
+        for (int32 SlotIndex = SteamAvatarAtlas::SlotsPerPage - 1; SlotIndex >= 0; --SlotIndex)
+        {
+            FreeSlots[Page].Add(SlotIndex);
+        }
+    }
+}
+// - 2.6 - //
+FAvatarAtlasStats USteamAvatarAtlasSubsystem::GetAtlasStats() const
+{
+    FAvatarAtlasStats Stats;
+    Stats.Pages = Pages.Num();
+    Stats.SlotsUsed = Slots.Num();
+    Stats.SlotsTotal = Pages.Num() * SteamAvatarAtlas::SlotsPerPage;
+    Stats.Recycles = Recycles;
+    Stats.BytesUsed = (int64)Pages.Num() * SteamAvatarAtlas::PageSize * SteamAvatarAtlas::PageSize * 4;
+    return Stats;
+}
+// - 2.7 - //
+bool USteamAvatarAtlasSubsystem::ClaimSlot(int32& OutPage, int32& OutSlot)
+{
+    for (int32 Page = 0; Page < FreeSlots.Num(); ++Page)
+    {
+        if (FreeSlots[Page].Num() > 0)
+        {
+            OutPage = Page;
+            OutSlot = FreeSlots[Page].Pop(EAllowShrinking::No);
+            return true;
+        }
+    }
+
+    if (Pages.Num() < SteamAvatarAtlas::MaxPages)
+    {
+        // Dynamic textures have no CPU side copy, the page only exists on the GPU
+        UTexture2DDynamic* NewPage = UTexture2DDynamic::Create(SteamAvatarAtlas::PageSize, SteamAvatarAtlas::PageSize, PF_R8G8B8A8);
+        if (!NewPage)
+        {
+            return false;
+        }
+        else
+        {
+            Pages.Add(NewPage);
+            SET_MEMORY_STAT(STAT_SteamAvatarAtlasMemory, (int64)Pages.Num() * SteamAvatarAtlas::PageSize * SteamAvatarAtlas::PageSize * 4);
+            TArray<int32>& PageFreeSlots = FreeSlots.AddDefaulted_GetRef();
+            PageFreeSlots.Reserve(SteamAvatarAtlas::SlotsPerPage);
+            for (int32 SlotIndex = SteamAvatarAtlas::SlotsPerPage - 1; SlotIndex >= 0; --SlotIndex)
+            {
+                PageFreeSlots.Add(SlotIndex);
+            }
+
+            OutPage = Pages.Num() - 1;
+            OutSlot = PageFreeSlots.Pop(EAllowShrinking::No);
+            return true;
+        }
+    }
+    else
+    {
+        // All pages full, hand out the least recently shown avatar's slot
+        uint64 OldestID = 0;
+        uint64 OldestUse = MAX_uint64;
+        for (const TPair<uint64, FSteamAvatarAtlasSlot>& Pair : Slots)
+        {
+            if (Pair.Value.LastUsed < OldestUse)
+            {
+                OldestID = Pair.Key;
+                OldestUse = Pair.Value.LastUsed;
+            }
+        }
+
+        FSteamAvatarAtlasSlot Recycled;
+        if (!Slots.RemoveAndCopyValue(OldestID, Recycled))
+        {
+            return false;
+        }
+        else
+        {
+            ++Recycles;
+            OutPage = Recycled.Page;
+            OutSlot = Recycled.Slot;
+            return true;
+        }
+    }
+}
+// - 2.8 - //
+void USteamAvatarAtlasSubsystem::FillPlayerInfo(const FSteamAvatarAtlasSlot& Slot, FLobbyPlayerInfo& OutPlayerInfo) const
+{
+    const float InvPageSize = 1.f / SteamAvatarAtlas::PageSize;
+    const float U0 = ((Slot.Slot % SteamAvatarAtlas::SlotsPerRow) * SteamAvatarAtlas::SlotStride + 1) * InvPageSize;
+    const float V0 = ((Slot.Slot / SteamAvatarAtlas::SlotsPerRow) * SteamAvatarAtlas::SlotStride + 1) * InvPageSize;
+
+    OutPlayerInfo.AvatarAtlas = Pages[Slot.Page];
+    OutPlayerInfo.AvatarUVRect = FVector4(U0, V0, U0 + Slot.Width * InvPageSize, V0 + Slot.Height * InvPageSize);
+}
+///////////////////////////////////////////
+// MORE COMING SOON  // A.S. - hajddeen //
+/////////////////////////////////////////
@@ -0,0 +1,157 @@
+// |------------------------------------|
+// |  !FOLLOW URBAN SHADOWS ON SOCIALS! |
+// |------------------------------------|
+//            \ (^ᴗ^) /
+//             \     /
+//              -----
+//              |   |
+//              |   |
+//              |_  |_ 
+////////////////////////////////////////////////////////////
+// STEAM P2P SESSIONS - Unreal 5.5 + Steamworks SDK 1.57 //
+//////////////////////////////////////////////////////////////////
+// LICENSE AGREEMENT // LICENSE AGREEMENT // LICENSE AGREEMENT //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                                                                                                                                                                                                                                          //
+// Last Updated: 03/12/2024                                                                                                                                                                                                                                //
+//                                                                                                                                                                                                                                                        //
+// 1. Grant of License                                                                                                                                                                                                                                   //
+// This license permits anyone to use, modify, and distribute the provided code (the "Code") in projects free of charge under the following conditions:                                                                                                 //
+// 1.1. The Code must only be used for lawful purposes.                                                                                                                                                                                                //
+// 1.2. The user must include proper credit in their project as described in Section 3 below.                                                                                                                                                         //
+//                                                                                                                                                                                                                                                   //
+// 2. Restrictions                                                                                                                                                                                                                                  //
+// 2.1. This Code cannot be sold, sublicensed, or redistributed as a standalone product or as part of a similar development toolkit.                                                                                                               //
+// 2.2. The Code must not be used for projects that violate local laws or promote harmful, discriminatory, or illegal activities.                                                                                                                 //
+// 2.3. The user must not remove, alter, or obscure this license agreement, attribution requirements, or copyright notices within the Code.                                                                                                      //
+//                                                                                                                                                                                                                                              //
+// 3. Attribution                                                                                                                                                                                                                              //
+// 3.1. The user must include the following credit in a visible location within their project (e.g., splash screen, credits screen, or documentation):                                                                                        //
+// "Steam Multiplayer Code developed by Adrian Szajewski. Used under license."                                                                                                                                                               //
+// 3.2. For distributed or published projects, a link to https://adrianszajewskidev.wordpress.com/ or other contact details must also be included if applicable.                                                                            //
+//                                                                                                                                                                                                                                         //
+// 4. Breach of Agreement                                                                                                                                                                                                                 //
+// 4.1. If this license is violated, the licensor reserves the right to revoke the user's rights to use the Code immediately.                                                                                                            //
+// 4.2. The licensor may take legal action to recover damages or enforce compliance, depending on the severity of the violation.                                                                                                        //
+// 4.3. Users found in breach of this license may be required to:                                                                                                                                                                      //
+// Remove the Code from their project(s).                                                                                                                                                                                             //
+// Cease distribution of any projects using the Code.                                                                                                                                                                                //
+//                                                                                                                                                                                                                                  //
+// 5. Disclaimer                                                                                                                                                                                                                   //
+// 5.1. The Code is provided "as is" without any warranty, express or implied. The licensor is not liable for any damages arising from the use or misuse of the Code.                                                             //
+// 5.2. It is the user's responsibility to ensure compatibility and safe usage of the Code in their projects.                                                                                                                    //
+//                                                                                                                                                                                                                              //
+// 6. Governing Law                                                                                                                                                                                                            //
+// This agreement shall be governed and construed in accordance with the laws of Poland. Any disputes arising under or in connection with this license will be subject to the exclusive jurisdiction of the courts of Poland. //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+/////////////////////////////////////////////////////////
+// INCLUDE //
+////////////
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Engine/Texture2DDynamic.h"
+#include "SteamMultiplayer.h"
+#include "SteamAvatarAtlas.generated.h"
+
+//////////////////////////////////////
+// STRUCT TO HOLD AVATAR ATLAS STATS //
+//////////////////////////////////////
+USTRUCT(BlueprintType)
+struct FAvatarAtlasStats
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Avatar Atlas")
+    int32 Pages = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Avatar Atlas")
+    int32 SlotsUsed = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Avatar Atlas")
+    int32 SlotsTotal = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Avatar Atlas")
+    int64 Recycles = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Avatar Atlas")
+    int64 BytesUsed = 0;
+};
+//////////////////////////////
+// ATLAS SLOT BOOKKEEPING  //
+//////////////////////////////
+struct FSteamAvatarAtlasSlot
+{
+    int32 Page = INDEX_NONE;
+    int32 Slot = INDEX_NONE;
+    int AvatarHandle = 0;
+    uint32 Width = 0;
+    uint32 Height = 0;
+    uint64 LastUsed = 0;
+};
+////////////////
+// MAIN BODY //
+/////////////////////////////////////////////////////////////////////////////////////
+// Packs lobby/friend avatars into a few large pooled pages instead of one texture //
+// per player. Rows draw with AvatarAtlas + AvatarUVRect from FLobbyPlayerInfo.    //
+/////////////////////////////////////////////////////////////////////////////////////
+UCLASS()
+class URBANSHADOWS_API USteamAvatarAtlasSubsystem : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    //////////////////////////////////////////////
+    // 1. Subsystem Lifecycle                  //
+    ////////////////////////////////////////////
+    virtual void Deinitialize() override;
+
+    //////////////////////////////////////////////
+    // 2. Atlas Slots                          //
+    ////////////////////////////////////////////
+    // Fills AvatarAtlas/AvatarUVRect if this SteamID is already packed with the same image handle
+    bool FindAvatar(uint64 SteamID, int AvatarHandle, FLobbyPlayerInfo& OutPlayerInfo);
+
+    // Claims (or recycles) a slot and queues the pixels for the next FlushUploads
+    bool AddAvatar(uint64 SteamID, int AvatarHandle, uint32 Width, uint32 Height, TArray<uint8>&& RGBA, FLobbyPlayerInfo& OutPlayerInfo);
+
+    // Returns the slot to the free list, the pixels stay until it is reused
+    void ReleaseAvatar(uint64 SteamID);
+
+    // Sends every queued avatar to the GPU in a single render command
+    void FlushUploads();
+
+    UFUNCTION(BlueprintCallable, Category = "Steam|Avatar Atlas")
+    void ClearAtlas();
+
+    UFUNCTION(BlueprintCallable, Category = "Steam|Avatar Atlas")
+    FAvatarAtlasStats GetAtlasStats() const;
+
+private:
+    //////////////////////////////////////////////
+    // 1. Private Data Members                 //
+    ////////////////////////////////////////////
+    struct FPendingUpload
+    {
+        int32 Page;
+        int32 Slot;
+        uint32 Width;  // Padded, the avatar plus its edge ring
+        uint32 Height;
+        TArray<uint8> RGBA;
+    };
+
+    UPROPERTY()
+    TArray<UTexture2DDynamic*> Pages;   // Pooled atlas pages, GPU only (no CPU mip copy)
+
+    TArray<TArray<int32>> FreeSlots;    // Per page free slot indices
+    TMap<uint64, FSteamAvatarAtlasSlot> Slots; // Keyed by member SteamID
+    TArray<FPendingUpload> PendingUploads;
+    uint64 AtlasClock = 0;
+    int64 Recycles = 0;
+
+    bool ClaimSlot(int32& OutPage, int32& OutSlot);
+    void FillPlayerInfo(const FSteamAvatarAtlasSlot& Slot, FLobbyPlayerInfo& OutPlayerInfo) const;
+};
+///////////////////////////////////////////
+// MORE COMING SOON  // A.S. - hajddeen //
+/////////////////////////////////////////
@@ -0,0 +1,544 @@
+// |------------------------------------|
+// |  !FOLLOW URBAN SHADOWS ON SOCIALS! |
+// |------------------------------------|
+//            \ (^ᴗ^) /
+//             \     /
+//              -----
+//              |   |
+//              |   |
+//              |_  |_
+////////////////////////////////////////////////////////////
+// STEAM P2P SESSIONS - Unreal 5.5 + Steamworks SDK 1.57 //
+//////////////////////////////////////////////////////////////////
+// LICENSE AGREEMENT // LICENSE AGREEMENT // LICENSE AGREEMENT //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                                                                                                                                                                                                                                          //
+// Last Updated: 03/12/2024                                                                                                                                                                                                                                //
+//                                                                                                                                                                                                                                                        //
+// 1. Grant of License                                                                                                                                                                                                                                   //
+// This license permits anyone to use, modify, and distribute the provided code (the "Code") in projects free of charge under the following conditions:                                                                                                 //
+// 1.1. The Code must only be used for lawful purposes.                                                                                                                                                                                                //
+// 1.2. The user must include proper credit in their project as described in Section 3 below.                                                                                                                                                         //
+//                                                                                                                                                                                                                                                   //
+// 2. Restrictions                                                                                                                                                                                                                                  //
+// 2.1. This Code cannot be sold, sublicensed, or redistributed as a standalone product or as part of a similar development toolkit.                                                                                                               //
+// 2.2. The Code must not be used for projects that violate local laws or promote harmful, discriminatory, or illegal activities.                                                                                                                 //
+// 2.3. The user must not remove, alter, or obscure this license agreement, attribution requirements, or copyright notices within the Code.                                                                                                      //
+//                                                                                                                                                                                                                                              //
+// 3. Attribution                                                                                                                                                                                                                              //
+// 3.1. The user must include the following credit in a visible location within their project (e.g., splash screen, credits screen, or documentation):                                                                                        //
+// "Steam Multiplayer Code developed by Adrian Szajewski. Used under license."                                                                                                                                                               //
+// 3.2. For distributed or published projects, a link to https://adrianszajewskidev.wordpress.com/ or other contact details must also be included if applicable.                                                                            //
+//                                                                                                                                                                                                                                         //
+// 4. Breach of Agreement                                                                                                                                                                                                                 //
+// 4.1. If this license is violated, the licensor reserves the right to revoke the user's rights to use the Code immediately.                                                                                                            //
+// 4.2. The licensor may take legal action to recover damages or enforce compliance, depending on the severity of the violation.                                                                                                        //
+// 4.3. Users found in breach of this license may be required to:                                                                                                                                                                      //
+// Remove the Code from their project(s).                                                                                                                                                                                             //
+// Cease distribution of any projects using the Code.                                                                                                                                                                                //
+//                                                                                                                                                                                                                                  //
+// 5. Disclaimer                                                                                                                                                                                                                   //
+// 5.1. The Code is provided "as is" without any warranty, express or implied. The licensor is not liable for any damages arising from the use or misuse of the Code.                                                             //
+// 5.2. It is the user's responsibility to ensure compatibility and safe usage of the Code in their projects.                                                                                                                    //
+//                                                                                                                                                                                                                              //
+// 6. Governing Law                                                                                                                                                                                                            //
+// This agreement shall be governed and construed in accordance with the laws of Poland. Any disputes arising under or in connection with this license will be subject to the exclusive jurisdiction of the courts of Poland. //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// INCLUDE //
+////////////
+#include "SteamBackend.h"
+#include "SteamCallbackPump.h"
+#include "SteamMultiplayerStats.h"
+/////////////////////////
+// 0. Callback Router //
+////////////////////////////////////////////////
+// 0.1 - Add a handler                       //
+// 0.2 - Remove a handler                   //
+// 0.3 - Off-thread prepare step           //
+// 0.4 - Dispatch                         //
+// 0.5 - Reset                           //
+// 0.6 - Dispatch a call result         //
+// 0.7 - Stop waiting on a call        //
+// 0.8 - Drop finished CCallResults   //
+///////////////////////////////////////
+// - 0.1 - //
+FSteamCallbackRouter::FHandle FSteamCallbackRouter::BindRaw(int32 CallbackId, TFunction<void(void*, const void*)> Handler)
+{
+    const FHandle Handle = NextHandle++;
+    FHandlerEntry& Entry = DispatchDepth > 0 ? PendingBinds.Emplace_GetRef(CallbackId, FHandlerEntry()).Value : Handlers.FindOrAdd(CallbackId).AddDefaulted_GetRef();
+    Entry.Handle = Handle;
+    Entry.Handler = MoveTemp(Handler);
+    return Handle;
+}
+// - 0.2 - //
+void FSteamCallbackRouter::Unbind(FHandle Handle)
+{
+    if (PendingBinds.RemoveAll([Handle](const TPair<int32, FHandlerEntry>& Pending) { return Pending.Value.Handle == Handle; }) > 0)
+    {
+        return;
+    }
+    else if (DispatchDepth > 0)
+    {
+        PendingUnbinds.Add(Handle);
+        return;
+    }
+
+    for (TPair<int32, TArray<FHandlerEntry>>& Pair : Handlers)
+    {
+        if (Pair.Value.RemoveAll([Handle](const FHandlerEntry& Entry) { return Entry.Handle == Handle; }) > 0)
+        {
+            return;
+        }
+    }
+}
+// - 0.3 - //
+FSteamCallbackRouter::FPreparedPtr FSteamCallbackRouter::Prepare(int32 CallbackId, const void* Payload) const
+{
+    const TFunction<FPreparedPtr(const void*)>* Preparer = Preparers.Find(CallbackId);
+    return Preparer ? (*Preparer)(Payload) : nullptr;
+}
+// - 0.4 - //
+bool FSteamCallbackRouter::Dispatch(int32 CallbackId, void* Payload, const void* Prepared)
+{
+    const TArray<FHandlerEntry>* Entries = Handlers.Find(CallbackId);
+    if (!Entries || Entries->Num() == 0)
+    {
+        return false;
+    }
+
+    FPreparedPtr InlinePrepared;
+    if (!Prepared)
+    {
+        InlinePrepared = Prepare(CallbackId, Payload);
+        Prepared = InlinePrepared.Get();
+    }
+
+    // No copy, handlers that bind or unbind only queue the change until we are done
+    ++DispatchDepth;
+    for (int32 Index = 0; Index < Entries->Num(); ++Index)
+    {
+        const FHandlerEntry& Entry = (*Entries)[Index];
+        if (PendingUnbinds.Num() == 0 || !PendingUnbinds.Contains(Entry.Handle))
+        {
+            Entry.Handler(Payload, Prepared);
+        }
+    }
+
+    if (--DispatchDepth == 0)
+    {
+        ApplyPending();
+    }
+    return true;
+}
+// - 0.5 - //
+void FSteamCallbackRouter::Reset()
+{
+    PendingBinds.Reset();
+    if (DispatchDepth > 0)
+    {
+        // The arrays being walked stay alive, every handler in them is dropped once dispatch unwinds
+        for (const TPair<int32, TArray<FHandlerEntry>>& Pair : Handlers)
+        {
+            for (const FHandlerEntry& Entry : Pair.Value)
+            {
+                PendingUnbinds.AddUnique(Entry.Handle);
+            }
+        }
+    }
+    else
+    {
+        Handlers.Reset();
+    }
+    Preparers.Reset();
+}
+
+void FSteamCallbackRouter::ApplyPending()
+{
+    for (const FHandle Handle : PendingUnbinds)
+    {
+        Unbind(Handle);
+    }
+    PendingUnbinds.Reset();
+
+    for (TPair<int32, FHandlerEntry>& Pending : PendingBinds)
+    {
+        Handlers.FindOrAdd(Pending.Key).Add(MoveTemp(Pending.Value));
+    }
+    PendingBinds.Reset();
+}
+// - 0.6 - //
+bool FSteamCallbackRouter::DispatchCallResult(SteamAPICall_t Call, int32 CallbackId, void* Payload, bool bIOFailure, const void* Prepared)
+{
+    FCallResultEntry Entry;
+    if (!CallResults.RemoveAndCopyValue(Call, Entry))
+    {
+        return false;
+    }
+    else if (Entry.CallbackId != CallbackId)
+    {
+        // Handle reused for a different result type, nothing typed to hand over
+        UE_LOG(LogSteamMultiplayer, Warning, TEXT("Steam call %llu completed with callback %d, expected %d."), Call, CallbackId, Entry.CallbackId);
+        Entry.Handler(nullptr, true, nullptr);
+        return true;
+    }
+
+    FPreparedPtr InlinePrepared;
+    if (!bIOFailure && Payload && !Prepared)
+    {
+        InlinePrepared = Prepare(CallbackId, Payload);
+        Prepared = InlinePrepared.Get();
+    }
+
+    // Removed before running, so the handler may start a new call with whatever handle Steam hands out
+    Entry.Handler(bIOFailure ? nullptr : Payload, bIOFailure, Prepared);
+    return true;
+}
+// - 0.7 - //
+void ISteamBackend::CancelCallResult(SteamAPICall_t Call)
+{
+    CallbackRouter.UnbindCallResult(Call);
+    NativeCallResults.Remove(Call);
+}
+// - 0.8 - //
+void ISteamBackend::PruneNativeCallResults()
+{
+    for (auto It = NativeCallResults.CreateIterator(); It; ++It)
+    {
+        if (!It.Value()->IsActive())
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
+/////////////////////////
+// 1. Lifecycle       //
+/////////////////////////////////////////////
+// 1.1 - SteamAPI_Init                    //
+// 1.2 - SteamAPI_Shutdown               //
+// 1.3 - Is Steam running               //
+// 1.4 - Hand pumped callbacks over    //
+////////////////////////////////////////
+FSteamworksBackend::FSteamworksBackend(bool bInManualDispatch, float InDispatchBudgetMs)
+    : bManualDispatch(bInManualDispatch), DispatchBudgetMs(InDispatchBudgetMs), bInitialized(false)
+{
+}
+
+FSteamworksBackend::~FSteamworksBackend()
+{
+    CallbackPump.Reset();
+}
+// - 1.1 - //
+bool FSteamworksBackend::Init()
+{
+    if (!SteamAPI_Init())
+    {
+        return false;
+    }
+    else if (bManualDispatch)
+    {
+        // Nothing may call SteamAPI_RunCallbacks from here on (disable OnlineSubsystemSteam's pump)
+        SteamAPI_ManualDispatch_Init();
+        CallbackPump = MakeUnique<FSteamCallbackPump>(CallbackRouter, SteamAPI_GetHSteamPipe());
+        if (!CallbackPump->Start())
+        {
+            // No pump means no callbacks at all, leave Steam down rather than half up
+            UE_LOG(LogSteamMultiplayer, Error, TEXT("Steam callback pump thread failed to start."));
+            CallbackPump.Reset();
+            SteamAPI_Shutdown();
+            return false;
+        }
+        bInitialized = true;
+        return true;
+    }
+    bInitialized = true;
+    return true;
+}
+// - 1.2 - //
+void FSteamworksBackend::Shutdown()
+{
+    // Pump thread must be gone before the pipe it reads from
+    CallbackPump.Reset();
+    NativeCallResults.Reset();
+    SteamAPI_Shutdown();
+    bInitialized = false;
+}
+// - 1.3 - //
+bool FSteamworksBackend::IsRunning() const
+{
+    return bInitialized;
+}
+// - 1.4 - //
+void FSteamworksBackend::Tick(float DeltaTime)
+{
+    if (CallbackPump.IsValid())
+    {
+        CallbackPump->DispatchQueued(DispatchBudgetMs / 1000.0);
+    }
+}
+
+int32 FSteamworksBackend::GetNumQueuedCallbacks() const
+{
+    return CallbackPump.IsValid() ? CallbackPump->GetNumQueued() : 0;
+}
+/////////////////////////
+// 2. Forwarding      //
+//////////////////////////////////////////////////
+// Straight pass-through to the Steam interfaces //
+//////////////////////////////////////////////////
+CSteamID FSteamworksBackend::GetLocalSteamID()
+{
+    return SteamUser()->GetSteamID();
+}
+
+const char* FSteamworksBackend::GetPersonaName()
+{
+    return SteamFriends()->GetPersonaName();
+}
+
+SteamAPICall_t FSteamworksBackend::CreateLobby(ELobbyType LobbyType, int32 MaxMembers)
+{
+    return SteamMatchmaking()->CreateLobby(LobbyType, MaxMembers);
+}
+
+SteamAPICall_t FSteamworksBackend::JoinLobby(CSteamID LobbyID)
+{
+    return SteamMatchmaking()->JoinLobby(LobbyID);
+}
+
+void FSteamworksBackend::LeaveLobby(CSteamID LobbyID)
+{
+    SteamMatchmaking()->LeaveLobby(LobbyID);
+}
+
+SteamAPICall_t FSteamworksBackend::RequestLobbyList()
+{
+    return SteamMatchmaking()->RequestLobbyList();
+}
+
+void FSteamworksBackend::AddRequestLobbyListStringFilter(const char* Key, const char* Value, ELobbyComparison Comparison)
+{
+    SteamMatchmaking()->AddRequestLobbyListStringFilter(Key, Value, Comparison);
+}
+
+void FSteamworksBackend::AddRequestLobbyListNumericalFilter(const char* Key, int32 Value, ELobbyComparison Comparison)
+{
+    SteamMatchmaking()->AddRequestLobbyListNumericalFilter(Key, Value, Comparison);
+}
+
+void FSteamworksBackend::AddRequestLobbyListNearValueFilter(const char* Key, int32 Value)
+{
+    SteamMatchmaking()->AddRequestLobbyListNearValueFilter(Key, Value);
+}
+
+void FSteamworksBackend::AddRequestLobbyListFilterSlotsAvailable(int32 SlotsAvailable)
+{
+    SteamMatchmaking()->AddRequestLobbyListFilterSlotsAvailable(SlotsAvailable);
+}
+
+void FSteamworksBackend::AddRequestLobbyListDistanceFilter(ELobbyDistanceFilter Distance)
+{
+    SteamMatchmaking()->AddRequestLobbyListDistanceFilter(Distance);
+}
+
+void FSteamworksBackend::AddRequestLobbyListResultCountFilter(int32 MaxResults)
+{
+    SteamMatchmaking()->AddRequestLobbyListResultCountFilter(MaxResults);
+}
+
+CSteamID FSteamworksBackend::GetLobbyByIndex(int32 Index)
+{
+    return SteamMatchmaking()->GetLobbyByIndex(Index);
+}
+
+int32 FSteamworksBackend::GetNumLobbyMembers(CSteamID LobbyID)
+{
+    return SteamMatchmaking()->GetNumLobbyMembers(LobbyID);
+}
+
+CSteamID FSteamworksBackend::GetLobbyMemberByIndex(CSteamID LobbyID, int32 Index)
+{
+    return SteamMatchmaking()->GetLobbyMemberByIndex(LobbyID, Index);
+}
+
+int32 FSteamworksBackend::GetLobbyMemberLimit(CSteamID LobbyID)
+{
+    return SteamMatchmaking()->GetLobbyMemberLimit(LobbyID);
+}
+
+CSteamID FSteamworksBackend::GetLobbyOwner(CSteamID LobbyID)
+{
+    return SteamMatchmaking()->GetLobbyOwner(LobbyID);
+}
+
+bool FSteamworksBackend::SetLobbyOwner(CSteamID LobbyID, CSteamID NewOwner)
+{
+    return SteamMatchmaking()->SetLobbyOwner(LobbyID, NewOwner);
+}
+
+const char* FSteamworksBackend::GetLobbyData(CSteamID LobbyID, const char* Key)
+{
+    return SteamMatchmaking()->GetLobbyData(LobbyID, Key);
+}
+
+bool FSteamworksBackend::SetLobbyData(CSteamID LobbyID, const char* Key, const char* Value)
+{
+    return SteamMatchmaking()->SetLobbyData(LobbyID, Key, Value);
+}
+
+const char* FSteamworksBackend::GetLobbyMemberData(CSteamID LobbyID, CSteamID UserID, const char* Key)
+{
+    return SteamMatchmaking()->GetLobbyMemberData(LobbyID, UserID, Key);
+}
+
+void FSteamworksBackend::SetLobbyMemberData(CSteamID LobbyID, const char* Key, const char* Value)
+{
+    SteamMatchmaking()->SetLobbyMemberData(LobbyID, Key, Value);
+}
+
+bool FSteamworksBackend::SendLobbyChatMsg(CSteamID LobbyID, const void* Data, int32 Size)
+{
+    return SteamMatchmaking()->SendLobbyChatMsg(LobbyID, Data, Size);
+}
+
+int32 FSteamworksBackend::GetLobbyChatEntry(CSteamID LobbyID, int32 ChatID, CSteamID* OutUser, void* OutBuffer, int32 BufferSize, EChatEntryType* OutType)
+{
+    return SteamMatchmaking()->GetLobbyChatEntry(LobbyID, ChatID, OutUser, OutBuffer, BufferSize, OutType);
+}
+
+const char* FSteamworksBackend::GetFriendPersonaName(CSteamID SteamID)
+{
+    return SteamFriends()->GetFriendPersonaName(SteamID);
+}
+
+int FSteamworksBackend::GetLargeFriendAvatar(CSteamID SteamID)
+{
+    return SteamFriends()->GetLargeFriendAvatar(SteamID);
+}
+
+int32 FSteamworksBackend::GetFriendCount()
+{
+    return SteamFriends()->GetFriendCount(k_EFriendFlagImmediate);
+}
+
+CSteamID FSteamworksBackend::GetFriendByIndex(int32 Index)
+{
+    return SteamFriends()->GetFriendByIndex(Index, k_EFriendFlagImmediate);
+}
+
+bool FSteamworksBackend::IsFriend(CSteamID SteamID)
+{
+    return SteamFriends()->HasFriend(SteamID, k_EFriendFlagImmediate);
+}
+
+EPersonaState FSteamworksBackend::GetFriendPersonaState(CSteamID SteamID)
+{
+    return SteamFriends()->GetFriendPersonaState(SteamID);
+}
+
+const char* FSteamworksBackend::GetFriendRichPresence(CSteamID SteamID, const char* Key)
+{
+    return SteamFriends()->GetFriendRichPresence(SteamID, Key);
+}
+
+bool FSteamworksBackend::SetRichPresence(const char* Key, const char* Value)
+{
+    return SteamFriends()->SetRichPresence(Key, Value);
+}
+
+bool FSteamworksBackend::GetImageSize(int Image, uint32* OutWidth, uint32* OutHeight)
+{
+    return SteamUtils()->GetImageSize(Image, OutWidth, OutHeight);
+}
+
+bool FSteamworksBackend::GetImageRGBA(int Image, uint8* OutBuffer, int BufferSize)
+{
+    return SteamUtils()->GetImageRGBA(Image, OutBuffer, BufferSize);
+}
+
+void FSteamworksBackend::InitRelayNetworkAccess()
+{
+    SteamNetworkingUtils()->InitRelayNetworkAccess();
+}
+
+float FSteamworksBackend::GetLocalPingLocation(SteamNetworkPingLocation_t& OutLocation)
+{
+    return SteamNetworkingUtils()->GetLocalPingLocation(OutLocation);
+}
+
+int32 FSteamworksBackend::EstimatePingTimeBetweenTwoLocations(const SteamNetworkPingLocation_t& A, const SteamNetworkPingLocation_t& B)
+{
+    return SteamNetworkingUtils()->EstimatePingTimeBetweenTwoLocations(A, B);
+}
+
+void FSteamworksBackend::ConvertPingLocationToString(const SteamNetworkPingLocation_t& Location, char* OutBuffer, int32 BufferSize)
+{
+    SteamNetworkingUtils()->ConvertPingLocationToString(Location, OutBuffer, BufferSize);
+}
+
+bool FSteamworksBackend::ParsePingLocationString(const char* String, SteamNetworkPingLocation_t& OutLocation)
+{
+    return SteamNetworkingUtils()->ParsePingLocationString(String, OutLocation);
+}
+
+bool FSteamworksBackend::RequestCurrentStats()
+{
+    return SteamUserStats()->RequestCurrentStats();
+}
+
+bool FSteamworksBackend::GetStatInt(const char* Name, int32* OutValue)
+{
+    return SteamUserStats()->GetStat(Name, OutValue);
+}
+
+bool FSteamworksBackend::GetStatFloat(const char* Name, float* OutValue)
+{
+    return SteamUserStats()->GetStat(Name, OutValue);
+}
+
+bool FSteamworksBackend::SetStatInt(const char* Name, int32 Value)
+{
+    return SteamUserStats()->SetStat(Name, Value);
+}
+
+bool FSteamworksBackend::SetStatFloat(const char* Name, float Value)
+{
+    return SteamUserStats()->SetStat(Name, Value);
+}
+
+bool FSteamworksBackend::GetAchievement(const char* Name, bool* OutAchieved)
+{
+    return SteamUserStats()->GetAchievement(Name, OutAchieved);
+}
+
+bool FSteamworksBackend::SetAchievement(const char* Name)
+{
+    return SteamUserStats()->SetAchievement(Name);
+}
+
+bool FSteamworksBackend::StoreStats()
+{
+    return SteamUserStats()->StoreStats();
+}
+
+SteamAPICall_t FSteamworksBackend::FindLeaderboard(const char* Name)
+{
+    return SteamUserStats()->FindLeaderboard(Name);
+}
+
+SteamAPICall_t FSteamworksBackend::UploadLeaderboardScore(SteamLeaderboard_t Leaderboard, ELeaderboardUploadScoreMethod Method, int32 Score)
+{
+    return SteamUserStats()->UploadLeaderboardScore(Leaderboard, Method, Score, nullptr, 0);
+}
+
+SteamAPICall_t FSteamworksBackend::DownloadLeaderboardEntries(SteamLeaderboard_t Leaderboard, ELeaderboardDataRequest Request, int32 RangeStart, int32 RangeEnd)
+{
+    return SteamUserStats()->DownloadLeaderboardEntries(Leaderboard, Request, RangeStart, RangeEnd);
+}
+
+bool FSteamworksBackend::GetDownloadedLeaderboardEntry(SteamLeaderboardEntries_t Entries, int32 Index, LeaderboardEntry_t* OutEntry)
+{
+    return SteamUserStats()->GetDownloadedLeaderboardEntry(Entries, Index, OutEntry, nullptr, 0);
+}
+///////////////////////////////////////////
+// MORE COMING SOON  // A.S. - hajddeen //
+/////////////////////////////////////////
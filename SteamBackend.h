@@ -0,0 +1,422 @@
+// |------------------------------------|
+// |  !FOLLOW URBAN SHADOWS ON SOCIALS! |
+// |------------------------------------|
+//            \ (^ᴗ^) /
+//             \     /
+//              -----
+//              |   |
+//              |   |
+//              |_  |_ 
+////////////////////////////////////////////////////////////
+// STEAM P2P SESSIONS - Unreal 5.5 + Steamworks SDK 1.57 //
+//////////////////////////////////////////////////////////////////
+// LICENSE AGREEMENT // LICENSE AGREEMENT // LICENSE AGREEMENT //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                                                                                                                                                                                                                                          //
+// Last Updated: 03/12/2024                                                                                                                                                                                                                                //
+//                                                                                                                                                                                                                                                        //
+// 1. Grant of License                                                                                                                                                                                                                                   //
+// This license permits anyone to use, modify, and distribute the provided code (the "Code") in projects free of charge under the following conditions:                                                                                                 //
+// 1.1. The Code must only be used for lawful purposes.                                                                                                                                                                                                //
+// 1.2. The user must include proper credit in their project as described in Section 3 below.                                                                                                                                                         //
+//                                                                                                                                                                                                                                                   //
+// 2. Restrictions                                                                                                                                                                                                                                  //
+// 2.1. This Code cannot be sold, sublicensed, or redistributed as a standalone product or as part of a similar development toolkit.                                                                                                               //
+// 2.2. The Code must not be used for projects that violate local laws or promote harmful, discriminatory, or illegal activities.                                                                                                                 //
+// 2.3. The user must not remove, alter, or obscure this license agreement, attribution requirements, or copyright notices within the Code.                                                                                                      //
+//                                                                                                                                                                                                                                              //
+// 3. Attribution                                                                                                                                                                                                                              //
+// 3.1. The user must include the following credit in a visible location within their project (e.g., splash screen, credits screen, or documentation):                                                                                        //
+// "Steam Multiplayer Code developed by Adrian Szajewski. Used under license."                                                                                                                                                               //
+// 3.2. For distributed or published projects, a link to https://adrianszajewskidev.wordpress.com/ or other contact details must also be included if applicable.                                                                            //
+//                                                                                                                                                                                                                                         //
+// 4. Breach of Agreement                                                                                                                                                                                                                 //
+// 4.1. If this license is violated, the licensor reserves the right to revoke the user's rights to use the Code immediately.                                                                                                            //
+// 4.2. The licensor may take legal action to recover damages or enforce compliance, depending on the severity of the violation.                                                                                                        //
+// 4.3. Users found in breach of this license may be required to:                                                                                                                                                                      //
+// Remove the Code from their project(s).                                                                                                                                                                                             //
+// Cease distribution of any projects using the Code.                                                                                                                                                                                //
+//                                                                                                                                                                                                                                  //
+// 5. Disclaimer                                                                                                                                                                                                                   //
+// 5.1. The Code is provided "as is" without any warranty, express or implied. The licensor is not liable for any damages arising from the use or misuse of the Code.                                                             //
+// 5.2. It is the user's responsibility to ensure compatibility and safe usage of the Code in their projects.                                                                                                                    //
+//                                                                                                                                                                                                                              //
+// 6. Governing Law                                                                                                                                                                                                            //
+// This agreement shall be governed and construed in accordance with the laws of Poland. Any disputes arising under or in connection with this license will be subject to the exclusive jurisdiction of the courts of Poland. //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+/////////////////////////////////////////////////////////
+// INCLUDE //
+////////////
+#include "CoreMinimal.h"
+#include "steam/steam_api.h"
+#include "steam/isteammatchmaking.h"
+#include "steam/isteamuserstats.h"
+#include "steam/isteamnetworkingutils.h"
+
+/////////////////////////////////////////////////////////////////////////////////////
+// STEAM BACKEND - NOTES                                                           //
+/////////////////////////////////////////////////////////////////////////////////////
+// 1. USteamMultiplayer talks to Steam only through ISteamBackend.                //
+// 2. FSteamworksBackend forwards to SteamMatchmaking()/SteamFriends()/...       //
+//    and its callbacks keep arriving through STEAM_CALLBACK as before.         //
+// 3. FFakeSteamBackend (FakeSteamBackend.h) simulates Steam in-process and    //
+//    delivers its callbacks through the callback router below.               //
+// 4. With manual dispatch, FSteamworksBackend drains Steam on a pump thread  //
+//    (SteamCallbackPump.h) and also delivers through the router.            //
+// 5. Call results (one SteamAPICall_t -> one result) always go through the //
+//    router by handle, fed by CCallResult, the pump or the fake.           //
+/////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////
+// ROUTES CALLBACK PAYLOADS BY k_iCallback ID //
+////////////////////////////////////////////////
+// Handlers run on the game thread and may be bound / unbound at any time there.
+// Prepare steps run on the callback pump thread when there is one, bind them before Init.
+class URBANSHADOWS_API FSteamCallbackRouter
+{
+public:
+    using FHandle = uint32;
+    using FPreparedPtr = TSharedPtr<void, ESPMode::ThreadSafe>;
+
+    template<typename CallbackType>
+    FHandle Bind(TFunction<void(CallbackType*)> Handler)
+    {
+        return BindRaw(CallbackType::k_iCallback, [Handler = MoveTemp(Handler)](void* Payload, const void* Prepared)
+        {
+            Handler((CallbackType*)Payload);
+        });
+    }
+
+    // Prepare does the thread-safe part (Steam reads, string work, disk probes) before the handler sees the payload
+    template<typename CallbackType, typename PreparedType>
+    FHandle BindPrepared(TFunction<void(const CallbackType&, PreparedType&)> Prepare, TFunction<void(CallbackType*, const PreparedType&)> Handler)
+    {
+        SetPreparer<CallbackType, PreparedType>(MoveTemp(Prepare));
+        return BindRaw(CallbackType::k_iCallback, [Handler = MoveTemp(Handler)](void* Payload, const void* Prepared)
+        {
+            Handler((CallbackType*)Payload, *(const PreparedType*)Prepared);
+        });
+    }
+
+    // Prepare step alone, it also runs for call results of the same type
+    template<typename CallbackType, typename PreparedType>
+    void SetPreparer(TFunction<void(const CallbackType&, PreparedType&)> Prepare)
+    {
+        Preparers.Add(CallbackType::k_iCallback, [Prepare = MoveTemp(Prepare)](const void* Payload) -> FPreparedPtr
+        {
+            TSharedPtr<PreparedType, ESPMode::ThreadSafe> Prepared = MakeShared<PreparedType, ESPMode::ThreadSafe>();
+            Prepare(*(const CallbackType*)Payload, *Prepared);
+            return Prepared;
+        });
+    }
+
+    // One-shot handler for a single SteamAPICall_t, dropped once it fires.
+    // Result is null on IO failure, Prepared is whatever the preparer for ResultType made (may be null).
+    template<typename ResultType>
+    void BindCallResult(SteamAPICall_t Call, TFunction<void(ResultType*, bool, const void*)> Handler)
+    {
+        FCallResultEntry& Entry = CallResults.Add(Call);
+        Entry.CallbackId = ResultType::k_iCallback;
+        Entry.Handler = [Handler = MoveTemp(Handler)](void* Payload, bool bIOFailure, const void* Prepared)
+        {
+            Handler((ResultType*)Payload, bIOFailure, Prepared);
+        };
+    }
+
+    bool UnbindCallResult(SteamAPICall_t Call) { return CallResults.Remove(Call) > 0; }
+    bool IsCallResultBound(SteamAPICall_t Call) const { return CallResults.Contains(Call); }
+
+    void Unbind(FHandle Handle);
+
+    // nullptr when no prepare step is bound for this ID
+    FPreparedPtr Prepare(int32 CallbackId, const void* Payload) const;
+
+    // Returns false when nobody listens for this callback ID, prepares inline if the caller did not.
+    // Binds and unbinds made by a handler take effect once the outermost dispatch returns.
+    bool Dispatch(int32 CallbackId, void* Payload, const void* Prepared = nullptr);
+
+    // Returns false when nobody waits on this call (never bound, cancelled or already done)
+    bool DispatchCallResult(SteamAPICall_t Call, int32 CallbackId, void* Payload, bool bIOFailure, const void* Prepared = nullptr);
+
+    // Drops handlers and prepare steps, call results still in flight keep their handlers
+    void Reset();
+
+private:
+    struct FHandlerEntry
+    {
+        FHandle Handle = 0;
+        TFunction<void(void*, const void*)> Handler;
+    };
+
+    struct FCallResultEntry
+    {
+        int32 CallbackId = 0;
+        TFunction<void(void*, bool, const void*)> Handler;
+    };
+
+    TMap<int32, TArray<FHandlerEntry>> Handlers;
+    TMap<int32, TFunction<FPreparedPtr(const void*)>> Preparers;
+    TMap<SteamAPICall_t, FCallResultEntry> CallResults;
+    FHandle NextHandle = 1;
+
+    // Handler arrays are walked in place, so they only change outside of Dispatch
+    int32 DispatchDepth = 0;
+    TArray<TPair<int32, FHandlerEntry>> PendingBinds;
+    TArray<FHandle> PendingUnbinds;
+
+    FHandle BindRaw(int32 CallbackId, TFunction<void(void*, const void*)> Handler);
+    void ApplyPending();
+};
+//////////////////////////////////////////////
+// CCALLRESULT THAT FEEDS THE ROUTER        //
+//////////////////////////////////////////////
+// Used when Steam runs its own callbacks (SteamAPI_RunCallbacks), one per call in flight.
+class FSteamNativeCallResult
+{
+public:
+    virtual ~FSteamNativeCallResult() {}
+    virtual bool IsActive() const = 0;
+};
+
+template<typename ResultType>
+class TSteamNativeCallResult : public FSteamNativeCallResult
+{
+public:
+    TSteamNativeCallResult(FSteamCallbackRouter& InRouter, SteamAPICall_t InCall)
+        : Router(InRouter), Call(InCall)
+    {
+        CallResult.Set(InCall, this, &TSteamNativeCallResult::OnCompleted);
+    }
+
+    // Still counts as active while its handler runs, so a prune from in there can't delete it
+    virtual bool IsActive() const override { return CallResult.IsActive() || bDispatching; }
+
+private:
+    FSteamCallbackRouter& Router;
+    SteamAPICall_t Call;
+    bool bDispatching = false;
+    CCallResult<TSteamNativeCallResult, ResultType> CallResult; // Unregisters itself when destroyed
+
+    void OnCompleted(ResultType* Result, bool bIOFailure)
+    {
+        bDispatching = true;
+        Router.DispatchCallResult(Call, ResultType::k_iCallback, bIOFailure ? nullptr : Result, bIOFailure);
+        bDispatching = false;
+    }
+};
+///////////////////////////////////////
+// INTERFACE OVER THE STEAM CALLS WE USE //
+///////////////////////////////////////
+class URBANSHADOWS_API ISteamBackend
+{
+public:
+    virtual ~ISteamBackend() {}
+
+    //////////////////////////////////////////////
+    // 1. Lifecycle                            //
+    ////////////////////////////////////////////
+    virtual bool Init() = 0;
+    virtual void Shutdown() = 0;
+    virtual bool IsRunning() const = 0;
+    virtual bool IsFake() const { return false; }
+    virtual void Tick(float DeltaTime) {}
+
+    // True when callbacks come through GetCallbackRouter() instead of STEAM_CALLBACK
+    virtual bool UsesCallbackRouter() const { return IsFake(); }
+
+    FSteamCallbackRouter& GetCallbackRouter() { return CallbackRouter; }
+
+    // Handler runs once on the game thread when this call's result lands, see FSteamCallbackRouter::BindCallResult
+    template<typename ResultType>
+    void WatchCallResult(SteamAPICall_t Call, TFunction<void(ResultType*, bool, const void*)> Handler)
+    {
+        CallbackRouter.BindCallResult<ResultType>(Call, MoveTemp(Handler));
+        if (!UsesCallbackRouter())
+        {
+            PruneNativeCallResults();
+            NativeCallResults.Add(Call, MakeUnique<TSteamNativeCallResult<ResultType>>(CallbackRouter, Call));
+        }
+    }
+
+    // Stops waiting, Steam still finishes the call on its side
+    void CancelCallResult(SteamAPICall_t Call);
+
+    //////////////////////////////////////////////
+    // 2. User                                 //
+    ////////////////////////////////////////////
+    virtual CSteamID GetLocalSteamID() = 0;
+    virtual const char* GetPersonaName() = 0;
+
+    //////////////////////////////////////////////
+    // 3. Matchmaking                          //
+    ////////////////////////////////////////////
+    virtual SteamAPICall_t CreateLobby(ELobbyType LobbyType, int32 MaxMembers) = 0;
+    virtual SteamAPICall_t JoinLobby(CSteamID LobbyID) = 0;
+    virtual void LeaveLobby(CSteamID LobbyID) = 0;
+    virtual SteamAPICall_t RequestLobbyList() = 0;
+    virtual void AddRequestLobbyListStringFilter(const char* Key, const char* Value, ELobbyComparison Comparison) = 0;
+    virtual void AddRequestLobbyListNumericalFilter(const char* Key, int32 Value, ELobbyComparison Comparison) = 0;
+    virtual void AddRequestLobbyListNearValueFilter(const char* Key, int32 Value) = 0;
+    virtual void AddRequestLobbyListFilterSlotsAvailable(int32 SlotsAvailable) = 0;
+    virtual void AddRequestLobbyListDistanceFilter(ELobbyDistanceFilter Distance) = 0;
+    virtual void AddRequestLobbyListResultCountFilter(int32 MaxResults) = 0;
+    virtual CSteamID GetLobbyByIndex(int32 Index) = 0;
+    virtual int32 GetNumLobbyMembers(CSteamID LobbyID) = 0;
+    virtual CSteamID GetLobbyMemberByIndex(CSteamID LobbyID, int32 Index) = 0;
+    virtual int32 GetLobbyMemberLimit(CSteamID LobbyID) = 0;
+    virtual CSteamID GetLobbyOwner(CSteamID LobbyID) = 0;
+    // Owner only, every member sees LobbyDataUpdate_t for the lobby once it moved
+    virtual bool SetLobbyOwner(CSteamID LobbyID, CSteamID NewOwner) = 0;
+    virtual const char* GetLobbyData(CSteamID LobbyID, const char* Key) = 0;
+    virtual bool SetLobbyData(CSteamID LobbyID, const char* Key, const char* Value) = 0;
+    virtual const char* GetLobbyMemberData(CSteamID LobbyID, CSteamID UserID, const char* Key) = 0;
+    // Local user only, other members see LobbyDataUpdate_t with their ID
+    virtual void SetLobbyMemberData(CSteamID LobbyID, const char* Key, const char* Value) = 0;
+    // Every member gets LobbyChatMsg_t for it, the sender included
+    virtual bool SendLobbyChatMsg(CSteamID LobbyID, const void* Data, int32 Size) = 0;
+    // Copies at most BufferSize bytes of the entry into OutBuffer, returns how many were copied
+    virtual int32 GetLobbyChatEntry(CSteamID LobbyID, int32 ChatID, CSteamID* OutUser, void* OutBuffer, int32 BufferSize, EChatEntryType* OutType) = 0;
+
+    //////////////////////////////////////////////
+    // 4. Friends                              //
+    ////////////////////////////////////////////
+    virtual const char* GetFriendPersonaName(CSteamID SteamID) = 0;
+    virtual int GetLargeFriendAvatar(CSteamID SteamID) = 0;
+    // Immediate friends only, safe off the game thread
+    virtual int32 GetFriendCount() = 0;
+    virtual CSteamID GetFriendByIndex(int32 Index) = 0;
+    virtual bool IsFriend(CSteamID SteamID) = 0;
+    virtual EPersonaState GetFriendPersonaState(CSteamID SteamID) = 0;
+    virtual const char* GetFriendRichPresence(CSteamID SteamID, const char* Key) = 0;
+    // Local user, friends see it through FriendRichPresenceUpdate_t. Empty Value removes the key
+    virtual bool SetRichPresence(const char* Key, const char* Value) = 0;
+
+    //////////////////////////////////////////////
+    // 5. Utils - must be safe off the game thread //
+    ////////////////////////////////////////////
+    virtual bool GetImageSize(int Image, uint32* OutWidth, uint32* OutHeight) = 0;
+    virtual bool GetImageRGBA(int Image, uint8* OutBuffer, int BufferSize) = 0;
+
+    //////////////////////////////////////////////
+    // 6. Ping Locations - safe off the game thread //
+    ////////////////////////////////////////////
+    // Starts the relay measurements, the local location is usable a few seconds later
+    virtual void InitRelayNetworkAccess() = 0;
+    // Age of the measurement in seconds, negative while there is none yet
+    virtual float GetLocalPingLocation(SteamNetworkPingLocation_t& OutLocation) = 0;
+    // Round trip in ms, negative when either side lacks data
+    virtual int32 EstimatePingTimeBetweenTwoLocations(const SteamNetworkPingLocation_t& A, const SteamNetworkPingLocation_t& B) = 0;
+    virtual void ConvertPingLocationToString(const SteamNetworkPingLocation_t& Location, char* OutBuffer, int32 BufferSize) = 0;
+    virtual bool ParsePingLocationString(const char* String, SteamNetworkPingLocation_t& OutLocation) = 0;
+
+    //////////////////////////////////////////////
+    // 7. User Stats + Leaderboards            //
+    ////////////////////////////////////////////
+    // Local user only. Reads and writes fail until UserStatsReceived_t arrived for us
+    virtual bool RequestCurrentStats() = 0;
+    virtual bool GetStatInt(const char* Name, int32* OutValue) = 0;
+    virtual bool GetStatFloat(const char* Name, float* OutValue) = 0;
+    virtual bool SetStatInt(const char* Name, int32 Value) = 0;
+    virtual bool SetStatFloat(const char* Name, float Value) = 0;
+    virtual bool GetAchievement(const char* Name, bool* OutAchieved) = 0;
+    virtual bool SetAchievement(const char* Name) = 0;
+    // Uploads everything set since the last store in one go, answered by UserStatsStored_t
+    virtual bool StoreStats() = 0;
+    virtual SteamAPICall_t FindLeaderboard(const char* Name) = 0;
+    virtual SteamAPICall_t UploadLeaderboardScore(SteamLeaderboard_t Leaderboard, ELeaderboardUploadScoreMethod Method, int32 Score) = 0;
+    virtual SteamAPICall_t DownloadLeaderboardEntries(SteamLeaderboard_t Leaderboard, ELeaderboardDataRequest Request, int32 RangeStart, int32 RangeEnd) = 0;
+    // Only while the LeaderboardScoresDownloaded_t carrying Entries is handled, safe on the pump thread
+    virtual bool GetDownloadedLeaderboardEntry(SteamLeaderboardEntries_t Entries, int32 Index, LeaderboardEntry_t* OutEntry) = 0;
+
+protected:
+    FSteamCallbackRouter CallbackRouter;
+    TMap<SteamAPICall_t, TUniquePtr<FSteamNativeCallResult>> NativeCallResults; // Declared after the router they point at
+
+    // Completed CCallResults are dropped lazily, never from inside their own callback
+    void PruneNativeCallResults();
+};
+///////////////////////////////////////
+// REAL STEAMWORKS IMPLEMENTATION   //
+///////////////////////////////////////
+class URBANSHADOWS_API FSteamworksBackend : public ISteamBackend
+{
+public:
+    // Manual dispatch drains Steam on a background thread, the game thread spends at most DispatchBudgetMs per tick on it
+    explicit FSteamworksBackend(bool bInManualDispatch = false, float InDispatchBudgetMs = 1.f);
+    virtual ~FSteamworksBackend();
+
+    virtual bool Init() override;
+    virtual void Shutdown() override;
+    virtual bool IsRunning() const override;
+    virtual void Tick(float DeltaTime) override;
+    virtual bool UsesCallbackRouter() const override { return bManualDispatch; }
+
+    int32 GetNumQueuedCallbacks() const;
+
+    virtual CSteamID GetLocalSteamID() override;
+    virtual const char* GetPersonaName() override;
+
+    virtual SteamAPICall_t CreateLobby(ELobbyType LobbyType, int32 MaxMembers) override;
+    virtual SteamAPICall_t JoinLobby(CSteamID LobbyID) override;
+    virtual void LeaveLobby(CSteamID LobbyID) override;
+    virtual SteamAPICall_t RequestLobbyList() override;
+    virtual void AddRequestLobbyListStringFilter(const char* Key, const char* Value, ELobbyComparison Comparison) override;
+    virtual void AddRequestLobbyListNumericalFilter(const char* Key, int32 Value, ELobbyComparison Comparison) override;
+    virtual void AddRequestLobbyListNearValueFilter(const char* Key, int32 Value) override;
+    virtual void AddRequestLobbyListFilterSlotsAvailable(int32 SlotsAvailable) override;
+    virtual void AddRequestLobbyListDistanceFilter(ELobbyDistanceFilter Distance) override;
+    virtual void AddRequestLobbyListResultCountFilter(int32 MaxResults) override;
+    virtual CSteamID GetLobbyByIndex(int32 Index) override;
+    virtual int32 GetNumLobbyMembers(CSteamID LobbyID) override;
+    virtual CSteamID GetLobbyMemberByIndex(CSteamID LobbyID, int32 Index) override;
+    virtual int32 GetLobbyMemberLimit(CSteamID LobbyID) override;
+    virtual CSteamID GetLobbyOwner(CSteamID LobbyID) override;
+    virtual bool SetLobbyOwner(CSteamID LobbyID, CSteamID NewOwner) override;
+    virtual const char* GetLobbyData(CSteamID LobbyID, const char* Key) override;
+    virtual bool SetLobbyData(CSteamID LobbyID, const char* Key, const char* Value) override;
+    virtual const char* GetLobbyMemberData(CSteamID LobbyID, CSteamID UserID, const char* Key) override;
+    virtual void SetLobbyMemberData(CSteamID LobbyID, const char* Key, const char* Value) override;
+    virtual bool SendLobbyChatMsg(CSteamID LobbyID, const void* Data, int32 Size) override;
+    virtual int32 GetLobbyChatEntry(CSteamID LobbyID, int32 ChatID, CSteamID* OutUser, void* OutBuffer, int32 BufferSize, EChatEntryType* OutType) override;
+
+    virtual const char* GetFriendPersonaName(CSteamID SteamID) override;
+    virtual int GetLargeFriendAvatar(CSteamID SteamID) override;
+    virtual int32 GetFriendCount() override;
+    virtual CSteamID GetFriendByIndex(int32 Index) override;
+    virtual bool IsFriend(CSteamID SteamID) override;
+    virtual EPersonaState GetFriendPersonaState(CSteamID SteamID) override;
+    virtual const char* GetFriendRichPresence(CSteamID SteamID, const char* Key) override;
+    virtual bool SetRichPresence(const char* Key, const char* Value) override;
+
+    virtual bool GetImageSize(int Image, uint32* OutWidth, uint32* OutHeight) override;
+    virtual bool GetImageRGBA(int Image, uint8* OutBuffer, int BufferSize) override;
+
+    virtual void InitRelayNetworkAccess() override;
+    virtual float GetLocalPingLocation(SteamNetworkPingLocation_t& OutLocation) override;
+    virtual int32 EstimatePingTimeBetweenTwoLocations(const SteamNetworkPingLocation_t& A, const SteamNetworkPingLocation_t& B) override;
+    virtual void ConvertPingLocationToString(const SteamNetworkPingLocation_t& Location, char* OutBuffer, int32 BufferSize) override;
+    virtual bool ParsePingLocationString(const char* String, SteamNetworkPingLocation_t& OutLocation) override;
+
+    virtual bool RequestCurrentStats() override;
+    virtual bool GetStatInt(const char* Name, int32* OutValue) override;
+    virtual bool GetStatFloat(const char* Name, float* OutValue) override;
+    virtual bool SetStatInt(const char* Name, int32 Value) override;
+    virtual bool SetStatFloat(const char* Name, float Value) override;
+    virtual bool GetAchievement(const char* Name, bool* OutAchieved) override;
+    virtual bool SetAchievement(const char* Name) override;
+    virtual bool StoreStats() override;
+    virtual SteamAPICall_t FindLeaderboard(const char* Name) override;
+    virtual SteamAPICall_t UploadLeaderboardScore(SteamLeaderboard_t Leaderboard, ELeaderboardUploadScoreMethod Method, int32 Score) override;
+    virtual SteamAPICall_t DownloadLeaderboardEntries(SteamLeaderboard_t Leaderboard, ELeaderboardDataRequest Request, int32 RangeStart, int32 RangeEnd) override;
+    virtual bool GetDownloadedLeaderboardEntry(SteamLeaderboardEntries_t Entries, int32 Index, LeaderboardEntry_t* OutEntry) override;
+
+private:
+    bool bManualDispatch;
+    float DispatchBudgetMs;
+    bool bInitialized; // Our SteamAPI_Init succeeded, SteamAPI_IsSteamRunning only says the client is up
+    TUniquePtr<class FSteamCallbackPump> CallbackPump;
+};
+///////////////////////////////////////////
+// MORE COMING SOON  // A.S. - hajddeen //
+/////////////////////////////////////////
@@ -0,0 +1,223 @@
+// |------------------------------------|
+// |  !FOLLOW URBAN SHADOWS ON SOCIALS! |
+// |------------------------------------|
+//            \ (^ᴗ^) /
+//             \     /
+//              -----
+//              |   |
+//              |   |
+//              |_  |_
+////////////////////////////////////////////////////////////
+// STEAM P2P SESSIONS - Unreal 5.5 + Steamworks SDK 1.57 //
+//////////////////////////////////////////////////////////////////
+// LICENSE AGREEMENT // LICENSE AGREEMENT // LICENSE AGREEMENT //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                                                                                                                                                                                                                                          //
+// Last Updated: 03/12/2024                                                                                                                                                                                                                                //
+//                                                                                                                                                                                                                                                        //
+// 1. Grant of License                                                                                                                                                                                                                                   //
+// This license permits anyone to use, modify, and distribute the provided code (the "Code") in projects free of charge under the following conditions:                                                                                                 //
+// 1.1. The Code must only be used for lawful purposes.                                                                                                                                                                                                //
+// 1.2. The user must include proper credit in their project as described in Section 3 below.                                                                                                                                                         //
+//                                                                                                                                                                                                                                                   //
+// 2. Restrictions                                                                                                                                                                                                                                  //
+// 2.1. This Code cannot be sold, sublicensed, or redistributed as a standalone product or as part of a similar development toolkit.                                                                                                               //
+// 2.2. The Code must not be used for projects that violate local laws or promote harmful, discriminatory, or illegal activities.                                                                                                                 //
+// 2.3. The user must not remove, alter, or obscure this license agreement, attribution requirements, or copyright notices within the Code.                                                                                                      //
+//                                                                                                                                                                                                                                              //
+// 3. Attribution                                                                                                                                                                                                                              //
+// 3.1. The user must include the following credit in a visible location within their project (e.g., splash screen, credits screen, or documentation):                                                                                        //
+// "Steam Multiplayer Code developed by Adrian Szajewski. Used under license."                                                                                                                                                               //
+// 3.2. For distributed or published projects, a link to https://adrianszajewskidev.wordpress.com/ or other contact details must also be included if applicable.                                                                            //
+//                                                                                                                                                                                                                                         //
+// 4. Breach of Agreement                                                                                                                                                                                                                 //
+// 4.1. If this license is violated, the licensor reserves the right to revoke the user's rights to use the Code immediately.                                                                                                            //
+// 4.2. The licensor may take legal action to recover damages or enforce compliance, depending on the severity of the violation.                                                                                                        //
+// 4.3. Users found in breach of this license may be required to:                                                                                                                                                                      //
+// Remove the Code from their project(s).                                                                                                                                                                                             //
+// Cease distribution of any projects using the Code.                                                                                                                                                                                //
+//                                                                                                                                                                                                                                  //
+// 5. Disclaimer                                                                                                                                                                                                                   //
+// 5.1. The Code is provided "as is" without any warranty, express or implied. The licensor is not liable for any damages arising from the use or misuse of the Code.                                                             //
+// 5.2. It is the user's responsibility to ensure compatibility and safe usage of the Code in their projects.                                                                                                                    //
+//                                                                                                                                                                                                                              //
+// 6. Governing Law                                                                                                                                                                                                            //
+// This agreement shall be governed and construed in accordance with the laws of Poland. Any disputes arising under or in connection with this license will be subject to the exclusive jurisdiction of the courts of Poland. //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////
+// INCLUDE //
+////////////
+#include "SteamCallbackPump.h"
+#include "SteamMultiplayerStats.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/PlatformProcess.h"
+////////////////////////////////
+// Callback Pump - Internals //
+////////////////////////////////////////////////////////////////////
+// 1. Steam buffers callbacks itself, polling every 2ms is plenty //
+//////////////////////////////////////////////////////////////////
+namespace SteamCallbackPump
+{
+    constexpr float PollIntervalSeconds = 0.002f;
+    constexpr uint32 QueuedEventCapacity = 1024; // Rings round up to a power of two
+    constexpr uint32 FreeEventCapacity = 256;    // Events past this are freed instead of pooled
+}
+//////////////////////////
+// Constructor - Notes //
+////////////////////////////////////////////////////////
+// 1. Thread starts in Start(), stops in destructor.  //
+//////////////////////////////////////////////////////
+FSteamCallbackPump::FSteamCallbackPump(FSteamCallbackRouter& InRouter, HSteamPipe InPipe)
+    : Router(InRouter), Pipe(InPipe), Thread(nullptr), bStopRequested(false), NumQueued(0)
+    , Events(SteamCallbackPump::QueuedEventCapacity), FreeEvents(SteamCallbackPump::FreeEventCapacity)
+{
+}
+
+FSteamCallbackPump::~FSteamCallbackPump()
+{
+    if (Thread)
+    {
+        Thread->Kill(true);
+        delete Thread;
+        Thread = nullptr;
+    }
+
+    // Whatever was never dispatched is dropped
+    FSteamCallbackEvent* Event = nullptr;
+    while (Events.Dequeue(Event) || FreeEvents.Dequeue(Event))
+    {
+        delete Event;
+    }
+}
+/////////////////////////
+// 1. Pump            //
+////////////////////////////////////////
+// 1.1 - Start the thread            //
+// 1.2 - Thread loop                //
+// 1.3 - Drain Steam once          //
+// 1.4 - Dispatch on game thread  //
+// 1.5 - Reuse dispatched events //
+//////////////////////////////////
+// - 1.1 - //
+bool FSteamCallbackPump::Start()
+{
+    Thread = FRunnableThread::Create(this, TEXT("SteamCallbackPump"), 0, TPri_BelowNormal);
+    return Thread != nullptr;
+}
+// - 1.2 - //
+uint32 FSteamCallbackPump::Run()
+{
+    while (!bStopRequested)
+    {
+        PumpSteam();
+        FPlatformProcess::SleepNoStats(SteamCallbackPump::PollIntervalSeconds);
+    }
+    return 0;
+}
+// - 1.3 - //
+void FSteamCallbackPump::PumpSteam()
+{
+    SteamAPI_ManualDispatch_RunFrame(Pipe);
+
+    // A full ring leaves the rest in Steam's queue, nothing is dropped
+    CallbackMsg_t Message;
+    while (!Events.IsFull() && SteamAPI_ManualDispatch_GetNextCallback(Pipe, &Message))
+    {
+        FSteamCallbackEvent* Event = AcquireEvent();
+        if (Message.m_iCallback == SteamAPICallCompleted_t::k_iCallback)
+        {
+            // The result has to be fetched while its completion is the current callback
+            const SteamAPICallCompleted_t* Completed = (const SteamAPICallCompleted_t*)Message.m_pubParam;
+            Event->APICall = Completed->m_hAsyncCall;
+            Event->CallbackId = Completed->m_iCallback;
+            Event->SetPayloadSize(Completed->m_cubParam);
+            FMemory::Memzero(Event->GetPayload(), Completed->m_cubParam);
+
+            bool bFailed = false;
+            const bool bFetched = SteamAPI_ManualDispatch_GetAPICallResult(Pipe, Completed->m_hAsyncCall, Event->GetPayload(), Completed->m_cubParam, Completed->m_iCallback, &bFailed);
+            Event->bIOFailure = !bFetched || bFailed;
+        }
+        else
+        {
+            Event->CallbackId = Message.m_iCallback;
+            Event->SetPayloadSize(Message.m_cubParam);
+            FMemory::Memcpy(Event->GetPayload(), Message.m_pubParam, Message.m_cubParam);
+        }
+
+        // Steam state the handler needs (lobby lists, lobby data) is read now, before the next result replaces it
+        if (!Event->bIOFailure)
+        {
+            Event->Prepared = Router.Prepare(Event->CallbackId, Event->GetPayload());
+        }
+
+        Events.Enqueue(Event); // Cannot fail, IsFull was checked and this is the only producer
+        ++NumQueued;
+        SteamAPI_ManualDispatch_FreeLastCallback(Pipe);
+    }
+}
+// - 1.4 - //
+int32 FSteamCallbackPump::DispatchQueued(double BudgetSeconds)
+{
+    // At least one event per frame, so a tiny budget can never stall the queue
+    const double Deadline = FPlatformTime::Seconds() + BudgetSeconds;
+    int32 Dispatched = 0;
+
+    FSteamCallbackEvent* Event = nullptr;
+    while (Events.Dequeue(Event))
+    {
+        --NumQueued;
+        if (Event->APICall != k_uAPICallInvalid)
+        {
+            Router.DispatchCallResult(Event->APICall, Event->CallbackId, Event->GetPayload(), Event->bIOFailure, Event->Prepared.Get());
+        }
+        else
+        {
+            Router.Dispatch(Event->CallbackId, Event->GetPayload(), Event->Prepared.Get());
+        }
+        ++Dispatched;
+        ReleaseEvent(Event);
+
+        if (FPlatformTime::Seconds() >= Deadline)
+        {
+            break;
+        }
+    }
+
+    if (NumQueued.load() > 0)
+    {
+        UE_LOG(LogSteamMultiplayer, Verbose, TEXT("Steam callback budget spent, %d callbacks carried to next frame."), NumQueued.load());
+    }
+    return Dispatched;
+}
+// - 1.5 - //
+FSteamCallbackEvent* FSteamCallbackPump::AcquireEvent()
+{
+    FSteamCallbackEvent* Pooled = nullptr;
+    if (FreeEvents.Dequeue(Pooled))
+    {
+        return Pooled;
+    }
+    else
+    {
+        return new FSteamCallbackEvent();
+    }
+}
+
+void FSteamCallbackPump::ReleaseEvent(FSteamCallbackEvent* Event)
+{
+    // Payload keeps its capacity, only the contents go
+    Event->CallbackId = 0;
+    Event->PayloadSize = 0;
+    Event->PayloadBlocks.Reset();
+    Event->Prepared.Reset();
+    Event->APICall = k_uAPICallInvalid;
+    Event->bIOFailure = false;
+
+    if (!FreeEvents.Enqueue(Event))
+    {
+        delete Event;
+    }
+}
+///////////////////////////////////////////
+// MORE COMING SOON  // A.S. - hajddeen //
+/////////////////////////////////////////
@@ -0,0 +1,131 @@
+// |------------------------------------|
+// |  !FOLLOW URBAN SHADOWS ON SOCIALS! |
+// |------------------------------------|
+//            \ (^ᴗ^) /
+//             \     /
+//              -----
+//              |   |
+//              |   |
+//              |_  |_ 
+////////////////////////////////////////////////////////////
+// STEAM P2P SESSIONS - Unreal 5.5 + Steamworks SDK 1.57 //
+//////////////////////////////////////////////////////////////////
+// LICENSE AGREEMENT // LICENSE AGREEMENT // LICENSE AGREEMENT //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                                                                                                                                                                                                                                          //
+// Last Updated: 03/12/2024                                                                                                                                                                                                                                //
+//                                                                                                                                                                                                                                                        //
+// 1. Grant of License                                                                                                                                                                                                                                   //
+// This license permits anyone to use, modify, and distribute the provided code (the "Code") in projects free of charge under the following conditions:                                                                                                 //
+// 1.1. The Code must only be used for lawful purposes.                                                                                                                                                                                                //
+// 1.2. The user must include proper credit in their project as described in Section 3 below.                                                                                                                                                         //
+//                                                                                                                                                                                                                                                   //
+// 2. Restrictions                                                                                                                                                                                                                                  //
+// 2.1. This Code cannot be sold, sublicensed, or redistributed as a standalone product or as part of a similar development toolkit.                                                                                                               //
+// 2.2. The Code must not be used for projects that violate local laws or promote harmful, discriminatory, or illegal activities.                                                                                                                 //
+// 2.3. The user must not remove, alter, or obscure this license agreement, attribution requirements, or copyright notices within the Code.                                                                                                      //
+//                                                                                                                                                                                                                                              //
+// 3. Attribution                                                                                                                                                                                                                              //
+// 3.1. The user must include the following credit in a visible location within their project (e.g., splash screen, credits screen, or documentation):                                                                                        //
+// "Steam Multiplayer Code developed by Adrian Szajewski. Used under license."                                                                                                                                                               //
+// 3.2. For distributed or published projects, a link to https://adrianszajewskidev.wordpress.com/ or other contact details must also be included if applicable.                                                                            //
+//                                                                                                                                                                                                                                         //
+// 4. Breach of Agreement                                                                                                                                                                                                                 //
+// 4.1. If this license is violated, the licensor reserves the right to revoke the user's rights to use the Code immediately.                                                                                                            //
+// 4.2. The licensor may take legal action to recover damages or enforce compliance, depending on the severity of the violation.                                                                                                        //
+// 4.3. Users found in breach of this license may be required to:                                                                                                                                                                      //
+// Remove the Code from their project(s).                                                                                                                                                                                             //
+// Cease distribution of any projects using the Code.                                                                                                                                                                                //
+//                                                                                                                                                                                                                                  //
+// 5. Disclaimer                                                                                                                                                                                                                   //
+// 5.1. The Code is provided "as is" without any warranty, express or implied. The licensor is not liable for any damages arising from the use or misuse of the Code.                                                             //
+// 5.2. It is the user's responsibility to ensure compatibility and safe usage of the Code in their projects.                                                                                                                    //
+//                                                                                                                                                                                                                              //
+// 6. Governing Law                                                                                                                                                                                                            //
+// This agreement shall be governed and construed in accordance with the laws of Poland. Any disputes arising under or in connection with this license will be subject to the exclusive jurisdiction of the courts of Poland. //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+/////////////////////////////////////////////////////////
+// INCLUDE //
+////////////
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "HAL/ThreadSafeBool.h"
+#include "Containers/CircularQueue.h"
+#include "SteamBackend.h"
+
+/////////////////////////////////////////////////////////////////////////////////////
+// STEAM CALLBACK PUMP - NOTES                                                     //
+/////////////////////////////////////////////////////////////////////////////////////
+// 1. Background thread runs SteamAPI_ManualDispatch_RunFrame / GetNextCallback.  //
+// 2. Payloads are copied out of Steam's buffer and prepared there (router       //
+//    prepare steps), then handed over on a bounded single producer ring.       //
+// 3. The game thread dispatches queued events until its time budget runs out, //
+//    whatever is left waits for the next frame.                              //
+// 4. Call results are fetched by handle (GetAPICallResult) as they complete //
+//    and routed to whoever waits on that SteamAPICall_t.                   //
+// 5. Dispatched events go back to a free ring and are reused with their   //
+//    payload capacity, steady state allocates nothing per callback.      //
+// 6. Ring full: the rest waits in Steam's queue for the next poll.      //
+//////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////
+// ONE CALLBACK, READY FOR DISPATCH   //
+////////////////////////////////////////
+struct FSteamCallbackEvent
+{
+    // Handlers cast the payload to Steam structs, so it is kept 16 byte aligned inline and on the heap
+    using FPayloadBlock = TAlignedBytes<16, 16>;
+
+    int32 CallbackId = 0;
+    int32 PayloadSize = 0;
+    TArray<FPayloadBlock, TInlineAllocator<16>> PayloadBlocks; // 256 bytes inline, most lobby / friends callbacks fit
+    FSteamCallbackRouter::FPreparedPtr Prepared;  // Result of the router prepare step, may be null
+    SteamAPICall_t APICall = k_uAPICallInvalid;   // Set for call results
+    bool bIOFailure = false;
+
+    uint8* GetPayload() { return reinterpret_cast<uint8*>(PayloadBlocks.GetData()); }
+    void SetPayloadSize(int32 NumBytes)
+    {
+        PayloadBlocks.SetNumUninitialized(FMath::DivideAndRoundUp(NumBytes, (int32)sizeof(FPayloadBlock)), EAllowShrinking::No);
+        PayloadSize = NumBytes;
+    }
+};
+/////////////////////////////
+// PUMP THREAD + HAND-OFF  //
+/////////////////////////////
+class URBANSHADOWS_API FSteamCallbackPump : public FRunnable
+{
+public:
+    FSteamCallbackPump(FSteamCallbackRouter& InRouter, HSteamPipe InPipe);
+    virtual ~FSteamCallbackPump();
+
+    bool Start();
+
+    // Game thread, returns how many events were dispatched
+    int32 DispatchQueued(double BudgetSeconds);
+    int32 GetNumQueued() const { return NumQueued.load(); }
+
+    //////////////////////////////////////////////
+    // FRunnable                               //
+    ////////////////////////////////////////////
+    virtual uint32 Run() override;
+    virtual void Stop() override { bStopRequested = true; }
+
+private:
+    FSteamCallbackRouter& Router;
+    HSteamPipe Pipe;
+    FRunnableThread* Thread;
+    FThreadSafeBool bStopRequested;
+    std::atomic<int32> NumQueued;
+
+    TCircularQueue<FSteamCallbackEvent*> Events;     // Pump thread -> game thread, owned while queued
+    TCircularQueue<FSteamCallbackEvent*> FreeEvents; // Game thread -> pump thread, owned while pooled
+
+    void PumpSteam();
+    FSteamCallbackEvent* AcquireEvent();
+    void ReleaseEvent(FSteamCallbackEvent* Event);
+};
+///////////////////////////////////////////
+// MORE COMING SOON  // A.S. - hajddeen //
+/////////////////////////////////////////
@@ -0,0 +1,232 @@
+// |------------------------------------|
+// |  !FOLLOW URBAN SHADOWS ON SOCIALS! |
+// |------------------------------------|
+//            \ (^ᴗ^) /
+//             \     /
+//              -----
+//              |   |
+//              |   |
+//              |_  |_
+////////////////////////////////////////////////////////////
+// STEAM P2P SESSIONS - Unreal 5.5 + Steamworks SDK 1.57 //
+//////////////////////////////////////////////////////////////////
+// LICENSE AGREEMENT // LICENSE AGREEMENT // LICENSE AGREEMENT //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                                                                                                                                                                                                                                          //
+// Last Updated: 03/12/2024                                                                                                                                                                                                                                //
+//                                                                                                                                                                                                                                                        //
+// 1. Grant of License                                                                                                                                                                                                                                  //
+// This license permits anyone to use, modify, and distribute the provided code (the "Code") in projects free of charge under the following conditions:                                                                                                 //
+// 1.1. The Code must only be used for lawful purposes.                                                                                                                                                                                               //
+// 1.2. The user must include proper credit in their project as described in Section 3 below.                                                                                                                                                        //
+//                                                                                                                                                                                                                                                   //
+// 2. Restrictions                                                                                                                                                                                                                                  //
+// 2.1. This Code cannot be sold, sublicensed, or redistributed as a standalone product or as part of a similar development toolkit.                                                                                                               //
+// 2.2. The Code must not be used for projects that violate local laws or promote harmful, discriminatory, or illegal activities.                                                                                                                 //
+// 2.3. The user must not remove, alter, or obscure this license agreement, attribution requirements, or copyright notices within the Code.                                                                                                      //
+//                                                                                                                                                                                                                                              //
+// 3. Attribution                                                                                                                                                                                                                              //
+// 3.1. The user must include the following credit in a visible location within their project (e.g., splash screen, credits screen, or documentation):                                                                                        //
+// "Steam Multiplayer Code developed by Adrian Szajewski. Used under license."                                                                                                                                                               //
+// 3.2. For distributed or published projects, a link to https://adrianszajewskidev.wordpress.com/ or other contact details must also be included if applicable.                                                                            //
+//                                                                                                                                                                                                                                         //
+// 4. Breach of Agreement                                                                                                                                                                                                                 //
+// 4.1. If this license is violated, the licensor reserves the right to revoke the user's rights to use the Code immediately.                                                                                                            //
+// 4.2. The licensor may take legal action to recover damages or enforce compliance, depending on the severity of the violation.                                                                                                        //
+// 4.3. Users found in breach of this license may be required to:                                                                                                                                                                      //
+// Remove the Code from their project(s).                                                                                                                                                                                             //
+// Cease distribution of any projects using the Code.                                                                                                                                                                                //
+//                                                                                                                                                                                                                                  //
+// 5. Disclaimer                                                                                                                                                                                                                   //
+// 5.1. The Code is provided "as is" without any warranty, express or implied. The licensor is not liable for any damages arising from the use or misuse of the Code.                                                             //
+// 5.2. It is the user's responsibility to ensure compatibility and safe usage of the Code in their projects.                                                                                                                    //
+//                                                                                                                                                                                                                              //
+// 6. Governing Law                                                                                                                                                                                                            //
+// This agreement shall be governed and construed in accordance with the laws of Poland. Any disputes arising under or in connection with this license will be subject to the exclusive jurisdiction of the courts of Poland. //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////
+// INCLUDE //
+////////////
+#include "SteamFriendsCache.h"
+#include "Algo/Sort.h"
+/////////////////////////
+// 1. Friends Cache  //
+/////////////////////////////////////////////
+// 1.1 - Rebuild from a friends list      //
+// 1.2 - Empty the cache                 //
+// 1.3 - Persona changed                //
+// 1.4 - Rich presence changed         //
+// 1.5 - Filter + sort into rows      //
+// 1.6 - Find a friend's row         //
+// 1.7 - Row as a Blueprint struct  //
+// 1.8 - Lobby from "connect"      //
+// 1.9 - Friend added or removed  //
+///////////////////////////////////
+// - 1.1 - //
+void FSteamFriendsCache::Rebuild(ISteamBackend& Steam, const TArray<uint64>& FriendIDs)
+{
+    Reset();
+    SteamIDs.Reserve(FriendIDs.Num());
+    Names.Reserve(FriendIDs.Num());
+    PersonaStates.Reserve(FriendIDs.Num());
+    LobbyIDs.Reserve(FriendIDs.Num());
+    Rows.Reserve(FriendIDs.Num());
+
+    for (const uint64 SteamID : FriendIDs)
+    {
+        AddFriend(Steam, CSteamID(SteamID));
+    }
+}
+// - 1.2 - //
+void FSteamFriendsCache::Reset()
+{
+    SteamIDs.Reset();
+    Names.Reset();
+    PersonaStates.Reset();
+    LobbyIDs.Reset();
+    Rows.Reset();
+}
+// - 1.3 - //
+bool FSteamFriendsCache::RefreshPersona(ISteamBackend& Steam, CSteamID FriendID)
+{
+    const int32 Row = FindRow(FriendID.ConvertToUint64());
+    if (Row == INDEX_NONE)
+    {
+        return false;
+    }
+
+    const char* Name = Steam.GetFriendPersonaName(FriendID);
+    const uint8 State = (uint8)Steam.GetFriendPersonaState(FriendID);
+    const bool bNameChanged = Name && !Names[Row].Equals(UTF8_TO_TCHAR(Name), ESearchCase::CaseSensitive);
+    if (bNameChanged)
+    {
+        Names[Row] = UTF8_TO_TCHAR(Name);
+    }
+
+    // Going offline ends whatever the presence said, Steam does not always send the clear
+    const bool bStateChanged = PersonaStates[Row] != State;
+    PersonaStates[Row] = State;
+    if (State == k_EPersonaStateOffline)
+    {
+        LobbyIDs[Row] = 0;
+    }
+    return bNameChanged || bStateChanged;
+}
+// - 1.4 - //
+bool FSteamFriendsCache::RefreshRichPresence(ISteamBackend& Steam, CSteamID FriendID)
+{
+    const int32 Row = FindRow(FriendID.ConvertToUint64());
+    if (Row == INDEX_NONE)
+    {
+        return false;
+    }
+    else
+    {
+        const uint64 LobbyID = ParseConnectLobby(Steam.GetFriendRichPresence(FriendID, ConnectKey));
+        const bool bChanged = LobbyIDs[Row] != LobbyID;
+        LobbyIDs[Row] = LobbyID;
+        return bChanged;
+    }
+}
+// - 1.5 - //
+void FSteamFriendsCache::Query(const FSteamFriendsQuery& InQuery, TArray<int32>& OutRows) const
+{
+    OutRows.Reset();
+    for (int32 Row = 0; Row < SteamIDs.Num(); ++Row)
+    {
+        if ((InQuery.bOnlineOnly && !IsOnline(Row)) || (InQuery.bJoinableOnly && LobbyIDs[Row] == 0))
+        {
+            continue;
+        }
+        else if (!InQuery.NameFilter.IsEmpty() && !Names[Row].Contains(InQuery.NameFilter, ESearchCase::IgnoreCase))
+        {
+            continue;
+        }
+        OutRows.Add(Row);
+    }
+
+    // In-place sort over row indices, the columns themselves never move
+    const bool bByStatus = InQuery.Sort == ESteamFriendSort::Status;
+    Algo::Sort(OutRows, [this, bByStatus](int32 A, int32 B)
+    {
+        if (bByStatus && GetStatusRank(A) != GetStatusRank(B))
+        {
+            return GetStatusRank(A) < GetStatusRank(B);
+        }
+        return Names[A].Compare(Names[B], ESearchCase::IgnoreCase) < 0;
+    });
+}
+// - 1.6 - //
+int32 FSteamFriendsCache::FindRow(uint64 SteamID) const
+{
+    const int32* Row = Rows.Find(SteamID);
+    return Row ? *Row : INDEX_NONE;
+}
+// - 1.7 - //
+void FSteamFriendsCache::GetInfo(int32 Row, FSteamFriendInfo& OutInfo) const
+{
+    OutInfo.PlayerName = Names[Row];
+    OutInfo.SteamID = SteamIDs[Row];
+    OutInfo.bOnline = IsOnline(Row);
+    OutInfo.bJoinable = LobbyIDs[Row] != 0;
+    OutInfo.LobbyID = LobbyIDs[Row];
+}
+// - 1.8 - //
+uint64 FSteamFriendsCache::ParseConnectLobby(const char* Connect)
+{
+    const int32 PrefixLen = FCStringAnsi::Strlen(ConnectLobbyPrefix);
+    if (!Connect || FCStringAnsi::Strncmp(Connect, ConnectLobbyPrefix, PrefixLen) != 0)
+    {
+        return 0;
+    }
+    else
+    {
+        // Anything that is not a lobby ID (stale or hand-written presence) counts as not joinable
+        const uint64 LobbyID = FCStringAnsi::Strtoui64(Connect + PrefixLen, nullptr, 10);
+        return CSteamID(LobbyID).IsLobby() ? LobbyID : 0;
+    }
+}
+// - 1.9 - //
+bool FSteamFriendsCache::AddFriend(ISteamBackend& Steam, CSteamID FriendID)
+{
+    const uint64 SteamID = FriendID.ConvertToUint64();
+    if (Rows.Contains(SteamID))
+    {
+        return false;
+    }
+    else
+    {
+        const char* Name = Steam.GetFriendPersonaName(FriendID);
+        Rows.Add(SteamID, SteamIDs.Num());
+        SteamIDs.Add(SteamID);
+        Names.Add(Name ? FString(UTF8_TO_TCHAR(Name)) : FString());
+        PersonaStates.Add((uint8)Steam.GetFriendPersonaState(FriendID));
+        LobbyIDs.Add(ParseConnectLobby(Steam.GetFriendRichPresence(FriendID, ConnectKey)));
+        return true;
+    }
+}
+
+bool FSteamFriendsCache::RemoveFriend(uint64 SteamID)
+{
+    int32 Row = INDEX_NONE;
+    if (!Rows.RemoveAndCopyValue(SteamID, Row))
+    {
+        return false;
+    }
+    else
+    {
+        // The last row moves into the gap, only its index entry needs fixing
+        SteamIDs.RemoveAtSwap(Row, 1, EAllowShrinking::No);
+        Names.RemoveAtSwap(Row, 1, EAllowShrinking::No);
+        PersonaStates.RemoveAtSwap(Row, 1, EAllowShrinking::No);
+        LobbyIDs.RemoveAtSwap(Row, 1, EAllowShrinking::No);
+        if (SteamIDs.IsValidIndex(Row))
+        {
+            Rows[SteamIDs[Row]] = Row;
+        }
+        return true;
+    }
+}
+///////////////////////////////////////////
+// MORE COMING SOON  // A.S. - hajddeen //
+/////////////////////////////////////////
@@ -0,0 +1,163 @@
+// |------------------------------------|
+// |  !FOLLOW URBAN SHADOWS ON SOCIALS! |
+// |------------------------------------|
+//            \ (^ᴗ^) /
+//             \     /
+//              -----
+//              |   |
+//              |   |
+//              |_  |_ 
+////////////////////////////////////////////////////////////
+// STEAM P2P SESSIONS - Unreal 5.5 + Steamworks SDK 1.57 //
+//////////////////////////////////////////////////////////////////
+// LICENSE AGREEMENT // LICENSE AGREEMENT // LICENSE AGREEMENT //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                                                                                                                                                                                                                                          //
+// Last Updated: 03/12/2024                                                                                                                                                                                                                                //
+//                                                                                                                                                                                                                                                        //
+// 1. Grant of License                                                                                                                                                                                                                                   //
+// This license permits anyone to use, modify, and distribute the provided code (the "Code") in projects free of charge under the following conditions:                                                                                                 //
+// 1.1. The Code must only be used for lawful purposes.                                                                                                                                                                                                //
+// 1.2. The user must include proper credit in their project as described in Section 3 below.                                                                                                                                                         //
+//                                                                                                                                                                                                                                                   //
+// 2. Restrictions                                                                                                                                                                                                                                  //
+// 2.1. This Code cannot be sold, sublicensed, or redistributed as a standalone product or as part of a similar development toolkit.                                                                                                               //
+// 2.2. The Code must not be used for projects that violate local laws or promote harmful, discriminatory, or illegal activities.                                                                                                                 //
+// 2.3. The user must not remove, alter, or obscure this license agreement, attribution requirements, or copyright notices within the Code.                                                                                                      //
+//                                                                                                                                                                                                                                              //
+// 3. Attribution                                                                                                                                                                                                                              //
+// 3.1. The user must include the following credit in a visible location within their project (e.g., splash screen, credits screen, or documentation):                                                                                        //
+// "Steam Multiplayer Code developed by Adrian Szajewski. Used under license."                                                                                                                                                               //
+// 3.2. For distributed or published projects, a link to https://adrianszajewskidev.wordpress.com/ or other contact details must also be included if applicable.                                                                            //
+//                                                                                                                                                                                                                                         //
+// 4. Breach of Agreement                                                                                                                                                                                                                 //
+// 4.1. If this license is violated, the licensor reserves the right to revoke the user's rights to use the Code immediately.                                                                                                            //
+// 4.2. The licensor may take legal action to recover damages or enforce compliance, depending on the severity of the violation.                                                                                                        //
+// 4.3. Users found in breach of this license may be required to:                                                                                                                                                                      //
+// Remove the Code from their project(s).                                                                                                                                                                                             //
+// Cease distribution of any projects using the Code.                                                                                                                                                                                //
+//                                                                                                                                                                                                                                  //
+// 5. Disclaimer                                                                                                                                                                                                                   //
+// 5.1. The Code is provided "as is" without any warranty, express or implied. The licensor is not liable for any damages arising from the use or misuse of the Code.                                                             //
+// 5.2. It is the user's responsibility to ensure compatibility and safe usage of the Code in their projects.                                                                                                                    //
+//                                                                                                                                                                                                                              //
+// 6. Governing Law                                                                                                                                                                                                            //
+// This agreement shall be governed and construed in accordance with the laws of Poland. Any disputes arising under or in connection with this license will be subject to the exclusive jurisdiction of the courts of Poland. //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+/////////////////////////////////////////////////////////
+// INCLUDE //
+////////////
+#include "CoreMinimal.h"
+#include "SteamBackend.h"
+#include "SteamFriendsCache.generated.h"
+
+UENUM(BlueprintType)
+enum class ESteamFriendSort : uint8
+{
+    Status, // Joinable, then online, then offline, each by name
+    Name
+};
+///////////////////////////////////////
+// FRIENDS LIST FILTER + ORDER       //
+///////////////////////////////////////
+USTRUCT(BlueprintType)
+struct FSteamFriendsQuery
+{
+    GENERATED_BODY()
+
+    // Case-insensitive part of the persona name, empty matches everyone
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Friends")
+    FString NameFilter;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Friends")
+    bool bOnlineOnly = false;
+
+    // Only friends whose rich presence points at a lobby
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Friends")
+    bool bJoinableOnly = false;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Friends")
+    ESteamFriendSort Sort = ESteamFriendSort::Status;
+};
+///////////////////////////////////////
+// STRUCT TO HOLD ONE FRIEND         //
+///////////////////////////////////////
+USTRUCT(BlueprintType)
+struct FSteamFriendInfo
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Friends")
+    FString PlayerName;
+
+    UPROPERTY()
+    uint64 SteamID = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Friends")
+    bool bOnline = false;
+
+    // Lobby published through rich presence, USteamMultiplayer::JoinFriend goes straight there
+    UPROPERTY(BlueprintReadOnly, Category = "Friends")
+    bool bJoinable = false;
+
+    UPROPERTY()
+    uint64 LobbyID = 0;
+};
+/////////////////////////////////////////////////////////////////////////////////////
+// STEAM FRIENDS CACHE - NOTES                                                     //
+/////////////////////////////////////////////////////////////////////////////////////
+// 1. One full read when the friends list is (re)built, after that only           //
+//    PersonaStateChange_t and FriendRichPresenceUpdate_t touch a single row,    //
+//    a relationship change adds or swap-removes one.                           //
+// 2. Columns instead of rows: filters and sorts walk the column they need     //
+//    and move row indices, nothing else. With a reused OutRows a query       //
+//    allocates nothing, 500+ friends per frame is fine.                     //
+// 3. Joinable = "connect" rich presence of the form "+connect_lobby <id>", //
+//    what the Steam overlay's "Join Game" hands to the game as well.      //
+// 4. Game thread only.                                                   //
+///////////////////////////////////////////////////////////////////////////
+class URBANSHADOWS_API FSteamFriendsCache
+{
+public:
+    static constexpr const char* ConnectKey = "connect";
+    static constexpr const char* ConnectLobbyPrefix = "+connect_lobby ";
+
+    void Rebuild(ISteamBackend& Steam, const TArray<uint64>& FriendIDs);
+    void Reset();
+
+    // Relationship changes, false when the row already is (or is not) there
+    bool AddFriend(ISteamBackend& Steam, CSteamID FriendID);
+    bool RemoveFriend(uint64 SteamID);
+
+    // False when the user is not a friend or nothing we keep changed
+    bool RefreshPersona(ISteamBackend& Steam, CSteamID FriendID);
+    bool RefreshRichPresence(ISteamBackend& Steam, CSteamID FriendID);
+
+    // Rows matching Query, in Query's order. OutRows keeps its capacity between calls
+    void Query(const FSteamFriendsQuery& InQuery, TArray<int32>& OutRows) const;
+
+    int32 Num() const { return SteamIDs.Num(); }
+    int32 FindRow(uint64 SteamID) const;
+    uint64 GetSteamID(int32 Row) const { return SteamIDs[Row]; }
+    const FString& GetName(int32 Row) const { return Names[Row]; }
+    uint64 GetLobbyID(int32 Row) const { return LobbyIDs[Row]; }
+    bool IsOnline(int32 Row) const { return PersonaStates[Row] != k_EPersonaStateOffline; }
+    void GetInfo(int32 Row, FSteamFriendInfo& OutInfo) const;
+
+    // Lobby from a "connect" value, 0 when it names none
+    static uint64 ParseConnectLobby(const char* Connect);
+
+private:
+    TArray<uint64> SteamIDs;
+    TArray<FString> Names;
+    TArray<uint8> PersonaStates; // EPersonaState
+    TArray<uint64> LobbyIDs;     // 0 = not joinable
+    TMap<uint64, int32> Rows;    // SteamID -> row
+
+    // Lower sorts first for ESteamFriendSort::Status
+    uint8 GetStatusRank(int32 Row) const { return LobbyIDs[Row] != 0 ? 0 : IsOnline(Row) ? 1 : 2; }
+};
+///////////////////////////////////////////
+// MORE COMING SOON  // A.S. - hajddeen //
+/////////////////////////////////////////
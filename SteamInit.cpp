@@ -0,0 +1,241 @@
+// |------------------------------------|
+// |  !FOLLOW URBAN SHADOWS ON SOCIALS! |
+// |------------------------------------|
+//            \ (^ᴗ^) /
+//             \     /
+//              -----
+//              |   |
+//              |   |
+//              |_  |_
+////////////////////////////////////////////////////////////
+// STEAM P2P SESSIONS - Unreal 5.5 + Steamworks SDK 1.57 //
+//////////////////////////////////////////////////////////////////
+// LICENSE AGREEMENT // LICENSE AGREEMENT // LICENSE AGREEMENT //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                                                                                                                                                                                                                                          //
+// Last Updated: 03/12/2024                                                                                                                                                                                                                                //
+//                                                                                                                                                                                                                                                        //
+// 1. Grant of License                                                                                                                                                                                                                                   //
+// This license permits anyone to use, modify, and distribute the provided code (the "Code") in projects free of charge under the following conditions:                                                                                                 //
+// 1.1. The Code must only be used for lawful purposes.                                                                                                                                                                                                //
+// 1.2. The user must include proper credit in their project as described in Section 3 below.                                                                                                                                                         //
+//                                                                                                                                                                                                                                                   //
+// 2. Restrictions                                                                                                                                                                                                                                  //
+// 2.1. This Code cannot be sold, sublicensed, or redistributed as a standalone product or as part of a similar development toolkit.                                                                                                               //
+// 2.2. The Code must not be used for projects that violate local laws or promote harmful, discriminatory, or illegal activities.                                                                                                                 //
+// 2.3. The user must not remove, alter, or obscure this license agreement, attribution requirements, or copyright notices within the Code.                                                                                                      //
+//                                                                                                                                                                                                                                              //
+// 3. Attribution                                                                                                                                                                                                                              //
+// 3.1. The user must include the following credit in a visible location within their project (e.g., splash screen, credits screen, or documentation):                                                                                        //
+// "Steam Multiplayer Code developed by Adrian Szajewski. Used under license."                                                                                                                                                               //
+// 3.2. For distributed or published projects, a link to https://adrianszajewskidev.wordpress.com/ or other contact details must also be included if applicable.                                                                            //
+//                                                                                                                                                                                                                                         //
+// 4. Breach of Agreement                                                                                                                                                                                                                 //
+// 4.1. If this license is violated, the licensor reserves the right to revoke the user's rights to use the Code immediately.                                                                                                            //
+// 4.2. The licensor may take legal action to recover damages or enforce compliance, depending on the severity of the violation.                                                                                                        //
+// 4.3. Users found in breach of this license may be required to:                                                                                                                                                                      //
+// Remove the Code from their project(s).                                                                                                                                                                                             //
+// Cease distribution of any projects using the Code.                                                                                                                                                                                //
+//                                                                                                                                                                                                                                  //
+// 5. Disclaimer                                                                                                                                                                                                                   //
+// 5.1. The Code is provided "as is" without any warranty, express or implied. The licensor is not liable for any damages arising from the use or misuse of the Code.                                                             //
+// 5.2. It is the user's responsibility to ensure compatibility and safe usage of the Code in their projects.                                                                                                                    //
+//                                                                                                                                                                                                                              //
+// 6. Governing Law                                                                                                                                                                                                            //
+// This agreement shall be governed and construed in accordance with the laws of Poland. Any disputes arising under or in connection with this license will be subject to the exclusive jurisdiction of the courts of Poland. //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////
+// INCLUDE //
+////////////
+#include "SteamInit.h"
+#include "SteamMultiplayer.h"
+#include "SteamMultiplayerStats.h"
+#include "SteamMapPreload.h"
+#include "SteamAvatarAtlas.h"
+#include "SteamStats.h"
+#include "HAL/PlatformTime.h"
+////////////////////////////
+// Steam Init - Internals //
+//////////////////////////////////////////////////////////////
+// 1. Prewarm phases that never finish stop holding Ready  //
+////////////////////////////////////////////////////////////
+namespace SteamInit
+{
+    constexpr double PrewarmTimeoutSeconds = 15.0;
+
+    float MsSince(double Start)
+    {
+        return (float)((FPlatformTime::Seconds() - Start) * 1000.0);
+    }
+}
+/////////////////////////
+// 1. Lifecycle       //
+//////////////////////////////////////////
+// 1.1 - Only for USteamMultiplayer    //
+// 1.2 - Initialize during startup    //
+// 1.3 - Teardown                    //
+//////////////////////////////////////
+// - 1.1 - //
+bool USteamInitSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+    return Outer && Outer->IsA<USteamMultiplayer>();
+}
+// - 1.2 - //
+void USteamInitSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    // InitializeSteam hands their caches to the callback preparers, so they must exist first
+    Collection.InitializeDependency<USteamMapPreloadSubsystem>();
+    Collection.InitializeDependency<USteamAvatarAtlasSubsystem>();
+    // Started by InitializeSteam, so it has to be there before it
+    Collection.InitializeDependency<USteamStatsSubsystem>();
+
+    USteamMultiplayer* Multiplayer = GetMultiplayer();
+    if (Multiplayer && Multiplayer->bInitializeSteamOnStartup && !IsRunningCommandlet())
+    {
+        StartSteam();
+    }
+}
+// - 1.3 - //
+void USteamInitSubsystem::Deinitialize()
+{
+    CancelPrewarm();
+    Super::Deinitialize();
+}
+/////////////////////////
+// 2. Startup         //
+////////////////////////////////////////////
+// 2.1 - Initialize + start prewarm      //
+// 2.2 - Cancel prewarm                  //
+// 2.3 - Prewarm tick                   //
+// 2.4 - Report the breakdown          //
+// 2.5 - Get the game instance        //
+///////////////////////////////////////
+// - 2.1 - //
+void USteamInitSubsystem::StartSteam()
+{
+    USteamMultiplayer* Multiplayer = GetMultiplayer();
+    if (!Multiplayer || State == ESteamInitState::Prewarming || (State == ESteamInitState::Ready && Multiplayer->IsSteamInitialized()))
+    {
+        return;
+    }
+
+    Timings = FSteamInitTimings();
+    StartTime = FPlatformTime::Seconds();
+    Multiplayer->InitializeSteam();
+    Timings.InitializeMs = SteamInit::MsSince(StartTime);
+    if (!Multiplayer->IsSteamInitialized())
+    {
+        State = ESteamInitState::Failed;
+        UE_LOG(LogSteamMultiplayer, Warning, TEXT("Steam startup failed after %.1f ms."), Timings.InitializeMs);
+        return;
+    }
+
+    ISteamBackend* Steam = Multiplayer->GetSteamBackend();
+    const double LocalUserStart = FPlatformTime::Seconds();
+    UE_LOG(LogSteamMultiplayer, Log, TEXT("Logged into Steam as: %s (SteamID: %llu)"), UTF8_TO_TCHAR(Steam->GetPersonaName()), Steam->GetLocalSteamID().ConvertToUint64());
+    Timings.LocalUserMs = SteamInit::MsSince(LocalUserStart);
+
+    // The friends list is a straight walk over the client's copy, nothing to wait for but the IPC
+    FriendsTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [Steam]()
+    {
+        TArray<uint64> Result;
+        const int32 NumFriends = Steam->GetFriendCount();
+        Result.Reserve(FMath::Max(NumFriends, 0));
+        for (int32 i = 0; i < NumFriends; ++i)
+        {
+            Result.Add(Steam->GetFriendByIndex(i).ConvertToUint64());
+        }
+        return Result;
+    });
+
+    bAvatarDone = false;
+    bFriendsDone = false;
+    bPingDone = false;
+    State = ESteamInitState::Prewarming;
+    PrewarmTicker = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &USteamInitSubsystem::TickPrewarm));
+}
+// - 2.2 - //
+void USteamInitSubsystem::CancelPrewarm()
+{
+    if (FriendsTask.IsValid())
+    {
+        FriendsTask.Wait();
+        FriendsTask = {};
+    }
+
+    if (PrewarmTicker.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(PrewarmTicker);
+        PrewarmTicker.Reset();
+    }
+
+    // Steam goes away, a later StartSteam starts over
+    State = ESteamInitState::NotStarted;
+}
+// - 2.3 - //
+bool USteamInitSubsystem::TickPrewarm(float DeltaTime)
+{
+    STEAM_MP_SCOPE(STAT_SteamInitPrewarm);
+
+    USteamMultiplayer* Multiplayer = GetMultiplayer();
+    if (!bAvatarDone && Multiplayer->PrewarmAvatar(Multiplayer->GetSteamBackend()->GetLocalSteamID()))
+    {
+        // Decode and upload finish on their own from here, the cache entry lands a frame or two later
+        bAvatarDone = true;
+        Timings.AvatarMs = SteamInit::MsSince(StartTime);
+    }
+
+    if (!bFriendsDone && FriendsTask.IsCompleted())
+    {
+        // Names, online state and joinable lobbies are read here, on the game thread like every later update
+        Multiplayer->RebuildFriendsCache(FriendsTask.GetResult());
+        FriendsTask = {};
+        bFriendsDone = true;
+        Timings.FriendsMs = SteamInit::MsSince(StartTime);
+        Timings.NumFriends = Multiplayer->GetFriendsCache().Num();
+    }
+
+    SteamNetworkPingLocation_t Location;
+    if (!bPingDone && Multiplayer->GetSteamBackend()->GetLocalPingLocation(Location) >= 0.f)
+    {
+        bPingDone = true;
+        Timings.PingLocationMs = SteamInit::MsSince(StartTime);
+    }
+
+    if (bAvatarDone && bFriendsDone && bPingDone)
+    {
+        FinishPrewarm(false);
+        return false;
+    }
+    else if (FPlatformTime::Seconds() - StartTime > SteamInit::PrewarmTimeoutSeconds && bFriendsDone)
+    {
+        FinishPrewarm(true);
+        return false;
+    }
+    return true;
+}
+// - 2.4 - //
+void USteamInitSubsystem::FinishPrewarm(bool bTimedOut)
+{
+    PrewarmTicker.Reset();
+    State = ESteamInitState::Ready;
+    Timings.bTimedOut = bTimedOut;
+    Timings.TotalMs = SteamInit::MsSince(StartTime);
+    Timings.ReadyAtSeconds = (float)(FPlatformTime::Seconds() - GStartTime);
+    SET_FLOAT_STAT(STAT_SteamStartupTime, Timings.TotalMs);
+
+    UE_LOG(LogSteamMultiplayer, Log, TEXT("Steam ready at %.2f s: init %.1f ms, user %.1f ms, avatar %.1f ms, friends %.1f ms (%d), ping location %.1f ms, total %.1f ms%s."),
+        Timings.ReadyAtSeconds, Timings.InitializeMs, Timings.LocalUserMs, Timings.AvatarMs, Timings.FriendsMs, Timings.NumFriends, Timings.PingLocationMs, Timings.TotalMs,
+        bTimedOut ? TEXT(" (timed out)") : TEXT(""));
+    OnSteamReady.Broadcast(Timings);
+}
+// - 2.5 - //
+USteamMultiplayer* USteamInitSubsystem::GetMultiplayer() const
+{
+    return Cast<USteamMultiplayer>(GetGameInstance());
+}
+///////////////////////////////////////////
+// MORE COMING SOON  // A.S. - hajddeen //
+/////////////////////////////////////////
@@ -0,0 +1,178 @@
+// |------------------------------------|
+// |  !FOLLOW URBAN SHADOWS ON SOCIALS! |
+// |------------------------------------|
+//            \ (^ᴗ^) /
+//             \     /
+//              -----
+//              |   |
+//              |   |
+//              |_  |_ 
+////////////////////////////////////////////////////////////
+// STEAM P2P SESSIONS - Unreal 5.5 + Steamworks SDK 1.57 //
+//////////////////////////////////////////////////////////////////
+// LICENSE AGREEMENT // LICENSE AGREEMENT // LICENSE AGREEMENT //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                                                                                                                                                                                                                                          //
+// Last Updated: 03/12/2024                                                                                                                                                                                                                                //
+//                                                                                                                                                                                                                                                        //
+// 1. Grant of License                                                                                                                                                                                                                                   //
+// This license permits anyone to use, modify, and distribute the provided code (the "Code") in projects free of charge under the following conditions:                                                                                                 //
+// 1.1. The Code must only be used for lawful purposes.                                                                                                                                                                                                //
+// 1.2. The user must include proper credit in their project as described in Section 3 below.                                                                                                                                                         //
+//                                                                                                                                                                                                                                                   //
+// 2. Restrictions                                                                                                                                                                                                                                  //
+// 2.1. This Code cannot be sold, sublicensed, or redistributed as a standalone product or as part of a similar development toolkit.                                                                                                               //
+// 2.2. The Code must not be used for projects that violate local laws or promote harmful, discriminatory, or illegal activities.                                                                                                                 //
+// 2.3. The user must not remove, alter, or obscure this license agreement, attribution requirements, or copyright notices within the Code.                                                                                                      //
+//                                                                                                                                                                                                                                              //
+// 3. Attribution                                                                                                                                                                                                                              //
+// 3.1. The user must include the following credit in a visible location within their project (e.g., splash screen, credits screen, or documentation):                                                                                        //
+// "Steam Multiplayer Code developed by Adrian Szajewski. Used under license."                                                                                                                                                               //
+// 3.2. For distributed or published projects, a link to https://adrianszajewskidev.wordpress.com/ or other contact details must also be included if applicable.                                                                            //
+//                                                                                                                                                                                                                                         //
+// 4. Breach of Agreement                                                                                                                                                                                                                 //
+// 4.1. If this license is violated, the licensor reserves the right to revoke the user's rights to use the Code immediately.                                                                                                            //
+// 4.2. The licensor may take legal action to recover damages or enforce compliance, depending on the severity of the violation.                                                                                                        //
+// 4.3. Users found in breach of this license may be required to:                                                                                                                                                                      //
+// Remove the Code from their project(s).                                                                                                                                                                                             //
+// Cease distribution of any projects using the Code.                                                                                                                                                                                //
+//                                                                                                                                                                                                                                  //
+// 5. Disclaimer                                                                                                                                                                                                                   //
+// 5.1. The Code is provided "as is" without any warranty, express or implied. The licensor is not liable for any damages arising from the use or misuse of the Code.                                                             //
+// 5.2. It is the user's responsibility to ensure compatibility and safe usage of the Code in their projects.                                                                                                                    //
+//                                                                                                                                                                                                                              //
+// 6. Governing Law                                                                                                                                                                                                            //
+// This agreement shall be governed and construed in accordance with the laws of Poland. Any disputes arising under or in connection with this license will be subject to the exclusive jurisdiction of the courts of Poland. //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+/////////////////////////////////////////////////////////
+// INCLUDE //
+////////////
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Containers/Ticker.h"
+#include "Tasks/Task.h"
+#include "steam/steam_api.h"
+#include "SteamInit.generated.h"
+
+class USteamMultiplayer;
+
+/////////////////////////////////////////////////////////////////////////////////////
+// STEAM INIT - NOTES                                                              //
+/////////////////////////////////////////////////////////////////////////////////////
+// 1. SteamAPI_Init runs while the game instance starts, under the startup load,  //
+//    never on a frame Blueprint picked.                                         //
+// 2. Prewarm runs next to the first frames: the local avatar is decoded on a   //
+//    worker, the friends list is read on a task into the friends cache, the   //
+//    ping location is polled. The main menu does not wait for any of it.     //
+// 3. Every phase is timed, OnSteamReady hands the breakdown out once.       //
+// 4. Starting again while running or ready does nothing.                   //
+/////////////////////////////////////////////////////////////////////////////
+
+UENUM(BlueprintType)
+enum class ESteamInitState : uint8
+{
+    NotStarted,
+    Prewarming, // Steam is up and usable, prewarm still running
+    Ready,
+    Failed
+};
+
+USTRUCT(BlueprintType)
+struct FSteamInitTimings
+{
+    GENERATED_BODY()
+
+    // SteamAPI_Init plus callback and socket driver setup
+    UPROPERTY(BlueprintReadOnly, Category = "Steam|Init")
+    float InitializeMs = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Steam|Init")
+    float LocalUserMs = 0.f;
+
+    // Until the local avatar is decoded and cached, including Steam's download
+    UPROPERTY(BlueprintReadOnly, Category = "Steam|Init")
+    float AvatarMs = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Steam|Init")
+    float FriendsMs = 0.f;
+
+    // Until the relay network measured where we are, needed for ping sorted searches
+    UPROPERTY(BlueprintReadOnly, Category = "Steam|Init")
+    float PingLocationMs = 0.f;
+
+    // Start of initialization to the end of prewarm, phases overlap so this is not their sum
+    UPROPERTY(BlueprintReadOnly, Category = "Steam|Init")
+    float TotalMs = 0.f;
+
+    // Seconds since the engine started when prewarm finished
+    UPROPERTY(BlueprintReadOnly, Category = "Steam|Init")
+    float ReadyAtSeconds = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Steam|Init")
+    int32 NumFriends = 0;
+
+    // Phases that gave up after PrewarmTimeoutSeconds (ping location without relay access, avatar never arriving)
+    UPROPERTY(BlueprintReadOnly, Category = "Steam|Init")
+    bool bTimedOut = false;
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnSteamReady, const FSteamInitTimings&, Timings);
+////////////////
+// MAIN BODY //
+////////////////
+UCLASS()
+class URBANSHADOWS_API USteamInitSubsystem : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    //////////////////////////////////////////////
+    // 1. Subsystem Lifecycle                  //
+    ////////////////////////////////////////////
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    //////////////////////////////////////////////
+    // 2. Startup                              //
+    ////////////////////////////////////////////
+    // Initializes Steam if needed and prewarms, does nothing while running or once ready
+    UFUNCTION(BlueprintCallable, Category = "Steam|Init")
+    void StartSteam();
+
+    // Stops prewarm and waits for the friends task, before the backend shuts down
+    void CancelPrewarm();
+
+    UFUNCTION(BlueprintPure, Category = "Steam|Init")
+    ESteamInitState GetInitState() const { return State; }
+
+    UFUNCTION(BlueprintPure, Category = "Steam|Init")
+    FSteamInitTimings GetInitTimings() const { return Timings; }
+
+    // Fired once when prewarm finishes, listeners bound later should check GetInitState
+    UPROPERTY(BlueprintAssignable, Category = "Steam|Init")
+    FOnSteamReady OnSteamReady;
+
+private:
+    //////////////////////////////////////////////
+    // 1. Private Data Members                 //
+    ////////////////////////////////////////////
+    ESteamInitState State = ESteamInitState::NotStarted;
+    FSteamInitTimings Timings;
+    double StartTime = 0.0;
+    FTSTicker::FDelegateHandle PrewarmTicker;
+
+    bool bAvatarDone = false;
+    bool bFriendsDone = false;
+    bool bPingDone = false;
+
+    UE::Tasks::TTask<TArray<uint64>> FriendsTask; // IDs only, names and presence are read into the friends cache
+
+    USteamMultiplayer* GetMultiplayer() const;
+    bool TickPrewarm(float DeltaTime);
+    void FinishPrewarm(bool bTimedOut);
+};
+///////////////////////////////////////////
+// MORE COMING SOON  // A.S. - hajddeen //
+/////////////////////////////////////////
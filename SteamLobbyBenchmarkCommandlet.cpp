@@ -0,0 +1,893 @@
+// |------------------------------------|
+// |  !FOLLOW URBAN SHADOWS ON SOCIALS! |
+// |------------------------------------|
+//            \ (^ᴗ^) /
+//             \     /
+//              -----
+//              |   |
+//              |   |
+//              |_  |_
+////////////////////////////////////////////////////////////
+// STEAM P2P SESSIONS - Unreal 5.5 + Steamworks SDK 1.57 //
+//////////////////////////////////////////////////////////////////
+// LICENSE AGREEMENT // LICENSE AGREEMENT // LICENSE AGREEMENT //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                                                                                                                                                                                                                                          //
+// Last Updated: 03/12/2024                                                                                                                                                                                                                                //
+//                                                                                                                                                                                                                                                        //
+// 1. Grant of License                                                                                                                                                                                                                                   //
+// This license permits anyone to use, modify, and distribute the provided code (the "Code") in projects free of charge under the following conditions:                                                                                                 //
+// 1.1. The Code must only be used for lawful purposes.                                                                                                                                                                                                //
+// 1.2. The user must include proper credit in their project as described in Section 3 below.                                                                                                                                                         //
+//                                                                                                                                                                                                                                                   //
+// 2. Restrictions                                                                                                                                                                                                                                  //
+// 2.1. This Code cannot be sold, sublicensed, or redistributed as a standalone product or as part of a similar development toolkit.                                                                                                               //
+// 2.2. The Code must not be used for projects that violate local laws or promote harmful, discriminatory, or illegal activities.                                                                                                                 //
+// 2.3. The user must not remove, alter, or obscure this license agreement, attribution requirements, or copyright notices within the Code.                                                                                                      //
+//                                                                                                                                                                                                                                              //
+// 3. Attribution                                                                                                                                                                                                                              //
+// 3.1. The user must include the following credit in a visible location within their project (e.g., splash screen, credits screen, or documentation):                                                                                        //
+// "Steam Multiplayer Code developed by Adrian Szajewski. Used under license."                                                                                                                                                               //
+// 3.2. For distributed or published projects, a link to https://adrianszajewskidev.wordpress.com/ or other contact details must also be included if applicable.                                                                            //
+//                                                                                                                                                                                                                                         //
+// 4. Breach of Agreement                                                                                                                                                                                                                 //
+// 4.1. If this license is violated, the licensor reserves the right to revoke the user's rights to use the Code immediately.                                                                                                            //
+// 4.2. The licensor may take legal action to recover damages or enforce compliance, depending on the severity of the violation.                                                                                                        //
+// 4.3. Users found in breach of this license may be required to:                                                                                                                                                                      //
+// Remove the Code from their project(s).                                                                                                                                                                                             //
+// Cease distribution of any projects using the Code.                                                                                                                                                                                //
+//                                                                                                                                                                                                                                  //
+// 5. Disclaimer                                                                                                                                                                                                                   //
+// 5.1. The Code is provided "as is" without any warranty, express or implied. The licensor is not liable for any damages arising from the use or misuse of the Code.                                                             //
+// 5.2. It is the user's responsibility to ensure compatibility and safe usage of the Code in their projects.                                                                                                                    //
+//                                                                                                                                                                                                                              //
+// 6. Governing Law                                                                                                                                                                                                            //
+// This agreement shall be governed and construed in accordance with the laws of Poland. Any disputes arising under or in connection with this license will be subject to the exclusive jurisdiction of the courts of Poland. //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////
+// INCLUDE //
+////////////
+#include "SteamLobbyBenchmarkCommandlet.h"
+#include "SteamMultiplayer.h"
+#include "SteamQuickMatch.h"
+#include "SteamStats.h"
+#include "SteamLobbyChat.h"
+#include "FakeSteamBackend.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+////////////////////////////////
+// Benchmark - Internals     //
+////////////////////////////////////////////////////////////////////
+// 1. Each sample times one call, setup work is outside the timer //
+// 2. Simulated steps are 1ms so latency results are 1ms accurate //
+//////////////////////////////////////////////////////////////////
+namespace SteamBenchmark
+{
+    constexpr float SimStepSeconds = 0.001f;
+    constexpr int32 MaxSimSteps = 60 * 1000; // One simulated minute per wait
+
+    FFakeSteamBackend* GetFake(USteamMultiplayer* Instance)
+    {
+        ISteamBackend* Backend = Instance->GetSteamBackend();
+        return Backend && Backend->IsFake() ? static_cast<FFakeSteamBackend*>(Backend) : nullptr;
+    }
+
+    // Pumps the fake until nothing is queued, false if it never drained
+    bool Drain(FFakeSteamBackend& Fake)
+    {
+        for (int32 Step = 0; Step < MaxSimSteps; ++Step)
+        {
+            if (Fake.GetNumPendingCallbacks() == 0)
+            {
+                return true;
+            }
+            Fake.Tick(SimStepSeconds);
+        }
+        return Fake.GetNumPendingCallbacks() == 0;
+    }
+
+    // Fake and core ticker on the same simulated clock, for code that waits on tickers (timeouts, staggering)
+    void Step(FFakeSteamBackend& Fake)
+    {
+        Fake.Tick(SimStepSeconds);
+        FTSTicker::GetCoreTicker().Tick(SimStepSeconds);
+    }
+
+    bool IsMember(FFakeSteamBackend& Fake, FSteamLobbyId LobbyID)
+    {
+        const CSteamID Lobby = LobbyID.ToSteamID();
+        for (int32 i = 0; i < Fake.GetNumLobbyMembers(Lobby); ++i)
+        {
+            if (Fake.GetLobbyMemberByIndex(Lobby, i) == Fake.GetLocalSteamID())
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+}
+//////////////////////////////
+// Benchmark Game Instance //
+////////////////////////////////////////////////////////
+// 1. Map load reported at once, no world to travel. //
+//////////////////////////////////////////////////////
+bool USteamBenchmarkMultiplayer::TravelForHostMigration(bool bAsNewHost)
+{
+    NotifyMigrationMapLoaded();
+    return true;
+}
+//////////////////////////
+// Constructor - Notes //
+////////////////////////////////////////////////////////
+// 1. No world, no editor, runs fine with -nullrhi.   //
+//////////////////////////////////////////////////////
+USteamLobbyBenchmarkCommandlet::USteamLobbyBenchmarkCommandlet()
+    : Iterations(50)
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = false;
+    LogToConsole = true;
+}
+/////////////////////////
+// 0. Entry Point     //
+////////////////////////////////////////
+int32 USteamLobbyBenchmarkCommandlet::Main(const FString& Params)
+{
+    FString OutputPath = FPaths::ProjectSavedDir() / TEXT("Benchmarks") / TEXT("SteamLobbyBenchmark.json");
+    FString BaselinePath;
+    float Tolerance = 0.15f;
+
+    FParse::Value(*Params, TEXT("Output="), OutputPath);
+    FParse::Value(*Params, TEXT("Baseline="), BaselinePath);
+    FParse::Value(*Params, TEXT("Tolerance="), Tolerance);
+    FParse::Value(*Params, TEXT("Iterations="), Iterations);
+    Iterations = FMath::Max(Iterations, 1);
+
+    Results.Reset();
+    RunLobbyListBenchmarks();
+    RunLobbyMemberBenchmarks();
+    RunAvatarUploadBenchmark();
+    RunEndToEndBenchmark();
+    RunQuickMatchBenchmark();
+    RunFriendsBenchmark();
+    RunStatsBenchmark();
+    RunLobbyChatBenchmark();
+    RunHostMigrationBenchmark();
+
+    for (const FBenchmarkResult& Result : Results)
+    {
+        UE_LOG(LogSteamMultiplayer, Display, TEXT("%-32s n=%4d  mean %10.2fus  p50 %10.2fus  p99 %10.2fus  min %10.2fus"),
+            *Result.Name, Result.Iterations, Result.MeanUs, Result.P50Us, Result.P99Us, Result.MinUs);
+    }
+
+    if (!WriteResults(OutputPath))
+    {
+        return 1;
+    }
+    else if (!BaselinePath.IsEmpty() && !CompareToBaseline(BaselinePath, Tolerance))
+    {
+        return 1;
+    }
+    return 0;
+}
+/////////////////////////
+// 1. Results         //
+////////////////////////////////////////
+// 1.1 - Reduce samples to stats     //
+// 1.2 - Time a body N times        //
+/////////////////////////////////////
+// - 1.1 - //
+void USteamLobbyBenchmarkCommandlet::AddResult(const FString& Name, TArray<double>& SamplesUs)
+{
+    if (SamplesUs.Num() == 0)
+    {
+        UE_LOG(LogSteamMultiplayer, Warning, TEXT("Benchmark %s produced no samples."), *Name);
+        return;
+    }
+    else
+    {
+        SamplesUs.Sort();
+
+        double Sum = 0.0;
+        for (double Sample : SamplesUs)
+        {
+            Sum += Sample;
+        }
+
+        FBenchmarkResult& Result = Results.AddDefaulted_GetRef();
+        Result.Name = Name;
+        Result.Iterations = SamplesUs.Num();
+        Result.MeanUs = Sum / SamplesUs.Num();
+        Result.P50Us = SamplesUs[SamplesUs.Num() / 2];
+        Result.P99Us = SamplesUs[FMath::Min(SamplesUs.Num() - 1, (SamplesUs.Num() * 99) / 100)];
+        Result.MinUs = SamplesUs[0];
+    }
+}
+// - 1.2 - //
+void USteamLobbyBenchmarkCommandlet::Measure(const FString& Name, int32 NumIterations, TFunctionRef<void()> Body, TFunction<void()> Setup)
+{
+    TArray<double> SamplesUs;
+    SamplesUs.Reserve(NumIterations);
+
+    // One untimed warm-up run so first-touch allocations do not skew p99
+    if (Setup)
+    {
+        Setup();
+    }
+    Body();
+
+    for (int32 i = 0; i < NumIterations; ++i)
+    {
+        if (Setup)
+        {
+            Setup();
+        }
+        const double Start = FPlatformTime::Seconds();
+        Body();
+        SamplesUs.Add((FPlatformTime::Seconds() - Start) * 1000000.0);
+    }
+    AddResult(Name, SamplesUs);
+}
+/////////////////////////
+// 2. Benchmarks      //
+////////////////////////////////////////////////
+// 2.1 - Game instance on the fake backend   //
+// 2.2 - Tear it down                       //
+// 2.3 - Lobby list materialization        //
+// 2.4 - Lobby members, avatars, roster   //
+// 2.5 - Single avatar texture upload    //
+// 2.6 - Host -> list -> join latency   //
+// 2.7 - Quick match vs serial joins   //
+// 2.8 - Friends list + join friend   //
+// 2.9 - Stats batching + pages      //
+// 2.10 - Lobby chat ring + render  //
+// 2.11 - Host left -> re-hosted   //
+////////////////////////////////////
+// - 2.1 - //
+USteamMultiplayer* USteamLobbyBenchmarkCommandlet::CreateInstance(int32 NumLobbies, float LatencyMs, float FailureRate, int32 NumFriends) const
+{
+    USteamMultiplayer* Instance = NewObject<USteamBenchmarkMultiplayer>(GetTransientPackage());
+    Instance->AddToRoot();
+    Instance->bUseFakeSteamBackend = true;
+    Instance->FakeSteamConfig.NumLobbies = NumLobbies;
+    Instance->FakeSteamConfig.MinLatencyMs = LatencyMs;
+    Instance->FakeSteamConfig.MaxLatencyMs = LatencyMs * 6.f;
+    Instance->FakeSteamConfig.FailureRate = FailureRate;
+    Instance->FakeSteamConfig.NumFriends = NumFriends;
+    Instance->InitializeSteam();
+
+    // The commandlet pumps the fake itself, the core ticker is not running here
+    if (Instance->BackendTicker.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(Instance->BackendTicker);
+        Instance->BackendTicker.Reset();
+    }
+    return Instance;
+}
+// - 2.2 - //
+void USteamLobbyBenchmarkCommandlet::DestroyInstance(USteamMultiplayer* Instance) const
+{
+    Instance->StopLobbySearchPaging();
+    Instance->ClearAvatarCache();
+    Instance->ShutdownSteam();
+    Instance->RemoveFromRoot();
+    Instance->MarkAsGarbage();
+}
+// - 2.3 - //
+void USteamLobbyBenchmarkCommandlet::RunLobbyListBenchmarks()
+{
+    for (int32 NumLobbies : { 10, 100, 1000 })
+    {
+        USteamMultiplayer* Instance = CreateInstance(NumLobbies, 0.f);
+        FFakeSteamBackend* Fake = SteamBenchmark::GetFake(Instance);
+
+        // One real search so the fake holds a result list, then replay the callback
+        FLobbySearchQuery Query;
+        Query.MaxResults = NumLobbies;
+        Query.PageSize = NumLobbies;
+        Instance->FindLobbies(Query);
+        if (!Fake || !SteamBenchmark::Drain(*Fake) || Instance->FoundLobbies.Num() == 0)
+        {
+            UE_LOG(LogSteamMultiplayer, Error, TEXT("Lobby list benchmark (%d) got no results from the fake backend."), NumLobbies);
+            DestroyInstance(Instance);
+            continue;
+        }
+
+        LobbyMatchList_t Payload = {};
+        Payload.m_nLobbiesMatching = Instance->FoundLobbies.Num();
+        FSteamLobbyListSnapshot Snapshot;
+        for (const FLobbyInfoData& Lobby : Instance->FoundLobbies)
+        {
+            Snapshot.LobbyIDs.Add(Lobby.LobbyId.ToSteamID());
+            Snapshot.PingMs.Add(Lobby.PingMs);
+        }
+        const int32 SearchHandle = Instance->ActiveSearchHandle > 0 ? Instance->ActiveSearchHandle : Instance->NextSearchHandle - 1;
+
+        auto Deliver = [Instance, &Payload, &Snapshot, SearchHandle]()
+        {
+            Instance->ActiveSearchHandle = SearchHandle;
+            Instance->OnLobbyListReceived(&Payload, Snapshot);
+        };
+
+        // Cold: every row is new. Warm: same rows again, only the diff pass runs.
+        Measure(FString::Printf(TEXT("lobby_list_cold_%d"), NumLobbies), Iterations, Deliver, [Instance]()
+        {
+            Instance->FoundLobbies.Reset();
+            Instance->LobbyIndex.Reset();
+        });
+        Measure(FString::Printf(TEXT("lobby_list_warm_%d"), NumLobbies), Iterations, Deliver);
+
+        DestroyInstance(Instance);
+    }
+}
+// - 2.4 - //
+void USteamLobbyBenchmarkCommandlet::RunLobbyMemberBenchmarks()
+{
+    for (int32 NumMembers : { 4, 16, 64 })
+    {
+        USteamMultiplayer* Instance = CreateInstance(0, 0.f);
+        FFakeSteamBackend* Fake = SteamBenchmark::GetFake(Instance);
+        if (!Fake)
+        {
+            DestroyInstance(Instance);
+            continue;
+        }
+        Instance->CurrentLobbyId = FSteamLobbyId(Fake->AddSimulatedLobby(NumMembers, NumMembers));
+
+        // Cold: every avatar decoded and uploaded. Warm: every avatar a cache hit.
+        Measure(FString::Printf(TEXT("lobby_members_cold_%d"), NumMembers), Iterations, [Instance]()
+        {
+            Instance->GetLobbyMembersWithAvatars();
+        }, [Instance]()
+        {
+            Instance->ClearAvatarCache();
+        });
+        Measure(FString::Printf(TEXT("lobby_members_warm_%d"), NumMembers), Iterations, [Instance]()
+        {
+            Instance->GetLobbyMembersWithAvatars();
+        });
+
+        // Roster: one member flips ready, only that member's watched keys are read back
+        Instance->RebuildLobbyRoster(Instance->CurrentLobbyId);
+        const CSteamID LobbyID = Instance->CurrentLobbyId.ToSteamID();
+        const CSteamID MemberID = Fake->GetLobbyMemberByIndex(LobbyID, NumMembers - 1);
+        bool bReady = false;
+        Measure(FString::Printf(TEXT("lobby_roster_member_update_%d"), NumMembers), Iterations, [Fake, LobbyID, MemberID, &bReady]()
+        {
+            bReady = !bReady;
+            Fake->SetSimulatedMemberData(LobbyID, MemberID, FSteamLobbyRoster::ReadyKey, bReady ? "1" : "0");
+            SteamBenchmark::Drain(*Fake);
+        });
+
+        DestroyInstance(Instance);
+    }
+}
+// - 2.5 - //
+void USteamLobbyBenchmarkCommandlet::RunAvatarUploadBenchmark()
+{
+    USteamMultiplayer* Instance = CreateInstance(0, 0.f);
+    ISteamBackend* Steam = Instance->GetSteamBackend();
+    const int AvatarHandle = Steam->GetLargeFriendAvatar(Steam->GetLocalSteamID());
+
+    Measure(TEXT("avatar_texture_upload"), Iterations, [Instance, AvatarHandle]()
+    {
+        Instance->GetAvatarTexture(AvatarHandle);
+    });
+
+    DestroyInstance(Instance);
+}
+// - 2.6 - //
+void USteamLobbyBenchmarkCommandlet::RunEndToEndBenchmark()
+{
+    USteamMultiplayer* Instance = CreateInstance(100, 20.f);
+    FFakeSteamBackend* Fake = SteamBenchmark::GetFake(Instance);
+    if (!Fake)
+    {
+        DestroyInstance(Instance);
+        return;
+    }
+
+    TArray<double> SimulatedUs;
+    TArray<double> CpuUs;
+    for (int32 i = 0; i < Iterations; ++i)
+    {
+        const double SimStart = Fake->GetSimulatedTime();
+        double CpuTotal = 0.0;
+        double CpuStart = FPlatformTime::Seconds();
+
+        // Host
+        Instance->HostGameWithSteamMatchmaking();
+        SteamBenchmark::Drain(*Fake);
+        const FSteamLobbyId HostedLobby = Instance->CurrentLobbyId;
+
+        // List, one page so the paging ticker is never needed
+        FLobbySearchQuery Query;
+        Query.MinOpenSlots = 1;
+        Query.PageSize = Query.MaxResults;
+        Instance->FindLobbies(Query);
+        SteamBenchmark::Drain(*Fake);
+
+        const FLobbyInfoData* Target = Instance->FoundLobbies.FindByPredicate([HostedLobby](const FLobbyInfoData& Lobby)
+        {
+            return Lobby.LobbyId != HostedLobby;
+        });
+        if (!HostedLobby.IsValid() || !Target)
+        {
+            UE_LOG(LogSteamMultiplayer, Error, TEXT("End-to-end benchmark could not host or find a lobby (iteration %d)."), i);
+            break;
+        }
+
+        // Join
+        const FSteamLobbyId TargetLobby = Target->LobbyId;
+        Instance->JoinLobby(TargetLobby);
+        SteamBenchmark::Drain(*Fake);
+        CpuTotal += FPlatformTime::Seconds() - CpuStart;
+
+        if (Instance->CurrentLobbyId == TargetLobby)
+        {
+            SimulatedUs.Add((Fake->GetSimulatedTime() - SimStart) * 1000000.0);
+            CpuUs.Add(CpuTotal * 1000000.0);
+        }
+
+        // Leave both lobbies so every iteration starts from the same world
+        Fake->LeaveLobby(TargetLobby.ToSteamID());
+        Fake->LeaveLobby(HostedLobby.ToSteamID());
+        SteamBenchmark::Drain(*Fake);
+    }
+
+    AddResult(TEXT("host_list_join_simulated"), SimulatedUs);
+    AddResult(TEXT("host_list_join_cpu"), CpuUs);
+
+    DestroyInstance(Instance);
+}
+// - 2.7 - //
+void USteamLobbyBenchmarkCommandlet::RunQuickMatchBenchmark()
+{
+    // Contended world: every third join fails, so retries dominate time-to-match
+    USteamMultiplayer* Instance = CreateInstance(200, 20.f, 0.33f);
+    FFakeSteamBackend* Fake = SteamBenchmark::GetFake(Instance);
+    if (!Fake)
+    {
+        DestroyInstance(Instance);
+        return;
+    }
+
+    FSteamQuickMatchSettings Settings;
+    Settings.Query.MinOpenSlots = 1;
+
+    TArray<double> SerialUs;
+    TArray<double> QuickMatchUs;
+    for (int32 i = 0; i < Iterations; ++i)
+    {
+        // Today's flow: list, then join rows one after another until one sticks
+        double SimStart = Fake->GetSimulatedTime();
+        Instance->FindLobbies(Settings.Query);
+        SteamBenchmark::Drain(*Fake);
+
+        TArray<FSteamLobbyId> Candidates;
+        FSteamQuickMatch::RankCandidates(Instance->FoundLobbies, Settings, Candidates);
+        for (const FSteamLobbyId& LobbyID : Candidates)
+        {
+            Instance->JoinLobby(LobbyID);
+            SteamBenchmark::Drain(*Fake);
+            if (SteamBenchmark::IsMember(*Fake, LobbyID))
+            {
+                SerialUs.Add((Fake->GetSimulatedTime() - SimStart) * 1000000.0);
+                Fake->LeaveLobby(LobbyID.ToSteamID());
+                break;
+            }
+        }
+        SteamBenchmark::Drain(*Fake);
+
+        // Quick match: same search and ranking, joins raced
+        SimStart = Fake->GetSimulatedTime();
+        TFuture<TSteamAsyncResult<FSteamLobbyId>> Match = Instance->QuickMatchAsync(Settings);
+        for (int32 Step = 0; Step < SteamBenchmark::MaxSimSteps && !Match.IsReady(); ++Step)
+        {
+            SteamBenchmark::Step(*Fake);
+        }
+
+        const TSteamAsyncResult<FSteamLobbyId> Result = Match.IsReady() ? Match.Get() : TSteamAsyncResult<FSteamLobbyId>(ESteamAsyncStatus::TimedOut);
+        if (Result.IsSuccess())
+        {
+            QuickMatchUs.Add((Fake->GetSimulatedTime() - SimStart) * 1000000.0);
+            Fake->LeaveLobby(Result.Value.ToSteamID());
+        }
+
+        // Losing joins land and get left before the next round
+        for (int32 Step = 0; Step < SteamBenchmark::MaxSimSteps && Fake->GetNumPendingCallbacks() > 0; ++Step)
+        {
+            SteamBenchmark::Step(*Fake);
+        }
+    }
+
+    AddResult(TEXT("join_serial_simulated"), SerialUs);
+    AddResult(TEXT("join_quick_match_simulated"), QuickMatchUs);
+
+    DestroyInstance(Instance);
+}
+// - 2.8 - //
+void USteamLobbyBenchmarkCommandlet::RunFriendsBenchmark()
+{
+    constexpr int32 NumFriends = 600;
+    USteamMultiplayer* Instance = CreateInstance(NumFriends, 20.f, 0.f, NumFriends);
+    FFakeSteamBackend* Fake = SteamBenchmark::GetFake(Instance);
+    if (!Fake)
+    {
+        DestroyInstance(Instance);
+        return;
+    }
+
+    Measure(FString::Printf(TEXT("friends_rebuild_%d"), NumFriends), Iterations, [Instance]()
+    {
+        Instance->RefreshFriends();
+    });
+
+    // What a friends panel does every frame, rows reused so only the first query allocates
+    FSteamFriendsQuery Query;
+    Query.NameFilter = TEXT("_1");
+    TArray<int32> Rows;
+    Measure(FString::Printf(TEXT("friends_query_%d"), NumFriends), Iterations, [Instance, &Query, &Rows]()
+    {
+        Instance->GetFriendsCache().Query(Query, Rows);
+    });
+
+    // Rich presence fast path: straight to JoinLobby, compare with host_list_join_simulated
+    Query = FSteamFriendsQuery();
+    Query.bJoinableOnly = true;
+    Instance->GetFriendsCache().Query(Query, Rows);
+
+    TArray<double> JoinUs;
+    for (int32 i = 0; i < Iterations && Rows.Num() > 0; ++i)
+    {
+        FSteamFriendInfo Friend;
+        Instance->GetFriendsCache().GetInfo(Rows[i % Rows.Num()], Friend);
+
+        const double SimStart = Fake->GetSimulatedTime();
+        Instance->JoinFriend(Friend);
+        SteamBenchmark::Drain(*Fake);
+        if (SteamBenchmark::IsMember(*Fake, FSteamLobbyId(Friend.LobbyID)))
+        {
+            JoinUs.Add((Fake->GetSimulatedTime() - SimStart) * 1000000.0);
+            Fake->LeaveLobby(CSteamID(Friend.LobbyID));
+            SteamBenchmark::Drain(*Fake);
+        }
+    }
+    AddResult(TEXT("join_friend_simulated"), JoinUs);
+
+    DestroyInstance(Instance);
+}
+// - 2.9 - //
+void USteamLobbyBenchmarkCommandlet::RunStatsBenchmark()
+{
+    USteamMultiplayer* Instance = CreateInstance(0, 20.f);
+    FFakeSteamBackend* Fake = SteamBenchmark::GetFake(Instance);
+    if (!Fake)
+    {
+        DestroyInstance(Instance);
+        return;
+    }
+
+    // No game instance Init here, so the subsystem is made and started by hand
+    USteamStatsSubsystem* Stats = NewObject<USteamStatsSubsystem>(Instance);
+    Stats->StartStats();
+    SteamBenchmark::Drain(*Fake);
+
+    // What one gameplay event costs now that it only touches the cache
+    static const FName StatNames[] = { TEXT("Kills"), TEXT("Deaths"), TEXT("Assists"), TEXT("Headshots"), TEXT("DamageDealt") };
+    static const FName HighScore(TEXT("HighScore"));
+    int32 NumEvents = 0;
+    Measure(TEXT("stats_record_event"), Iterations, [Stats, &NumEvents]()
+    {
+        Stats->IncrementStat(StatNames[NumEvents % UE_ARRAY_COUNT(StatNames)]);
+        Stats->SubmitLeaderboardScore(HighScore, ++NumEvents);
+    });
+
+    // Match end: a match worth of events goes out as one store and one upload per board
+    constexpr int32 EventsPerMatch = 200;
+    Measure(FString::Printf(TEXT("stats_flush_%d_events"), EventsPerMatch), Iterations, [Stats]()
+    {
+        Stats->FlushNow();
+    },
+    [Stats, Fake, &NumEvents]()
+    {
+        SteamBenchmark::Drain(*Fake);
+        for (int32 i = 0; i < EventsPerMatch; ++i)
+        {
+            Stats->IncrementStat(StatNames[NumEvents % UE_ARRAY_COUNT(StatNames)]);
+            Stats->SubmitLeaderboardScore(HighScore, ++NumEvents);
+        }
+    });
+    SteamBenchmark::Drain(*Fake);
+    UE_LOG(LogSteamMultiplayer, Display, TEXT("Stats: %d events -> %d stat writes, %d stores, %d leaderboard uploads."),
+        NumEvents * 2, Fake->GetNumStatWrites(), Fake->GetNumStatsStores(), Fake->GetNumLeaderboardUploads());
+
+    // Boards found up front, so each sample is one page download
+    constexpr int32 NumBoards = 4;
+    for (int32 b = 0; b < NumBoards; ++b)
+    {
+        Stats->PrefetchLeaderboard(FName(*FString::Printf(TEXT("Board_%d"), b)), 1, USteamStatsSubsystem::RowsPerPage);
+    }
+    SteamBenchmark::Drain(*Fake);
+
+    TArray<double> PageUs;
+    for (int32 i = 0; i < Iterations; ++i)
+    {
+        const FName Board(*FString::Printf(TEXT("Board_%d"), i % NumBoards));
+        const int32 FirstRank = (1 + i / NumBoards) * USteamStatsSubsystem::RowsPerPage + 1;
+        const double SimStart = Fake->GetSimulatedTime();
+        Stats->PrefetchLeaderboard(Board, FirstRank, USteamStatsSubsystem::RowsPerPage);
+        SteamBenchmark::Drain(*Fake);
+        PageUs.Add((Fake->GetSimulatedTime() - SimStart) * 1000000.0);
+    }
+    AddResult(TEXT("leaderboard_page_simulated"), PageUs);
+
+    TArray<FSteamLeaderboardRow> Rows;
+    Measure(TEXT("leaderboard_rows_cached"), Iterations, [Stats, &Rows]()
+    {
+        Stats->GetLeaderboardRows(TEXT("Board_0"), 1, USteamStatsSubsystem::RowsPerPage, Rows);
+    });
+
+    Stats->StopStats();
+    DestroyInstance(Instance);
+}
+// - 2.10 - //
+void USteamLobbyBenchmarkCommandlet::RunLobbyChatBenchmark()
+{
+    USteamMultiplayer* Instance = CreateInstance(0, 0.f);
+    FFakeSteamBackend* Fake = SteamBenchmark::GetFake(Instance);
+    if (!Fake)
+    {
+        DestroyInstance(Instance);
+        return;
+    }
+
+    // Busy 64 player lobby, no game instance Init here, so the subsystem is made and started by hand
+    constexpr int32 NumMembers = 64;
+    Instance->CurrentLobbyId = FSteamLobbyId(Fake->AddSimulatedLobby(NumMembers, NumMembers));
+    Instance->RebuildLobbyRoster(Instance->CurrentLobbyId);
+    USteamLobbyChatSubsystem* Chat = NewObject<USteamLobbyChatSubsystem>(Instance);
+    Chat->StartLobbyChat(Instance->CurrentLobbyId);
+
+    // Every member says something once, text and emotes mixed, one entry too long for a slot
+    const CSteamID LobbyID = Instance->CurrentLobbyId.ToSteamID();
+    const uint8 Text[] = { (uint8)ESteamLobbyChatKind::Text, 'g', 'l', ' ', 'h', 'f', ' ', 'e', 'v', 'e', 'r', 'y', 'o', 'n', 'e' };
+    const uint8 Emote[] = { (uint8)ESteamLobbyChatKind::Emote, 7, 0 };
+    TArray<LobbyChatMsg_t> Replay;
+    for (int32 m = 0; m < NumMembers; ++m)
+    {
+        const CSteamID MemberID = Fake->GetLobbyMemberByIndex(LobbyID, m);
+        Fake->SendSimulatedChatMsg(LobbyID, MemberID, m % 4 == 0 ? Emote : Text, m % 4 == 0 ? sizeof(Emote) : sizeof(Text));
+
+        // Zero latency, so entries land in send order and chat IDs match it
+        LobbyChatMsg_t& Message = Replay.AddZeroed_GetRef();
+        Message.m_ulSteamIDLobby = LobbyID.ConvertToUint64();
+        Message.m_ulSteamIDUser = MemberID.ConvertToUint64();
+        Message.m_eChatEntryType = (uint8)k_EChatEntryTypeChatMsg;
+        Message.m_iChatID = m;
+    }
+    TArray<uint8> Oversized;
+    Oversized.SetNumZeroed(USteamLobbyChatSubsystem::MaxMessageBytes * 2);
+    Fake->SendSimulatedChatMsg(LobbyID, Fake->GetLobbyMemberByIndex(LobbyID, 0), Oversized.GetData(), Oversized.Num());
+    SteamBenchmark::Drain(*Fake);
+
+    // Replaying the entries times the subsystem alone, the fake's queue stays out of it
+    Measure(FString::Printf(TEXT("lobby_chat_receive_%d"), NumMembers), Iterations, [Chat, &Replay]()
+    {
+        for (LobbyChatMsg_t& Message : Replay)
+        {
+            Chat->OnLobbyChatMsg(&Message);
+        }
+    });
+
+    // Chat box showing the newest lines: first render converts, later frames reuse the strings
+    constexpr int32 VisibleLines = 20;
+    auto Render = [Chat]()
+    {
+        for (int32 Id = Chat->GetNextMessageId() - VisibleLines; Id < Chat->GetNextMessageId(); ++Id)
+        {
+            Chat->GetMessageDisplay(Id);
+        }
+    };
+    Measure(FString::Printf(TEXT("lobby_chat_render_new_%d"), VisibleLines), Iterations, Render, [Chat, &Replay]()
+    {
+        for (LobbyChatMsg_t& Message : Replay)
+        {
+            Chat->OnLobbyChatMsg(&Message);
+        }
+    });
+    Measure(FString::Printf(TEXT("lobby_chat_render_cached_%d"), VisibleLines), Iterations, Render);
+
+    const FSteamLobbyChatStats ChatStats = Chat->GetChatStats();
+    UE_LOG(LogSteamMultiplayer, Display, TEXT("Lobby chat: %lld received, %lld converted for display, %lld dropped."),
+        ChatStats.Received, ChatStats.DisplayConversions, ChatStats.DroppedIncoming);
+
+    Chat->StopLobbyChat();
+    DestroyInstance(Instance);
+}
+// - 2.11 - //
+void USteamLobbyBenchmarkCommandlet::RunHostMigrationBenchmark()
+{
+    USteamMultiplayer* Instance = CreateInstance(0, 20.f);
+    FFakeSteamBackend* Fake = SteamBenchmark::GetFake(Instance);
+    if (!Fake)
+    {
+        DestroyInstance(Instance);
+        return;
+    }
+
+    // Host left -> match running again, Steam side only (USteamBenchmarkMultiplayer skips the map load)
+    constexpr int32 NumMembers = 8;
+    TArray<double> RehostUs;
+    TArray<double> ReconnectUs;
+    for (int32 i = 0; i < Iterations; ++i)
+    {
+        // Even iterations: we are next in the snapshot and Steam hands us the lobby, so we re-host.
+        // Odd iterations: a simulated member is next and Steam's pick, we wait for its snapshot and follow
+        const bool bRehost = i % 2 == 0;
+        const CSteamID LobbyID = Fake->AddSimulatedLobby(bRehost ? 1 : 2, NumMembers);
+        const CSteamID HostID = Fake->GetLobbyOwner(LobbyID);
+        Instance->JoinLobby(FSteamLobbyId(LobbyID));
+        SteamBenchmark::Drain(*Fake);
+        while (Fake->GetNumLobbyMembers(LobbyID) < NumMembers)
+        {
+            Fake->AddSimulatedMember(LobbyID);
+            SteamBenchmark::Drain(*Fake);
+        }
+
+        // The snapshot the host left behind, slots in lobby order
+        FSteamSessionSnapshot Snapshot;
+        Snapshot.Sequence = 1;
+        Snapshot.HostSteamID = HostID.ConvertToUint64();
+        Snapshot.MapName = FLobbyMetadata().MapName;
+        for (int32 m = 0; m < NumMembers; ++m)
+        {
+            Snapshot.Slots.AddDefaulted_GetRef().SteamID = Fake->GetLobbyMemberByIndex(LobbyID, m).ConvertToUint64();
+        }
+        TUtf8StringBuilder<1024> Blob;
+        Snapshot.Encode(Blob);
+        Fake->SetSimulatedLobbyData(LobbyID, FSteamSessionSnapshot::BlobKey, (const char*)Blob.ToString());
+        SteamBenchmark::Drain(*Fake);
+
+        const double SimStart = Fake->GetSimulatedTime();
+        Fake->RemoveSimulatedMember(LobbyID, HostID);
+        for (int32 Step = 0; Step < SteamBenchmark::MaxSimSteps && Instance->LobbyRoster.FindMember(HostID.ConvertToUint64()); ++Step)
+        {
+            SteamBenchmark::Step(*Fake);
+        }
+
+        // The successor's own snapshot, published once it listens
+        const uint64 Successor = Snapshot.Slots[1].SteamID;
+        if (!bRehost)
+        {
+            Snapshot.Sequence = 2;
+            Snapshot.HostSteamID = Successor;
+            Blob.Reset();
+            Snapshot.Encode(Blob);
+            Fake->SetSimulatedLobbyData(LobbyID, FSteamSessionSnapshot::BlobKey, (const char*)Blob.ToString());
+        }
+        for (int32 Step = 0; Step < SteamBenchmark::MaxSimSteps && Instance->IsHostMigrating(); ++Step)
+        {
+            SteamBenchmark::Step(*Fake);
+        }
+
+        if (Instance->SessionHostSteamID == Successor && !Instance->IsHostMigrating())
+        {
+            (bRehost ? RehostUs : ReconnectUs).Add((Fake->GetSimulatedTime() - SimStart) * 1000000.0);
+        }
+        else
+        {
+            UE_LOG(LogSteamMultiplayer, Error, TEXT("Host migration benchmark did not end on the expected host (iteration %d)."), i);
+        }
+
+        // Out of the lobby, so the next iteration starts without a session
+        Fake->LeaveLobby(LobbyID);
+        Instance->RebuildLobbyRoster(FSteamLobbyId());
+        SteamBenchmark::Drain(*Fake);
+    }
+
+    AddResult(TEXT("host_migration_rehost_simulated"), RehostUs);
+    AddResult(TEXT("host_migration_reconnect_simulated"), ReconnectUs);
+
+    DestroyInstance(Instance);
+}
+/////////////////////////
+// 3. Output          //
+////////////////////////////////////////
+// 3.1 - JSON + CSV                  //
+// 3.2 - Regression check           //
+/////////////////////////////////////
+// - 3.1 - //
+bool USteamLobbyBenchmarkCommandlet::WriteResults(const FString& JsonPath) const
+{
+    TArray<TSharedPtr<FJsonValue>> Entries;
+    FString Csv = TEXT("name,iterations,mean_us,p50_us,p99_us,min_us\n");
+    for (const FBenchmarkResult& Result : Results)
+    {
+        TSharedRef<FJsonObject> Entry = MakeShared<FJsonObject>();
+        Entry->SetStringField(TEXT("name"), Result.Name);
+        Entry->SetNumberField(TEXT("iterations"), Result.Iterations);
+        Entry->SetNumberField(TEXT("mean_us"), Result.MeanUs);
+        Entry->SetNumberField(TEXT("p50_us"), Result.P50Us);
+        Entry->SetNumberField(TEXT("p99_us"), Result.P99Us);
+        Entry->SetNumberField(TEXT("min_us"), Result.MinUs);
+        Entries.Add(MakeShared<FJsonValueObject>(Entry));
+
+        Csv += FString::Printf(TEXT("%s,%d,%.3f,%.3f,%.3f,%.3f\n"),
+            *Result.Name, Result.Iterations, Result.MeanUs, Result.P50Us, Result.P99Us, Result.MinUs);
+    }
+
+    TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+    Root->SetStringField(TEXT("platform"), FPlatformProperties::IniPlatformName());
+    Root->SetStringField(TEXT("cpu"), FPlatformMisc::GetCPUBrand().TrimStartAndEnd());
+    Root->SetArrayField(TEXT("benchmarks"), Entries);
+
+    FString Json;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+    FJsonSerializer::Serialize(Root, Writer);
+
+    const FString CsvPath = FPaths::ChangeExtension(JsonPath, TEXT("csv"));
+    if (!FFileHelper::SaveStringToFile(Json, *JsonPath) || !FFileHelper::SaveStringToFile(Csv, *CsvPath))
+    {
+        UE_LOG(LogSteamMultiplayer, Error, TEXT("Failed to write benchmark results to %s"), *JsonPath);
+        return false;
+    }
+    UE_LOG(LogSteamMultiplayer, Display, TEXT("Benchmark results written to %s (+ .csv)"), *JsonPath);
+    return true;
+}
+// - 3.2 - //
+bool USteamLobbyBenchmarkCommandlet::CompareToBaseline(const FString& BaselinePath, float Tolerance) const
+{
+    FString Json;
+    TSharedPtr<FJsonObject> Root;
+    if (!FFileHelper::LoadFileToString(Json, *BaselinePath) || !FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Json), Root) || !Root.IsValid())
+    {
+        UE_LOG(LogSteamMultiplayer, Error, TEXT("Could not read benchmark baseline %s"), *BaselinePath);
+        return false;
+    }
+
+    TMap<FString, double> BaselineP50;
+    const TArray<TSharedPtr<FJsonValue>>* Entries = nullptr;
+    if (Root->TryGetArrayField(TEXT("benchmarks"), Entries))
+    {
+        for (const TSharedPtr<FJsonValue>& Value : *Entries)
+        {
+            const TSharedPtr<FJsonObject> Entry = Value->AsObject();
+            if (Entry.IsValid())
+            {
+                BaselineP50.Add(Entry->GetStringField(TEXT("name")), Entry->GetNumberField(TEXT("p50_us")));
+            }
+        }
+    }
+
+    // p50 only, p99 on shared CI machines is too noisy to gate on
+    bool bPassed = true;
+    for (const FBenchmarkResult& Result : Results)
+    {
+        const double* Baseline = BaselineP50.Find(Result.Name);
+        if (!Baseline || *Baseline <= 0.0)
+        {
+            UE_LOG(LogSteamMultiplayer, Display, TEXT("%-32s no baseline"), *Result.Name);
+        }
+        else if (Result.P50Us > *Baseline * (1.0 + Tolerance))
+        {
+            UE_LOG(LogSteamMultiplayer, Error, TEXT("%-32s REGRESSED p50 %.2fus -> %.2fus (+%.0f%%)"),
+                *Result.Name, *Baseline, Result.P50Us, (Result.P50Us / *Baseline - 1.0) * 100.0);
+            bPassed = false;
+        }
+        else
+        {
+            UE_LOG(LogSteamMultiplayer, Display, TEXT("%-32s ok p50 %.2fus (baseline %.2fus)"), *Result.Name, Result.P50Us, *Baseline);
+        }
+    }
+    return bPassed;
+}
+///////////////////////////////////////////
+// MORE COMING SOON  // A.S. - hajddeen //
+/////////////////////////////////////////
@@ -0,0 +1,130 @@
+// |------------------------------------|
+// |  !FOLLOW URBAN SHADOWS ON SOCIALS! |
+// |------------------------------------|
+//            \ (^ᴗ^) /
+//             \     /
+//              -----
+//              |   |
+//              |   |
+//              |_  |_ 
+////////////////////////////////////////////////////////////
+// STEAM P2P SESSIONS - Unreal 5.5 + Steamworks SDK 1.57 //
+//////////////////////////////////////////////////////////////////
+// LICENSE AGREEMENT // LICENSE AGREEMENT // LICENSE AGREEMENT //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                                                                                                                                                                                                                                          //
+// Last Updated: 03/12/2024                                                                                                                                                                                                                                //
+//                                                                                                                                                                                                                                                        //
+// 1. Grant of License                                                                                                                                                                                                                                   //
+// This license permits anyone to use, modify, and distribute the provided code (the "Code") in projects free of charge under the following conditions:                                                                                                 //
+// 1.1. The Code must only be used for lawful purposes.                                                                                                                                                                                                //
+// 1.2. The user must include proper credit in their project as described in Section 3 below.                                                                                                                                                         //
+//                                                                                                                                                                                                                                                   //
+// 2. Restrictions                                                                                                                                                                                                                                  //
+// 2.1. This Code cannot be sold, sublicensed, or redistributed as a standalone product or as part of a similar development toolkit.                                                                                                               //
+// 2.2. The Code must not be used for projects that violate local laws or promote harmful, discriminatory, or illegal activities.                                                                                                                 //
+// 2.3. The user must not remove, alter, or obscure this license agreement, attribution requirements, or copyright notices within the Code.                                                                                                      //
+//                                                                                                                                                                                                                                              //
+// 3. Attribution                                                                                                                                                                                                                              //
+// 3.1. The user must include the following credit in a visible location within their project (e.g., splash screen, credits screen, or documentation):                                                                                        //
+// "Steam Multiplayer Code developed by Adrian Szajewski. Used under license."                                                                                                                                                               //
+// 3.2. For distributed or published projects, a link to https://adrianszajewskidev.wordpress.com/ or other contact details must also be included if applicable.                                                                            //
+//                                                                                                                                                                                                                                         //
+// 4. Breach of Agreement                                                                                                                                                                                                                 //
+// 4.1. If this license is violated, the licensor reserves the right to revoke the user's rights to use the Code immediately.                                                                                                            //
+// 4.2. The licensor may take legal action to recover damages or enforce compliance, depending on the severity of the violation.                                                                                                        //
+// 4.3. Users found in breach of this license may be required to:                                                                                                                                                                      //
+// Remove the Code from their project(s).                                                                                                                                                                                             //
+// Cease distribution of any projects using the Code.                                                                                                                                                                                //
+//                                                                                                                                                                                                                                  //
+// 5. Disclaimer                                                                                                                                                                                                                   //
+// 5.1. The Code is provided "as is" without any warranty, express or implied. The licensor is not liable for any damages arising from the use or misuse of the Code.                                                             //
+// 5.2. It is the user's responsibility to ensure compatibility and safe usage of the Code in their projects.                                                                                                                    //
+//                                                                                                                                                                                                                              //
+// 6. Governing Law                                                                                                                                                                                                            //
+// This agreement shall be governed and construed in accordance with the laws of Poland. Any disputes arising under or in connection with this license will be subject to the exclusive jurisdiction of the courts of Poland. //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+/////////////////////////////////////////////////////////
+// INCLUDE //
+////////////
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "SteamMultiplayer.h"
+#include "SteamLobbyBenchmarkCommandlet.generated.h"
+
+//////////////////////////////////////////////
+// GAME INSTANCE WITHOUT A WORLD            //
+//////////////////////////////////////////////
+// Fake backend runs have no map to load, migration travel counts as done at once
+UCLASS(Transient)
+class URBANSHADOWS_API USteamBenchmarkMultiplayer : public USteamMultiplayer
+{
+    GENERATED_BODY()
+
+protected:
+    virtual bool TravelForHostMigration(bool bAsNewHost) override;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+// HOW TO RUN?                                                                             //
+/////////////////////////////////////////////////////////////////////////////////////////////
+// UnrealEditor-Cmd <Project> -run=SteamLobbyBenchmark -nullrhi -unattended               //
+//     [-Output=<file.json>] [-Baseline=<file.json>] [-Tolerance=0.15] [-Iterations=50]  //
+// 1. Runs against the fake Steam backend, no Steam client needed.                       //
+// 2. Writes JSON + CSV (same name, .csv) with mean/p50/p99/min per benchmark in us.    //
+// 3. With -Baseline, returns 1 if any p50 is slower than baseline by > Tolerance.     //
+////////////////////////////////////////////////////////////////////////////////////////
+UCLASS()
+class URBANSHADOWS_API USteamLobbyBenchmarkCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    USteamLobbyBenchmarkCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+
+private:
+    //////////////////////////////////////////////
+    // 1. Results                              //
+    ////////////////////////////////////////////
+    struct FBenchmarkResult
+    {
+        FString Name;
+        int32 Iterations = 0;
+        double MeanUs = 0.0;
+        double P50Us = 0.0;
+        double P99Us = 0.0;
+        double MinUs = 0.0;
+    };
+    TArray<FBenchmarkResult> Results;
+    int32 Iterations;
+
+    void AddResult(const FString& Name, TArray<double>& SamplesUs);
+    void Measure(const FString& Name, int32 NumIterations, TFunctionRef<void()> Body, TFunction<void()> Setup = nullptr);
+
+    //////////////////////////////////////////////
+    // 2. Benchmarks                           //
+    ////////////////////////////////////////////
+    USteamMultiplayer* CreateInstance(int32 NumLobbies, float LatencyMs, float FailureRate = 0.f, int32 NumFriends = 100) const;
+    void DestroyInstance(USteamMultiplayer* Instance) const;
+    void RunLobbyListBenchmarks();
+    void RunLobbyMemberBenchmarks();
+    void RunAvatarUploadBenchmark();
+    void RunEndToEndBenchmark();
+    void RunQuickMatchBenchmark();
+    void RunFriendsBenchmark();
+    void RunStatsBenchmark();
+    void RunLobbyChatBenchmark();
+    void RunHostMigrationBenchmark();
+
+    //////////////////////////////////////////////
+    // 3. Output                               //
+    ////////////////////////////////////////////
+    bool WriteResults(const FString& JsonPath) const;
+    bool CompareToBaseline(const FString& BaselinePath, float Tolerance) const;
+};
+///////////////////////////////////////////
+// MORE COMING SOON  // A.S. - hajddeen //
+/////////////////////////////////////////
@@ -0,0 +1,381 @@
+// |------------------------------------|
+// |  !FOLLOW URBAN SHADOWS ON SOCIALS! |
+// |------------------------------------|
+//            \ (^ᴗ^) /
+//             \     /
+//              -----
+//              |   |
+//              |   |
+//              |_  |_
+////////////////////////////////////////////////////////////
+// STEAM P2P SESSIONS - Unreal 5.5 + Steamworks SDK 1.57 //
+//////////////////////////////////////////////////////////////////
+// LICENSE AGREEMENT // LICENSE AGREEMENT // LICENSE AGREEMENT //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                                                                                                                                                                                                                                          //
+// Last Updated: 03/12/2024                                                                                                                                                                                                                                //
+//                                                                                                                                                                                                                                                        //
+// 1. Grant of License                                                                                                                                                                                                                                   //
+// This license permits anyone to use, modify, and distribute the provided code (the "Code") in projects free of charge under the following conditions:                                                                                                 //
+// 1.1. The Code must only be used for lawful purposes.                                                                                                                                                                                                //
+// 1.2. The user must include proper credit in their project as described in Section 3 below.                                                                                                                                                         //
+//                                                                                                                                                                                                                                                   //
+// 2. Restrictions                                                                                                                                                                                                                                  //
+// 2.1. This Code cannot be sold, sublicensed, or redistributed as a standalone product or as part of a similar development toolkit.                                                                                                               //
+// 2.2. The Code must not be used for projects that violate local laws or promote harmful, discriminatory, or illegal activities.                                                                                                                 //
+// 2.3. The user must not remove, alter, or obscure this license agreement, attribution requirements, or copyright notices within the Code.                                                                                                      //
+//                                                                                                                                                                                                                                              //
+// 3. Attribution                                                                                                                                                                                                                              //
+// 3.1. The user must include the following credit in a visible location within their project (e.g., splash screen, credits screen, or documentation):                                                                                        //
+// "Steam Multiplayer Code developed by Adrian Szajewski. Used under license."                                                                                                                                                               //
+// 3.2. For distributed or published projects, a link to https://adrianszajewskidev.wordpress.com/ or other contact details must also be included if applicable.                                                                            //
+//                                                                                                                                                                                                                                         //
+// 4. Breach of Agreement                                                                                                                                                                                                                 //
+// 4.1. If this license is violated, the licensor reserves the right to revoke the user's rights to use the Code immediately.                                                                                                            //
+// 4.2. The licensor may take legal action to recover damages or enforce compliance, depending on the severity of the violation.                                                                                                        //
+// 4.3. Users found in breach of this license may be required to:                                                                                                                                                                      //
+// Remove the Code from their project(s).                                                                                                                                                                                             //
+// Cease distribution of any projects using the Code.                                                                                                                                                                                //
+//                                                                                                                                                                                                                                  //
+// 5. Disclaimer                                                                                                                                                                                                                   //
+// 5.1. The Code is provided "as is" without any warranty, express or implied. The licensor is not liable for any damages arising from the use or misuse of the Code.                                                             //
+// 5.2. It is the user's responsibility to ensure compatibility and safe usage of the Code in their projects.                                                                                                                    //
+//                                                                                                                                                                                                                              //
+// 6. Governing Law                                                                                                                                                                                                            //
+// This agreement shall be governed and construed in accordance with the laws of Poland. Any disputes arising under or in connection with this license will be subject to the exclusive jurisdiction of the courts of Poland. //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////
+// INCLUDE //
+////////////
+#include "SteamLobbyChat.h"
+#include "SteamMultiplayerStats.h"
+#include "HAL/PlatformTime.h"
+//////////////////////////////////
+// Steam Lobby Chat - Internals //
+/////////////////////////////////////////////////////////////////////
+// 1. The last byte of a slot is never filled by a valid message, //
+//    so a full read means Steam truncated the entry             //
+// 2. A dropped entry still costs the slot it was read into     //
+/////////////////////////////////////////////////////////////////
+namespace SteamLobbyChat
+{
+    constexpr int32 MaxSendsPerSecond = 8; // Steam starts throttling lobby chat not far above this
+
+    bool IsWellFormed(const uint8* Data, int32 Size)
+    {
+        if (Size < 2)
+        {
+            return false;
+        }
+
+        switch ((ESteamLobbyChatKind)Data[0])
+        {
+        case ESteamLobbyChatKind::Text: return true;
+        case ESteamLobbyChatKind::Ready: return Size == 2;
+        case ESteamLobbyChatKind::Emote: return Size == 3;
+        case ESteamLobbyChatKind::Binary: return true;
+        default: return false;
+        }
+    }
+}
+/////////////////////////
+// 1. Lifecycle       //
+//////////////////////////////////////////
+// 1.1 - Subsystem teardown            //
+// 1.2 - Start chat for a lobby       //
+// 1.3 - Stop chat                   //
+// 1.4 - Get the game instance      //
+/////////////////////////////////////
+// - 1.1 - //
+void USteamLobbyChatSubsystem::Deinitialize()
+{
+    StopLobbyChat();
+    Super::Deinitialize();
+}
+// - 1.2 - //
+void USteamLobbyChatSubsystem::StartLobbyChat(FSteamLobbyId InLobbyID)
+{
+    USteamMultiplayer* Multiplayer = GetMultiplayer();
+    ISteamBackend* Steam = Multiplayer ? Multiplayer->GetSteamBackend() : nullptr;
+    if (!Steam || !Steam->IsRunning() || !InLobbyID.IsValid())
+    {
+        return;
+    }
+    else if (LobbyID == InLobbyID)
+    {
+        return;
+    }
+
+    StopLobbyChat();
+    LobbyID = InLobbyID;
+
+    // The ring lives as long as the subsystem, lobbies only borrow it
+    if (Slots.Num() == 0)
+    {
+        Slots.SetNum(Capacity);
+    }
+    FirstMessageId = NextMessageId;
+    Stats = FSteamLobbyChatStats();
+    RateWindowStart = SendWindowStart = FPlatformTime::Seconds();
+    RateWindowCount = LastRateCount = SendWindowCount = 0;
+
+    if (Steam->UsesCallbackRouter())
+    {
+        RoutedBackend = Steam;
+        ChatMsgHandle = Steam->GetCallbackRouter().Bind<LobbyChatMsg_t>([this](LobbyChatMsg_t* pCallback)
+        {
+            OnLobbyChatMsg(pCallback);
+        });
+    }
+    UE_LOG(LogSteamMultiplayer, Log, TEXT("Lobby chat started for %llu."), LobbyID.Value);
+}
+// - 1.3 - //
+void USteamLobbyChatSubsystem::StopLobbyChat()
+{
+    if (!LobbyID.IsValid())
+    {
+        return;
+    }
+
+    if (RoutedBackend)
+    {
+        RoutedBackend->GetCallbackRouter().Unbind(ChatMsgHandle);
+        RoutedBackend = nullptr;
+    }
+
+    // History belongs to the lobby, the slots and their strings stay for the next one
+    for (FSlot& Slot : Slots)
+    {
+        Slot.MessageId = INDEX_NONE;
+        Slot.bDisplayReady = false;
+    }
+    FirstMessageId = NextMessageId;
+    LobbyID = FSteamLobbyId();
+    SET_DWORD_STAT(STAT_SteamLobbyChatRate, 0);
+}
+// - 1.4 - //
+USteamMultiplayer* USteamLobbyChatSubsystem::GetMultiplayer() const
+{
+    return Cast<USteamMultiplayer>(GetGameInstance());
+}
+/////////////////////////
+// 2. Sending         //
+//////////////////////////////////////////
+// 2.1 - Text                          //
+// 2.2 - Ready ping + emote           //
+// 2.3 - Game-defined payload        //
+// 2.4 - Rate limit and send        //
+/////////////////////////////////////
+// - 2.1 - //
+bool USteamLobbyChatSubsystem::SendText(const FString& Text)
+{
+    // Short lines convert on the stack, only long ones spill to the heap
+    const FTCHARToUTF8 Utf8(*Text, Text.Len());
+    return Send(ESteamLobbyChatKind::Text, (const uint8*)Utf8.Get(), Utf8.Length());
+}
+// - 2.2 - //
+bool USteamLobbyChatSubsystem::SendReady(bool bReady)
+{
+    const uint8 Payload = bReady ? 1 : 0;
+    return Send(ESteamLobbyChatKind::Ready, &Payload, 1);
+}
+
+bool USteamLobbyChatSubsystem::SendEmote(int32 EmoteId)
+{
+    if (EmoteId < 0 || EmoteId > MAX_uint16)
+    {
+        ++Stats.DroppedOutgoing;
+        return false;
+    }
+    else
+    {
+        const uint8 Payload[2] = { (uint8)(EmoteId & 0xFF), (uint8)(EmoteId >> 8) };
+        return Send(ESteamLobbyChatKind::Emote, Payload, 2);
+    }
+}
+// - 2.3 - //
+bool USteamLobbyChatSubsystem::SendBinary(const uint8* Data, int32 Size)
+{
+    return Send(ESteamLobbyChatKind::Binary, Data, Size);
+}
+// - 2.4 - //
+bool USteamLobbyChatSubsystem::Send(ESteamLobbyChatKind Kind, const uint8* Payload, int32 Size)
+{
+    USteamMultiplayer* Multiplayer = GetMultiplayer();
+    if (!LobbyID.IsValid() || !Multiplayer)
+    {
+        return false;
+    }
+
+    // One window per second, what does not fit is refused rather than queued
+    const double Now = FPlatformTime::Seconds();
+    if (Now - SendWindowStart >= 1.0)
+    {
+        SendWindowStart = Now;
+        SendWindowCount = 0;
+    }
+
+    // Kind byte plus payload has to leave the slot's last byte free (see internals)
+    if (Size <= 0 || 1 + Size >= MaxMessageBytes || SendWindowCount >= SteamLobbyChat::MaxSendsPerSecond)
+    {
+        ++Stats.DroppedOutgoing;
+        return false;
+    }
+
+    uint8 Message[MaxMessageBytes];
+    Message[0] = (uint8)Kind;
+    FMemory::Memcpy(Message + 1, Payload, Size);
+    if (!Multiplayer->GetSteamBackend()->SendLobbyChatMsg(LobbyID.ToSteamID(), Message, 1 + Size))
+    {
+        ++Stats.DroppedOutgoing;
+        return false;
+    }
+    else
+    {
+        ++SendWindowCount;
+        ++Stats.Sent;
+        return true;
+    }
+}
+/////////////////////////
+// 3. Receiving       //
+//////////////////////////////////////////
+// 3.1 - Callback: chat entry arrived  //
+// 3.2 - Rate window                  //
+///////////////////////////////////////
+// - 3.1 - //
+void USteamLobbyChatSubsystem::OnLobbyChatMsg(LobbyChatMsg_t* pCallback)
+{
+    STEAM_MP_SCOPE(STAT_SteamLobbyChatReceive);
+
+    USteamMultiplayer* Multiplayer = GetMultiplayer();
+    if (!LobbyID.IsValid() || !Multiplayer || pCallback->m_ulSteamIDLobby != LobbyID.Value || pCallback->m_eChatEntryType != k_EChatEntryTypeChatMsg)
+    {
+        return;
+    }
+
+    // Read straight into the slot this message takes, no staging copy
+    const int32 MessageId = NextMessageId;
+    FSlot& Slot = Slots[MessageId & (Capacity - 1)];
+    Slot.MessageId = INDEX_NONE;
+    Slot.bDisplayReady = false;
+
+    CSteamID Sender;
+    EChatEntryType EntryType = k_EChatEntryTypeInvalid;
+    const int32 Size = Multiplayer->GetSteamBackend()->GetLobbyChatEntry(LobbyID.ToSteamID(), pCallback->m_iChatID, &Sender, Slot.Data, MaxMessageBytes, &EntryType);
+
+    const FSteamLobbyRoster& Roster = Multiplayer->GetLobbyRosterView();
+    const FSteamLobbyMember* Member = Roster.IsFor(LobbyID.ToSteamID()) ? Roster.FindMember(Sender.ConvertToUint64()) : nullptr;
+    if (!Member || Size >= MaxMessageBytes || !SteamLobbyChat::IsWellFormed(Slot.Data, Size))
+    {
+        ++Stats.DroppedIncoming;
+        SET_DWORD_STAT(STAT_SteamLobbyChatDropped, (uint32)Stats.DroppedIncoming);
+        UE_LOG(LogSteamMultiplayer, Verbose, TEXT("Lobby chat entry %d from %llu dropped (%d bytes, member: %s)."), pCallback->m_iChatID, Sender.ConvertToUint64(), Size, Member ? TEXT("yes") : TEXT("no"));
+        return;
+    }
+
+    Slot.MessageId = MessageId;
+    Slot.SenderID = Sender.ConvertToUint64();
+    Slot.Kind = (ESteamLobbyChatKind)Slot.Data[0];
+    Slot.Size = (uint16)(Size - 1);
+    ++NextMessageId;
+    ++Stats.Received;
+    CountReceived(FPlatformTime::Seconds());
+
+    OnLobbyChatMessage.Broadcast(MessageId, Slot.Kind, *Member);
+}
+// - 3.2 - //
+void USteamLobbyChatSubsystem::CountReceived(double Now)
+{
+    // A window that closed with nothing after it means a quiet second, rate 0
+    const double Elapsed = Now - RateWindowStart;
+    if (Elapsed >= 1.0)
+    {
+        LastRateCount = Elapsed < 2.0 ? RateWindowCount : 0;
+        RateWindowStart = Elapsed < 2.0 ? RateWindowStart + 1.0 : Now;
+        RateWindowCount = 0;
+        SET_DWORD_STAT(STAT_SteamLobbyChatRate, LastRateCount);
+    }
+    ++RateWindowCount;
+}
+/////////////////////////
+// 4. Reading         //
+//////////////////////////////////////////
+// 4.1 - Slot for a message ID         //
+// 4.2 - Lazy display string          //
+// 4.3 - Typed accessors             //
+// 4.4 - Counters                   //
+/////////////////////////////////////
+// - 4.1 - //
+const USteamLobbyChatSubsystem::FSlot* USteamLobbyChatSubsystem::FindSlot(int32 MessageId) const
+{
+    if (MessageId < 0 || Slots.Num() == 0)
+    {
+        return nullptr;
+    }
+
+    const FSlot& Slot = Slots[MessageId & (Capacity - 1)];
+    return Slot.MessageId == MessageId ? &Slot : nullptr;
+}
+// - 4.2 - //
+const FString& USteamLobbyChatSubsystem::GetMessageDisplay(int32 MessageId)
+{
+    static const FString Empty;
+    FSlot* Slot = const_cast<FSlot*>(FindSlot(MessageId));
+    if (!Slot || Slot->Kind != ESteamLobbyChatKind::Text)
+    {
+        return Empty;
+    }
+    else if (!Slot->bDisplayReady)
+    {
+        // Only rendered messages pay for the conversion, Reset keeps the slot string's allocation
+        const auto Text = StringCast<TCHAR>((const UTF8CHAR*)(Slot->Data + 1), Slot->Size);
+        Slot->Display.Reset(Text.Length());
+        Slot->Display.AppendChars(Text.Get(), Text.Length());
+        Slot->bDisplayReady = true;
+        ++Stats.DisplayConversions;
+    }
+    return Slot->Display;
+}
+// - 4.3 - //
+ESteamLobbyChatKind USteamLobbyChatSubsystem::GetMessageKind(int32 MessageId) const
+{
+    const FSlot* Slot = FindSlot(MessageId);
+    return Slot ? Slot->Kind : ESteamLobbyChatKind::Text;
+}
+
+int32 USteamLobbyChatSubsystem::GetMessageEmote(int32 MessageId) const
+{
+    const FSlot* Slot = FindSlot(MessageId);
+    return Slot && Slot->Kind == ESteamLobbyChatKind::Emote ? Slot->Data[1] | (Slot->Data[2] << 8) : INDEX_NONE;
+}
+
+bool USteamLobbyChatSubsystem::GetMessageReady(int32 MessageId) const
+{
+    const FSlot* Slot = FindSlot(MessageId);
+    return Slot && Slot->Kind == ESteamLobbyChatKind::Ready && Slot->Data[1] != 0;
+}
+
+uint64 USteamLobbyChatSubsystem::GetMessageSender(int32 MessageId) const
+{
+    const FSlot* Slot = FindSlot(MessageId);
+    return Slot ? Slot->SenderID : 0;
+}
+
+TArrayView<const uint8> USteamLobbyChatSubsystem::GetMessagePayload(int32 MessageId) const
+{
+    const FSlot* Slot = FindSlot(MessageId);
+    return Slot ? TArrayView<const uint8>(Slot->Data + 1, Slot->Size) : TArrayView<const uint8>();
+}
+// - 4.4 - //
+FSteamLobbyChatStats USteamLobbyChatSubsystem::GetChatStats() const
+{
+    // The rate is read without closing the window, so it decays on its own when the chat goes quiet
+    const double Elapsed = FPlatformTime::Seconds() - RateWindowStart;
+    FSteamLobbyChatStats Result = Stats;
+    Result.MessagesPerSecond = Elapsed < 1.0 ? LastRateCount : Elapsed < 2.0 ? RateWindowCount : 0;
+    return Result;
+}
+///////////////////////////////////////////
+// MORE COMING SOON  // A.S. - hajddeen //
+/////////////////////////////////////////
@@ -0,0 +1,241 @@
+// |------------------------------------|
+// |  !FOLLOW URBAN SHADOWS ON SOCIALS! |
+// |------------------------------------|
+//            \ (^ᴗ^) /
+//             \     /
+//              -----
+//              |   |
+//              |   |
+//              |_  |_ 
+////////////////////////////////////////////////////////////
+// STEAM P2P SESSIONS - Unreal 5.5 + Steamworks SDK 1.57 //
+//////////////////////////////////////////////////////////////////
+// LICENSE AGREEMENT // LICENSE AGREEMENT // LICENSE AGREEMENT //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                                                                                                                                                                                                                                          //
+// Last Updated: 03/12/2024                                                                                                                                                                                                                                //
+//                                                                                                                                                                                                                                                        //
+// 1. Grant of License                                                                                                                                                                                                                                   //
+// This license permits anyone to use, modify, and distribute the provided code (the "Code") in projects free of charge under the following conditions:                                                                                                 //
+// 1.1. The Code must only be used for lawful purposes.                                                                                                                                                                                                //
+// 1.2. The user must include proper credit in their project as described in Section 3 below.                                                                                                                                                         //
+//                                                                                                                                                                                                                                                   //
+// 2. Restrictions                                                                                                                                                                                                                                  //
+// 2.1. This Code cannot be sold, sublicensed, or redistributed as a standalone product or as part of a similar development toolkit.                                                                                                               //
+// 2.2. The Code must not be used for projects that violate local laws or promote harmful, discriminatory, or illegal activities.                                                                                                                 //
+// 2.3. The user must not remove, alter, or obscure this license agreement, attribution requirements, or copyright notices within the Code.                                                                                                      //
+//                                                                                                                                                                                                                                              //
+// 3. Attribution                                                                                                                                                                                                                              //
+// 3.1. The user must include the following credit in a visible location within their project (e.g., splash screen, credits screen, or documentation):                                                                                        //
+// "Steam Multiplayer Code developed by Adrian Szajewski. Used under license."                                                                                                                                                               //
+// 3.2. For distributed or published projects, a link to https://adrianszajewskidev.wordpress.com/ or other contact details must also be included if applicable.                                                                            //
+//                                                                                                                                                                                                                                         //
+// 4. Breach of Agreement                                                                                                                                                                                                                 //
+// 4.1. If this license is violated, the licensor reserves the right to revoke the user's rights to use the Code immediately.                                                                                                            //
+// 4.2. The licensor may take legal action to recover damages or enforce compliance, depending on the severity of the violation.                                                                                                        //
+// 4.3. Users found in breach of this license may be required to:                                                                                                                                                                      //
+// Remove the Code from their project(s).                                                                                                                                                                                             //
+// Cease distribution of any projects using the Code.                                                                                                                                                                                //
+//                                                                                                                                                                                                                                  //
+// 5. Disclaimer                                                                                                                                                                                                                   //
+// 5.1. The Code is provided "as is" without any warranty, express or implied. The licensor is not liable for any damages arising from the use or misuse of the Code.                                                             //
+// 5.2. It is the user's responsibility to ensure compatibility and safe usage of the Code in their projects.                                                                                                                    //
+//                                                                                                                                                                                                                              //
+// 6. Governing Law                                                                                                                                                                                                            //
+// This agreement shall be governed and construed in accordance with the laws of Poland. Any disputes arising under or in connection with this license will be subject to the exclusive jurisdiction of the courts of Poland. //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+/////////////////////////////////////////////////////////
+// INCLUDE //
+////////////
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "steam/steam_api.h"
+#include "steam/isteammatchmaking.h"
+#include "SteamMultiplayer.h"
+#include "SteamLobbyChat.generated.h"
+
+/////////////////////////////////////////////////////////////////////////////////////
+// STEAM LOBBY CHAT - NOTES                                                        //
+/////////////////////////////////////////////////////////////////////////////////////
+// 1. Wire format: [kind][payload]. Text is UTF-8 without the NUL, Ready is one   //
+//    byte, Emote a little endian uint16, Binary whatever the game puts there.   //
+// 2. LobbyChatMsg_t reads the entry straight into the next slot of a fixed     //
+//    ring, slots are allocated once and reused, nothing per message.          //
+// 3. Text becomes an FString only when something renders it, the string      //
+//    keeps its capacity for whatever lands in that slot next.               //
+// 4. Steam echoes our own messages back, they enter the ring like any      //
+//    other. Sends are rate limited below Steam's own limit.               //
+// 5. Game thread only.                                                   //
+///////////////////////////////////////////////////////////////////////////
+
+UENUM(BlueprintType)
+enum class ESteamLobbyChatKind : uint8
+{
+    Text,
+    Ready,  // Quick "ready / not ready" ping, not the roster's Ready member data
+    Emote,
+    Binary  // Game-defined payload, C++ only
+};
+///////////////////////////////////////
+// STRUCT TO HOLD CHAT COUNTERS      //
+///////////////////////////////////////
+USTRUCT(BlueprintType)
+struct FSteamLobbyChatStats
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Steam|Lobby Chat")
+    int64 Received = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Steam|Lobby Chat")
+    int64 Sent = 0;
+
+    // Oversized, malformed or from someone not in the roster
+    UPROPERTY(BlueprintReadOnly, Category = "Steam|Lobby Chat")
+    int64 DroppedIncoming = 0;
+
+    // Over the send rate, too long, or refused by Steam
+    UPROPERTY(BlueprintReadOnly, Category = "Steam|Lobby Chat")
+    int64 DroppedOutgoing = 0;
+
+    // Text messages actually turned into display strings
+    UPROPERTY(BlueprintReadOnly, Category = "Steam|Lobby Chat")
+    int64 DisplayConversions = 0;
+
+    // Received during the last full second
+    UPROPERTY(BlueprintReadOnly, Category = "Steam|Lobby Chat")
+    int32 MessagesPerSecond = 0;
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnLobbyChatMessage, int32, MessageId, ESteamLobbyChatKind, Kind, const FSteamLobbyMember&, Sender);
+////////////////
+// MAIN BODY //
+////////////////
+UCLASS()
+class URBANSHADOWS_API USteamLobbyChatSubsystem : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+    // Benchmarks replay chat callbacks directly
+    friend class USteamLobbyBenchmarkCommandlet;
+
+public:
+    static constexpr int32 Capacity = 128;        // Messages kept, power of two
+    static constexpr int32 MaxMessageBytes = 512; // Kind byte included, longer entries are dropped
+
+    //////////////////////////////////////////////
+    // 1. Subsystem Lifecycle                  //
+    ////////////////////////////////////////////
+    virtual void Deinitialize() override;
+
+    //////////////////////////////////////////////
+    // 2. Lobby Chat                           //
+    ////////////////////////////////////////////
+    // Called by USteamMultiplayer when a lobby is entered / left
+    void StartLobbyChat(FSteamLobbyId LobbyID);
+    void StopLobbyChat();
+
+    UFUNCTION(BlueprintPure, Category = "Steam|Lobby Chat")
+    bool IsLobbyChatActive() const { return LobbyID.IsValid(); }
+
+    // False when it was not sent (no lobby, empty or too long, over the send rate)
+    UFUNCTION(BlueprintCallable, Category = "Steam|Lobby Chat")
+    bool SendText(const FString& Text);
+
+    UFUNCTION(BlueprintCallable, Category = "Steam|Lobby Chat")
+    bool SendReady(bool bReady);
+
+    UFUNCTION(BlueprintCallable, Category = "Steam|Lobby Chat")
+    bool SendEmote(int32 EmoteId);
+
+    bool SendBinary(const uint8* Data, int32 Size);
+
+    // Fires once per message that made it into the ring, Sender is its roster row
+    UPROPERTY(BlueprintAssignable, Category = "Steam|Lobby Chat")
+    FOnLobbyChatMessage OnLobbyChatMessage;
+
+    //////////////////////////////////////////////
+    // 3. Reading Messages                     //
+    ////////////////////////////////////////////
+    // IDs only grow. [Oldest, Next) may still have holes where entries were dropped, check IsMessageValid
+    UFUNCTION(BlueprintPure, Category = "Steam|Lobby Chat")
+    int32 GetOldestMessageId() const { return FMath::Max(FirstMessageId, NextMessageId - Capacity); }
+
+    UFUNCTION(BlueprintPure, Category = "Steam|Lobby Chat")
+    int32 GetNextMessageId() const { return NextMessageId; }
+
+    // False once the slot went to a newer message
+    UFUNCTION(BlueprintPure, Category = "Steam|Lobby Chat")
+    bool IsMessageValid(int32 MessageId) const { return FindSlot(MessageId) != nullptr; }
+
+    // Converted on the first call for each message, empty for anything but Text
+    UFUNCTION(BlueprintCallable, Category = "Steam|Lobby Chat")
+    FString GetMessageText(int32 MessageId) { return GetMessageDisplay(MessageId); }
+
+    // Same without the copy, valid until the message leaves the ring
+    const FString& GetMessageDisplay(int32 MessageId);
+
+    UFUNCTION(BlueprintPure, Category = "Steam|Lobby Chat")
+    ESteamLobbyChatKind GetMessageKind(int32 MessageId) const;
+
+    // INDEX_NONE when the message is not an emote
+    UFUNCTION(BlueprintPure, Category = "Steam|Lobby Chat")
+    int32 GetMessageEmote(int32 MessageId) const;
+
+    UFUNCTION(BlueprintPure, Category = "Steam|Lobby Chat")
+    bool GetMessageReady(int32 MessageId) const;
+
+    uint64 GetMessageSender(int32 MessageId) const;
+
+    // Payload without the kind byte, empty for an invalid ID
+    TArrayView<const uint8> GetMessagePayload(int32 MessageId) const;
+
+    UFUNCTION(BlueprintCallable, Category = "Steam|Lobby Chat")
+    FSteamLobbyChatStats GetChatStats() const;
+
+private:
+    //////////////////////////////////////////////
+    // 1. Private Data Members                 //
+    ////////////////////////////////////////////
+    struct FSlot
+    {
+        int32 MessageId = INDEX_NONE;
+        uint64 SenderID = 0;
+        ESteamLobbyChatKind Kind = ESteamLobbyChatKind::Text;
+        uint16 Size = 0;             // Payload bytes, after the kind byte
+        bool bDisplayReady = false;
+        FString Display;             // Built on first render
+        uint8 Data[MaxMessageBytes]; // Entry as Steam handed it over, kind byte first
+    };
+
+    FSteamLobbyId LobbyID;
+    TArray<FSlot> Slots; // Allocated on the first lobby, kept for the next ones
+    int32 FirstMessageId = 0; // First ID of the current lobby, IDs from earlier lobbies stay invalid
+    int32 NextMessageId = 0;
+    FSteamLobbyChatStats Stats;
+
+    // Fixed one-second windows, the last full one is the rate
+    double RateWindowStart = 0.0;
+    int32 RateWindowCount = 0;
+    int32 LastRateCount = 0;
+    double SendWindowStart = 0.0;
+    int32 SendWindowCount = 0;
+
+    // Manual dispatch: STEAM_CALLBACK never fires, chat messages come through the backend router
+    ISteamBackend* RoutedBackend = nullptr;
+    FSteamCallbackRouter::FHandle ChatMsgHandle = 0;
+
+    //////////////////////////////////////////////
+    // 2. Private Functions                    //
+    ////////////////////////////////////////////
+    USteamMultiplayer* GetMultiplayer() const;
+    bool Send(ESteamLobbyChatKind Kind, const uint8* Payload, int32 Size);
+    const FSlot* FindSlot(int32 MessageId) const;
+    void CountReceived(double Now);
+
+    STEAM_CALLBACK(USteamLobbyChatSubsystem, OnLobbyChatMsg, LobbyChatMsg_t);
+};
+///////////////////////////////////////////
+// MORE COMING SOON  // A.S. - hajddeen //
+/////////////////////////////////////////
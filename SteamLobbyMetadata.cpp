@@ -0,0 +1,298 @@
+// |------------------------------------|
+// |  !FOLLOW URBAN SHADOWS ON SOCIALS! |
+// |------------------------------------|
+//            \ (^ᴗ^) /
+//             \     /
+//              -----
+//              |   |
+//              |   |
+//              |_  |_
+////////////////////////////////////////////////////////////
+// STEAM P2P SESSIONS - Unreal 5.5 + Steamworks SDK 1.57 //
+//////////////////////////////////////////////////////////////////
+// LICENSE AGREEMENT // LICENSE AGREEMENT // LICENSE AGREEMENT //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                                                                                                                                                                                                                                          //
+// Last Updated: 03/12/2024                                                                                                                                                                                                                                //
+//                                                                                                                                                                                                                                                        //
+// 1. Grant of License                                                                                                                                                                                                                                   //
+// This license permits anyone to use, modify, and distribute the provided code (the "Code") in projects free of charge under the following conditions:                                                                                                 //
+// 1.1. The Code must only be used for lawful purposes.                                                                                                                                                                                                //
+// 1.2. The user must include proper credit in their project as described in Section 3 below.                                                                                                                                                         //
+//                                                                                                                                                                                                                                                   //
+// 2. Restrictions                                                                                                                                                                                                                                  //
+// 2.1. This Code cannot be sold, sublicensed, or redistributed as a standalone product or as part of a similar development toolkit.                                                                                                               //
+// 2.2. The Code must not be used for projects that violate local laws or promote harmful, discriminatory, or illegal activities.                                                                                                                 //
+// 2.3. The user must not remove, alter, or obscure this license agreement, attribution requirements, or copyright notices within the Code.                                                                                                      //
+//                                                                                                                                                                                                                                              //
+// 3. Attribution                                                                                                                                                                                                                              //
+// 3.1. The user must include the following credit in a visible location within their project (e.g., splash screen, credits screen, or documentation):                                                                                        //
+// "Steam Multiplayer Code developed by Adrian Szajewski. Used under license."                                                                                                                                                               //
+// 3.2. For distributed or published projects, a link to https://adrianszajewskidev.wordpress.com/ or other contact details must also be included if applicable.                                                                            //
+//                                                                                                                                                                                                                                         //
+// 4. Breach of Agreement                                                                                                                                                                                                                 //
+// 4.1. If this license is violated, the licensor reserves the right to revoke the user's rights to use the Code immediately.                                                                                                            //
+// 4.2. The licensor may take legal action to recover damages or enforce compliance, depending on the severity of the violation.                                                                                                        //
+// 4.3. Users found in breach of this license may be required to:                                                                                                                                                                      //
+// Remove the Code from their project(s).                                                                                                                                                                                             //
+// Cease distribution of any projects using the Code.                                                                                                                                                                                //
+//                                                                                                                                                                                                                                  //
+// 5. Disclaimer                                                                                                                                                                                                                   //
+// 5.1. The Code is provided "as is" without any warranty, express or implied. The licensor is not liable for any damages arising from the use or misuse of the Code.                                                             //
+// 5.2. It is the user's responsibility to ensure compatibility and safe usage of the Code in their projects.                                                                                                                    //
+//                                                                                                                                                                                                                              //
+// 6. Governing Law                                                                                                                                                                                                            //
+// This agreement shall be governed and construed in accordance with the laws of Poland. Any disputes arising under or in connection with this license will be subject to the exclusive jurisdiction of the courts of Poland. //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// INCLUDE //
+////////////
+#include "SteamLobbyMetadata.h"
+/////////////////////////
+// Blob Format        //
+////////////////////////////////////////////////////
+// Version <US> HostName <US> MapName <US> GameMode <US> BuildVersion //
+/////////////////////////////////////////////////
+namespace
+{
+namespace SteamLobbyMetadata
+{
+    constexpr UTF8CHAR Separator = (UTF8CHAR)0x1F;
+
+    void AppendField(TUtf8StringBuilderBase& Out, const FString& Value)
+    {
+        FTCHARToUTF8 Utf8(*Value);
+        for (int32 i = 0; i < Utf8.Length(); ++i)
+        {
+            // Separator inside a value would shift every following field
+            const UTF8CHAR Char = (UTF8CHAR)Utf8.Get()[i];
+            if (Char != Separator)
+            {
+                Out.AppendChar(Char);
+            }
+        }
+        Out.AppendChar(Separator);
+    }
+
+    bool NextField(FUtf8StringView& Remaining, FUtf8StringView& OutField)
+    {
+        if (Remaining.IsEmpty())
+        {
+            return false;
+        }
+        else
+        {
+            int32 SeparatorIndex = INDEX_NONE;
+            if (Remaining.FindChar(Separator, SeparatorIndex))
+            {
+                OutField = Remaining.Left(SeparatorIndex);
+                Remaining.RightChopInline(SeparatorIndex + 1);
+            }
+            else
+            {
+                OutField = Remaining;
+                Remaining = FUtf8StringView();
+            }
+            return true;
+        }
+    }
+
+    bool ParseInt(FUtf8StringView Field, int32& OutValue)
+    {
+        int64 Value = 0;
+        bool bNegative = false;
+        int32 i = 0;
+        if (Field.Len() > 0 && Field[0] == '-')
+        {
+            bNegative = true;
+            ++i;
+        }
+        if (i >= Field.Len())
+        {
+            return false;
+        }
+
+        // Checked every digit, Value never passes 2^31 before the next multiply
+        const int64 Limit = bNegative ? -(int64)MIN_int32 : (int64)MAX_int32;
+        for (; i < Field.Len(); ++i)
+        {
+            if (Field[i] < '0' || Field[i] > '9')
+            {
+                return false;
+            }
+            Value = Value * 10 + (Field[i] - '0');
+            if (Value > Limit)
+            {
+                return false;
+            }
+        }
+        OutValue = (int32)(bNegative ? -Value : Value);
+        return true;
+    }
+
+    bool ParseUInt64(FUtf8StringView Field, uint64& OutValue)
+    {
+        OutValue = 0;
+        if (Field.IsEmpty())
+        {
+            return false;
+        }
+        for (int32 i = 0; i < Field.Len(); ++i)
+        {
+            const uint64 Digit = (uint64)(Field[i] - '0');
+            if (Field[i] < '0' || Field[i] > '9' || OutValue > (MAX_uint64 - Digit) / 10)
+            {
+                return false;
+            }
+            OutValue = OutValue * 10 + Digit;
+        }
+        return true;
+    }
+
+    FString ToString(FUtf8StringView Field)
+    {
+        return FString(Field.Len(), Field.GetData());
+    }
+}
+}
+/////////////////////////
+// 1. Encode / Parse  //
+//////////////////////////////////////
+// 1.1 - Pack metadata into a blob  //
+// 1.2 - Parse a blob in place     //
+// 1.3 - Pack a session blob      //
+// 1.4 - Parse a session blob    //
+//////////////////////////////////
+// - 1.1 - //
+void FLobbyMetadata::Encode(TUtf8StringBuilderBase& Out) const
+{
+    Out << Version;
+    Out.AppendChar(SteamLobbyMetadata::Separator);
+    SteamLobbyMetadata::AppendField(Out, HostName);
+    SteamLobbyMetadata::AppendField(Out, MapName);
+    SteamLobbyMetadata::AppendField(Out, GameMode);
+    Out << BuildVersion;
+}
+// - 1.2 - //
+bool FLobbyMetadataView::Parse(const char* Blob, FLobbyMetadataView& Out)
+{
+    if (!Blob || !*Blob)
+    {
+        return false;
+    }
+    else
+    {
+        FUtf8StringView Remaining((const UTF8CHAR*)Blob);
+        FUtf8StringView Field;
+
+        int32 BlobVersion = 0;
+        if (!SteamLobbyMetadata::NextField(Remaining, Field) || !SteamLobbyMetadata::ParseInt(Field, BlobVersion) || BlobVersion < 1)
+        {
+            return false;
+        }
+        else
+        {
+            // Newer writers append after BuildVersion, whatever follows it is left unread
+            FUtf8StringView BuildVersionField;
+            const bool bComplete = SteamLobbyMetadata::NextField(Remaining, Out.HostName)
+                && SteamLobbyMetadata::NextField(Remaining, Out.MapName)
+                && SteamLobbyMetadata::NextField(Remaining, Out.GameMode)
+                && SteamLobbyMetadata::NextField(Remaining, BuildVersionField);
+            return bComplete && SteamLobbyMetadata::ParseInt(BuildVersionField, Out.BuildVersion);
+        }
+    }
+}
+// - 1.3 - //
+void FSteamSessionSnapshot::Encode(TUtf8StringBuilderBase& Out) const
+{
+    Out << Version;
+    Out.AppendChar(SteamLobbyMetadata::Separator);
+    Out << Sequence;
+    Out.AppendChar(SteamLobbyMetadata::Separator);
+    Out << HostSteamID;
+    Out.AppendChar(SteamLobbyMetadata::Separator);
+    SteamLobbyMetadata::AppendField(Out, MapName);
+    SteamLobbyMetadata::AppendField(Out, GameMode);
+    Out << MatchState;
+    Out.AppendChar(SteamLobbyMetadata::Separator);
+    Out << MatchSeconds;
+    Out.AppendChar(SteamLobbyMetadata::Separator);
+
+    const int32 NumSlots = FMath::Min(Slots.Num(), MaxSlots);
+    Out << NumSlots;
+    for (int32 i = 0; i < NumSlots; ++i)
+    {
+        Out.AppendChar(SteamLobbyMetadata::Separator);
+        Out << Slots[i].SteamID;
+        Out.AppendChar(SteamLobbyMetadata::Separator);
+        Out << Slots[i].Team;
+        Out.AppendChar(SteamLobbyMetadata::Separator);
+        Out << Slots[i].Score;
+    }
+}
+// - 1.4 - //
+bool FSteamSessionSnapshot::Parse(const char* Blob, FSteamSessionSnapshot& Out)
+{
+    if (!Blob || !*Blob)
+    {
+        return false;
+    }
+    else
+    {
+        FUtf8StringView Remaining((const UTF8CHAR*)Blob);
+        FUtf8StringView Field;
+
+        int32 BlobVersion = 0;
+        if (!SteamLobbyMetadata::NextField(Remaining, Field) || !SteamLobbyMetadata::ParseInt(Field, BlobVersion) || BlobVersion < 1)
+        {
+            return false;
+        }
+        else
+        {
+            FUtf8StringView SequenceField, HostField, MapField, ModeField, StateField, SecondsField, NumSlotsField;
+            int32 NumSlots = 0;
+            const bool bHeader = SteamLobbyMetadata::NextField(Remaining, SequenceField)
+                && SteamLobbyMetadata::NextField(Remaining, HostField)
+                && SteamLobbyMetadata::NextField(Remaining, MapField)
+                && SteamLobbyMetadata::NextField(Remaining, ModeField)
+                && SteamLobbyMetadata::NextField(Remaining, StateField)
+                && SteamLobbyMetadata::NextField(Remaining, SecondsField)
+                && SteamLobbyMetadata::NextField(Remaining, NumSlotsField)
+                && SteamLobbyMetadata::ParseInt(SequenceField, Out.Sequence)
+                && SteamLobbyMetadata::ParseUInt64(HostField, Out.HostSteamID)
+                && SteamLobbyMetadata::ParseInt(StateField, Out.MatchState)
+                && SteamLobbyMetadata::ParseInt(SecondsField, Out.MatchSeconds)
+                && SteamLobbyMetadata::ParseInt(NumSlotsField, NumSlots)
+                && NumSlots >= 0 && NumSlots <= MaxSlots;
+            if (!bHeader)
+            {
+                return false;
+            }
+            else
+            {
+                Out.MapName = SteamLobbyMetadata::ToString(MapField);
+                Out.GameMode = SteamLobbyMetadata::ToString(ModeField);
+                Out.Slots.SetNum(NumSlots);
+                for (FSteamSessionSlot& Slot : Out.Slots)
+                {
+                    FUtf8StringView IdField, TeamField, ScoreField;
+                    const bool bSlot = SteamLobbyMetadata::NextField(Remaining, IdField)
+                        && SteamLobbyMetadata::NextField(Remaining, TeamField)
+                        && SteamLobbyMetadata::NextField(Remaining, ScoreField)
+                        && SteamLobbyMetadata::ParseUInt64(IdField, Slot.SteamID)
+                        && SteamLobbyMetadata::ParseInt(TeamField, Slot.Team)
+                        && SteamLobbyMetadata::ParseInt(ScoreField, Slot.Score);
+                    if (!bSlot)
+                    {
+                        return false;
+                    }
+                }
+
+                // Fields a newer version appended after the slots are left unread
+                return true;
+            }
+        }
+    }
+}
+///////////////////////////////////////////
+// MORE COMING SOON  // A.S. - hajddeen //
+/////////////////////////////////////////
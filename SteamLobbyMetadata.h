@@ -0,0 +1,171 @@
+// |------------------------------------|
+// |  !FOLLOW URBAN SHADOWS ON SOCIALS! |
+// |------------------------------------|
+//            \ (^ᴗ^) /
+//             \     /
+//              -----
+//              |   |
+//              |   |
+//              |_  |_ 
+////////////////////////////////////////////////////////////
+// STEAM P2P SESSIONS - Unreal 5.5 + Steamworks SDK 1.57 //
+//////////////////////////////////////////////////////////////////
+// LICENSE AGREEMENT // LICENSE AGREEMENT // LICENSE AGREEMENT //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                                                                                                                                                                                                                                          //
+// Last Updated: 03/12/2024                                                                                                                                                                                                                                //
+//                                                                                                                                                                                                                                                        //
+// 1. Grant of License                                                                                                                                                                                                                                   //
+// This license permits anyone to use, modify, and distribute the provided code (the "Code") in projects free of charge under the following conditions:                                                                                                 //
+// 1.1. The Code must only be used for lawful purposes.                                                                                                                                                                                                //
+// 1.2. The user must include proper credit in their project as described in Section 3 below.                                                                                                                                                         //
+//                                                                                                                                                                                                                                                   //
+// 2. Restrictions                                                                                                                                                                                                                                  //
+// 2.1. This Code cannot be sold, sublicensed, or redistributed as a standalone product or as part of a similar development toolkit.                                                                                                               //
+// 2.2. The Code must not be used for projects that violate local laws or promote harmful, discriminatory, or illegal activities.                                                                                                                 //
+// 2.3. The user must not remove, alter, or obscure this license agreement, attribution requirements, or copyright notices within the Code.                                                                                                      //
+//                                                                                                                                                                                                                                              //
+// 3. Attribution                                                                                                                                                                                                                              //
+// 3.1. The user must include the following credit in a visible location within their project (e.g., splash screen, credits screen, or documentation):                                                                                        //
+// "Steam Multiplayer Code developed by Adrian Szajewski. Used under license."                                                                                                                                                               //
+// 3.2. For distributed or published projects, a link to https://adrianszajewskidev.wordpress.com/ or other contact details must also be included if applicable.                                                                            //
+//                                                                                                                                                                                                                                         //
+// 4. Breach of Agreement                                                                                                                                                                                                                 //
+// 4.1. If this license is violated, the licensor reserves the right to revoke the user's rights to use the Code immediately.                                                                                                            //
+// 4.2. The licensor may take legal action to recover damages or enforce compliance, depending on the severity of the violation.                                                                                                        //
+// 4.3. Users found in breach of this license may be required to:                                                                                                                                                                      //
+// Remove the Code from their project(s).                                                                                                                                                                                             //
+// Cease distribution of any projects using the Code.                                                                                                                                                                                //
+//                                                                                                                                                                                                                                  //
+// 5. Disclaimer                                                                                                                                                                                                                   //
+// 5.1. The Code is provided "as is" without any warranty, express or implied. The licensor is not liable for any damages arising from the use or misuse of the Code.                                                             //
+// 5.2. It is the user's responsibility to ensure compatibility and safe usage of the Code in their projects.                                                                                                                    //
+//                                                                                                                                                                                                                              //
+// 6. Governing Law                                                                                                                                                                                                            //
+// This agreement shall be governed and construed in accordance with the laws of Poland. Any disputes arising under or in connection with this license will be subject to the exclusive jurisdiction of the courts of Poland. //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+/////////////////////////////////////////////////////////
+// INCLUDE //
+////////////
+#include "CoreMinimal.h"
+#include "Misc/StringBuilder.h"
+#include "SteamLobbyMetadata.generated.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////
+// LOBBY METADATA SCHEMA                                                              //
+/////////////////////////////////////////////////////////////////////////////////////////
+// 1. Everything the browser only displays lives in one versioned "Meta" lobby key.   //
+// 2. Fields Steam filters on (GameKey, Region) stay as their own keys.              //
+// 3. Lobby data values are NUL terminated strings, so the blob is packed text:     //
+//    version and fields separated by 0x1F, numbers as decimal.                    //
+// 4. Adding a field = append it at the end and bump Version. Readers accept      //
+//    any Version >= 1 and skip fields past the ones they know.                  //
+//////////////////////////////////////////////////////////////////////////////////
+USTRUCT(BlueprintType)
+struct FLobbyMetadata
+{
+    GENERATED_BODY()
+
+    static constexpr int32 Version = 1;
+    static constexpr const char* BlobKey = "Meta";
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lobby Metadata")
+    FString HostName;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lobby Metadata")
+    FString MapName = TEXT("/Game/Maps/Map_Lobby");
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lobby Metadata")
+    FString GameMode;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lobby Metadata")
+    int32 BuildVersion = 0;
+
+    // Packs every field into one blob for SetLobbyData(BlobKey, ...)
+    void Encode(TUtf8StringBuilderBase& Out) const;
+};
+//////////////////////////////////////////////
+// ZERO-COPY VIEW OVER A RECEIVED BLOB     //
+//////////////////////////////////////////////
+// Views point straight into the string Steam returned from GetLobbyData,
+// only valid until that lobby's data changes. Convert to FString for display only.
+struct FLobbyMetadataView
+{
+    FUtf8StringView HostName;
+    FUtf8StringView MapName;
+    FUtf8StringView GameMode;
+    int32 BuildVersion = 0;
+
+    // False for empty or malformed blobs, newer versions give their known leading fields
+    static bool Parse(const char* Blob, FLobbyMetadataView& Out);
+};
+/////////////////////////////////////////////////////////////////////////////////////////
+// SESSION SNAPSHOT SCHEMA                                                            //
+/////////////////////////////////////////////////////////////////////////////////////////
+// 1. What a new host needs to carry the match on, one "Session" lobby key.           //
+//    Steam keeps lobby data after the host is gone, so every member already         //
+//    holds the last snapshot when it has to take over.                             //
+// 2. Same packed text as the metadata blob: version, sequence, host, map,         //
+//    mode, match state, match seconds, slot count, then per slot                 //
+//    SteamID, team and score.                                                   //
+// 3. Slot order is the order hosts are picked in when the host leaves.         //
+// 4. Adding a field = append it after the slots and bump Version, older       //
+//    readers take the fields they know and skip the rest.                    //
+///////////////////////////////////////////////////////////////////////////////
+USTRUCT(BlueprintType)
+struct FSteamSessionSlot
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    uint64 SteamID = 0;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Session Snapshot")
+    int32 Team = 0;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Session Snapshot")
+    int32 Score = 0;
+};
+
+USTRUCT(BlueprintType)
+struct FSteamSessionSnapshot
+{
+    GENERATED_BODY()
+
+    static constexpr int32 Version = 1;
+    static constexpr const char* BlobKey = "Session";
+    static constexpr int32 MaxSlots = 64; // Parse stops here, Steam lobbies cap at 250 but the blob must stay small
+
+    // Filled in by the host on every publish
+    UPROPERTY(BlueprintReadOnly, Category = "Session Snapshot")
+    int32 Sequence = 0;
+
+    UPROPERTY()
+    uint64 HostSteamID = 0;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Session Snapshot")
+    FString MapName;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Session Snapshot")
+    FString GameMode;
+
+    // Game defined, usually a match phase enum
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Session Snapshot")
+    int32 MatchState = 0;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Session Snapshot")
+    int32 MatchSeconds = 0;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Session Snapshot")
+    TArray<FSteamSessionSlot> Slots;
+
+    // Packs every field into one blob for SetLobbyData(BlobKey, ...)
+    void Encode(TUtf8StringBuilderBase& Out) const;
+
+    // Copies out, only read when a migration needs it. False for empty, malformed or newer-version blobs
+    static bool Parse(const char* Blob, FSteamSessionSnapshot& Out);
+};
+///////////////////////////////////////////
+// MORE COMING SOON  // A.S. - hajddeen //
+/////////////////////////////////////////
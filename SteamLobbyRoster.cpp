@@ -0,0 +1,239 @@
+// |------------------------------------|
+// |  !FOLLOW URBAN SHADOWS ON SOCIALS! |
+// |------------------------------------|
+//            \ (^ᴗ^) /
+//             \     /
+//              -----
+//              |   |
+//              |   |
+//              |_  |_
+////////////////////////////////////////////////////////////
+// STEAM P2P SESSIONS - Unreal 5.5 + Steamworks SDK 1.57 //
+//////////////////////////////////////////////////////////////////
+// LICENSE AGREEMENT // LICENSE AGREEMENT // LICENSE AGREEMENT //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                                                                                                                                                                                                                                          //
+// Last Updated: 03/12/2024                                                                                                                                                                                                                                //
+//                                                                                                                                                                                                                                                        //
+// 1. Grant of License                                                                                                                                                                                                                                   //
+// This license permits anyone to use, modify, and distribute the provided code (the "Code") in projects free of charge under the following conditions:                                                                                                 //
+// 1.1. The Code must only be used for lawful purposes.                                                                                                                                                                                                //
+// 1.2. The user must include proper credit in their project as described in Section 3 below.                                                                                                                                                         //
+//                                                                                                                                                                                                                                                   //
+// 2. Restrictions                                                                                                                                                                                                                                  //
+// 2.1. This Code cannot be sold, sublicensed, or redistributed as a standalone product or as part of a similar development toolkit.                                                                                                               //
+// 2.2. The Code must not be used for projects that violate local laws or promote harmful, discriminatory, or illegal activities.                                                                                                                 //
+// 2.3. The user must not remove, alter, or obscure this license agreement, attribution requirements, or copyright notices within the Code.                                                                                                      //
+//                                                                                                                                                                                                                                              //
+// 3. Attribution                                                                                                                                                                                                                              //
+// 3.1. The user must include the following credit in a visible location within their project (e.g., splash screen, credits screen, or documentation):                                                                                        //
+// "Steam Multiplayer Code developed by Adrian Szajewski. Used under license."                                                                                                                                                               //
+// 3.2. For distributed or published projects, a link to https://adrianszajewskidev.wordpress.com/ or other contact details must also be included if applicable.                                                                            //
+//                                                                                                                                                                                                                                         //
+// 4. Breach of Agreement                                                                                                                                                                                                                 //
+// 4.1. If this license is violated, the licensor reserves the right to revoke the user's rights to use the Code immediately.                                                                                                            //
+// 4.2. The licensor may take legal action to recover damages or enforce compliance, depending on the severity of the violation.                                                                                                        //
+// 4.3. Users found in breach of this license may be required to:                                                                                                                                                                      //
+// Remove the Code from their project(s).                                                                                                                                                                                             //
+// Cease distribution of any projects using the Code.                                                                                                                                                                                //
+//                                                                                                                                                                                                                                  //
+// 5. Disclaimer                                                                                                                                                                                                                   //
+// 5.1. The Code is provided "as is" without any warranty, express or implied. The licensor is not liable for any damages arising from the use or misuse of the Code.                                                             //
+// 5.2. It is the user's responsibility to ensure compatibility and safe usage of the Code in their projects.                                                                                                                    //
+//                                                                                                                                                                                                                              //
+// 6. Governing Law                                                                                                                                                                                                            //
+// This agreement shall be governed and construed in accordance with the laws of Poland. Any disputes arising under or in connection with this license will be subject to the exclusive jurisdiction of the courts of Poland. //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////
+// INCLUDE //
+////////////
+#include "SteamLobbyRoster.h"
+///////////////////////
+// 1. Lobby Roster  //
+//////////////////////////////////////////////
+// 1.1 - Rebuild from a full member scan   //
+// 1.2 - Empty the roster                 //
+// 1.3 - Member joined                   //
+// 1.4 - Member left                    //
+// 1.5 - Member data changed           //
+// 1.6 - Member name changed          //
+// 1.7 - Find a member               //
+// 1.8 - Read one member from Steam //
+/////////////////////////////////////
+// - 1.1 - //
+void FSteamLobbyRoster::Rebuild(ISteamBackend& Steam, CSteamID InLobbyID, const TArray<FString>& InWatchedKeys)
+{
+    Reset();
+    LobbyID = InLobbyID;
+    if (!LobbyID.IsValid())
+    {
+        return;
+    }
+    else
+    {
+        WatchedKeys = InWatchedKeys;
+        WatchedKeys.AddUnique(UTF8_TO_TCHAR(ReadyKey));
+        WatchedKeysUtf8.Reserve(WatchedKeys.Num());
+        for (const FString& Key : WatchedKeys)
+        {
+            const FTCHARToUTF8 Utf8Key(*Key);
+            TArray<ANSICHAR>& Converted = WatchedKeysUtf8.AddDefaulted_GetRef();
+            Converted.Append((const ANSICHAR*)Utf8Key.Get(), Utf8Key.Length());
+            Converted.Add('\0');
+        }
+
+        const int32 NumMembers = Steam.GetNumLobbyMembers(LobbyID);
+        Members.Reserve(NumMembers);
+        MemberRows.Reserve(NumMembers);
+        for (int32 i = 0; i < NumMembers; ++i)
+        {
+            FSteamLobbyMember Member;
+            AddMember(Steam, Steam.GetLobbyMemberByIndex(LobbyID, i), Member);
+        }
+    }
+}
+// - 1.2 - //
+void FSteamLobbyRoster::Reset()
+{
+    LobbyID = CSteamID();
+    Members.Reset();
+    MemberRows.Reset();
+    WatchedKeys.Reset();
+    WatchedKeysUtf8.Reset();
+    NumReady = 0;
+}
+// - 1.3 - //
+bool FSteamLobbyRoster::AddMember(ISteamBackend& Steam, CSteamID MemberID, FSteamLobbyMember& OutMember)
+{
+    const uint64 SteamID = MemberID.ConvertToUint64();
+    if (!MemberID.IsValid() || MemberRows.Contains(SteamID))
+    {
+        return false;
+    }
+    else
+    {
+        FSteamLobbyMember& Member = Members.AddDefaulted_GetRef();
+        ReadMember(Steam, MemberID, Member);
+        MemberRows.Add(SteamID, Members.Num() - 1);
+        NumReady += Member.bReady ? 1 : 0;
+        OutMember = Member;
+        return true;
+    }
+}
+// - 1.4 - //
+bool FSteamLobbyRoster::RemoveMember(CSteamID MemberID, FSteamLobbyMember& OutMember)
+{
+    int32 Row = INDEX_NONE;
+    if (!MemberRows.RemoveAndCopyValue(MemberID.ConvertToUint64(), Row))
+    {
+        return false;
+    }
+    else
+    {
+        OutMember = MoveTemp(Members[Row]);
+        NumReady -= OutMember.bReady ? 1 : 0;
+
+        // Swap the last row in, one index fix-up instead of shifting everyone
+        Members.RemoveAtSwap(Row, 1, EAllowShrinking::No);
+        if (Members.IsValidIndex(Row))
+        {
+            MemberRows.Add(Members[Row].SteamID, Row);
+        }
+        return true;
+    }
+}
+// - 1.5 - //
+bool FSteamLobbyRoster::RefreshMemberData(ISteamBackend& Steam, CSteamID MemberID, TArray<FString>& OutChangedKeys)
+{
+    OutChangedKeys.Reset();
+    const int32* Row = MemberRows.Find(MemberID.ConvertToUint64());
+    if (!Row)
+    {
+        return false;
+    }
+    else
+    {
+        // The update does not say which key moved, diff the watched ones
+        FSteamLobbyMember& Member = Members[*Row];
+        for (int32 i = 0; i < WatchedKeys.Num(); ++i)
+        {
+            const char* Value = Steam.GetLobbyMemberData(LobbyID, MemberID, WatchedKeysUtf8[i].GetData());
+            const FString* Current = Member.Data.Find(WatchedKeys[i]);
+            if (!Value || !*Value)
+            {
+                if (Current)
+                {
+                    Member.Data.Remove(WatchedKeys[i]);
+                    OutChangedKeys.Add(WatchedKeys[i]);
+                }
+            }
+            else
+            {
+                FString NewValue = UTF8_TO_TCHAR(Value);
+                if (!Current || !Current->Equals(NewValue, ESearchCase::CaseSensitive))
+                {
+                    Member.Data.Add(WatchedKeys[i], MoveTemp(NewValue));
+                    OutChangedKeys.Add(WatchedKeys[i]);
+                }
+            }
+        }
+
+        const bool bWasReady = Member.bReady;
+        const FString* Ready = Member.Data.Find(UTF8_TO_TCHAR(ReadyKey));
+        Member.bReady = Ready && *Ready == TEXT("1");
+        NumReady += (Member.bReady ? 1 : 0) - (bWasReady ? 1 : 0);
+        return OutChangedKeys.Num() > 0;
+    }
+}
+// - 1.6 - //
+bool FSteamLobbyRoster::RefreshMemberName(ISteamBackend& Steam, CSteamID MemberID)
+{
+    const int32* Row = MemberRows.Find(MemberID.ConvertToUint64());
+    if (!Row)
+    {
+        return false;
+    }
+    else
+    {
+        const char* Name = Steam.GetFriendPersonaName(MemberID);
+        FString NewName = Name ? UTF8_TO_TCHAR(Name) : TEXT("Unknown");
+        if (Members[*Row].PlayerName.Equals(NewName, ESearchCase::CaseSensitive))
+        {
+            return false;
+        }
+        else
+        {
+            Members[*Row].PlayerName = MoveTemp(NewName);
+            return true;
+        }
+    }
+}
+// - 1.7 - //
+const FSteamLobbyMember* FSteamLobbyRoster::FindMember(uint64 SteamID) const
+{
+    const int32* Row = MemberRows.Find(SteamID);
+    return Row ? &Members[*Row] : nullptr;
+}
+// - 1.8 - //
+void FSteamLobbyRoster::ReadMember(ISteamBackend& Steam, CSteamID MemberID, FSteamLobbyMember& OutMember) const
+{
+    OutMember.SteamID = MemberID.ConvertToUint64();
+
+    const char* Name = Steam.GetFriendPersonaName(MemberID);
+    OutMember.PlayerName = Name ? UTF8_TO_TCHAR(Name) : TEXT("Unknown");
+
+    for (int32 i = 0; i < WatchedKeys.Num(); ++i)
+    {
+        const char* Value = Steam.GetLobbyMemberData(LobbyID, MemberID, WatchedKeysUtf8[i].GetData());
+        if (Value && *Value)
+        {
+            OutMember.Data.Add(WatchedKeys[i], UTF8_TO_TCHAR(Value));
+        }
+    }
+
+    const FString* Ready = OutMember.Data.Find(UTF8_TO_TCHAR(ReadyKey));
+    OutMember.bReady = Ready && *Ready == TEXT("1");
+}
+///////////////////////////////////////////
+// MORE COMING SOON  // A.S. - hajddeen //
+/////////////////////////////////////////
@@ -0,0 +1,125 @@
+// |------------------------------------|
+// |  !FOLLOW URBAN SHADOWS ON SOCIALS! |
+// |------------------------------------|
+//            \ (^ᴗ^) /
+//             \     /
+//              -----
+//              |   |
+//              |   |
+//              |_  |_ 
+////////////////////////////////////////////////////////////
+// STEAM P2P SESSIONS - Unreal 5.5 + Steamworks SDK 1.57 //
+//////////////////////////////////////////////////////////////////
+// LICENSE AGREEMENT // LICENSE AGREEMENT // LICENSE AGREEMENT //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                                                                                                                                                                                                                                          //
+// Last Updated: 03/12/2024                                                                                                                                                                                                                                //
+//                                                                                                                                                                                                                                                        //
+// 1. Grant of License                                                                                                                                                                                                                                   //
+// This license permits anyone to use, modify, and distribute the provided code (the "Code") in projects free of charge under the following conditions:                                                                                                 //
+// 1.1. The Code must only be used for lawful purposes.                                                                                                                                                                                                //
+// 1.2. The user must include proper credit in their project as described in Section 3 below.                                                                                                                                                         //
+//                                                                                                                                                                                                                                                   //
+// 2. Restrictions                                                                                                                                                                                                                                  //
+// 2.1. This Code cannot be sold, sublicensed, or redistributed as a standalone product or as part of a similar development toolkit.                                                                                                               //
+// 2.2. The Code must not be used for projects that violate local laws or promote harmful, discriminatory, or illegal activities.                                                                                                                 //
+// 2.3. The user must not remove, alter, or obscure this license agreement, attribution requirements, or copyright notices within the Code.                                                                                                      //
+//                                                                                                                                                                                                                                              //
+// 3. Attribution                                                                                                                                                                                                                              //
+// 3.1. The user must include the following credit in a visible location within their project (e.g., splash screen, credits screen, or documentation):                                                                                        //
+// "Steam Multiplayer Code developed by Adrian Szajewski. Used under license."                                                                                                                                                               //
+// 3.2. For distributed or published projects, a link to https://adrianszajewskidev.wordpress.com/ or other contact details must also be included if applicable.                                                                            //
+//                                                                                                                                                                                                                                         //
+// 4. Breach of Agreement                                                                                                                                                                                                                 //
+// 4.1. If this license is violated, the licensor reserves the right to revoke the user's rights to use the Code immediately.                                                                                                            //
+// 4.2. The licensor may take legal action to recover damages or enforce compliance, depending on the severity of the violation.                                                                                                        //
+// 4.3. Users found in breach of this license may be required to:                                                                                                                                                                      //
+// Remove the Code from their project(s).                                                                                                                                                                                             //
+// Cease distribution of any projects using the Code.                                                                                                                                                                                //
+//                                                                                                                                                                                                                                  //
+// 5. Disclaimer                                                                                                                                                                                                                   //
+// 5.1. The Code is provided "as is" without any warranty, express or implied. The licensor is not liable for any damages arising from the use or misuse of the Code.                                                             //
+// 5.2. It is the user's responsibility to ensure compatibility and safe usage of the Code in their projects.                                                                                                                    //
+//                                                                                                                                                                                                                              //
+// 6. Governing Law                                                                                                                                                                                                            //
+// This agreement shall be governed and construed in accordance with the laws of Poland. Any disputes arising under or in connection with this license will be subject to the exclusive jurisdiction of the courts of Poland. //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+/////////////////////////////////////////////////////////
+// INCLUDE //
+////////////
+#include "CoreMinimal.h"
+#include "SteamBackend.h"
+#include "SteamLobbyRoster.generated.h"
+
+///////////////////////////////////////
+// STRUCT TO HOLD A LOBBY MEMBER     //
+///////////////////////////////////////
+USTRUCT(BlueprintType)
+struct FSteamLobbyMember
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Lobby Member")
+    FString PlayerName;
+
+    UPROPERTY()
+    uint64 SteamID = 0;
+
+    // Watched member keys only (USteamMultiplayer::LobbyMemberDataKeys), unset keys are left out
+    UPROPERTY(BlueprintReadOnly, Category = "Lobby Member")
+    TMap<FString, FString> Data;
+
+    // Data[ReadyKey] == "1"
+    UPROPERTY(BlueprintReadOnly, Category = "Lobby Member")
+    bool bReady = false;
+};
+/////////////////////////////////////////////////////////////////////////////////////
+// STEAM LOBBY ROSTER - NOTES                                                      //
+/////////////////////////////////////////////////////////////////////////////////////
+// 1. One full member scan when we enter a lobby, after that only                 //
+//    LobbyChatUpdate_t (join / leave) and member LobbyDataUpdate_t touch it.    //
+// 2. Steam cannot list a member's keys, so only watched keys are read:         //
+//    one GetLobbyMemberData per watched key of the member that changed.       //
+// 3. Rows are unordered, a leaving member's row is filled by the last one.   //
+// 4. Game thread only.                                                      //
+//////////////////////////////////////////////////////////////////////////////
+class URBANSHADOWS_API FSteamLobbyRoster
+{
+public:
+    static constexpr const char* ReadyKey = "Ready";
+
+    // Full scan of InLobbyID, an invalid ID just empties the roster
+    void Rebuild(ISteamBackend& Steam, CSteamID InLobbyID, const TArray<FString>& InWatchedKeys);
+    void Reset();
+
+    bool IsFor(CSteamID InLobbyID) const { return LobbyID.IsValid() && LobbyID == InLobbyID; }
+    CSteamID GetLobbyID() const { return LobbyID; }
+
+    // False when nothing changed (already a member / not a member)
+    bool AddMember(ISteamBackend& Steam, CSteamID MemberID, FSteamLobbyMember& OutMember);
+    bool RemoveMember(CSteamID MemberID, FSteamLobbyMember& OutMember);
+
+    // Re-reads one member's watched keys, false when none of them changed
+    bool RefreshMemberData(ISteamBackend& Steam, CSteamID MemberID, TArray<FString>& OutChangedKeys);
+
+    // Persona names often land after the join, false when the name is unchanged or not a member
+    bool RefreshMemberName(ISteamBackend& Steam, CSteamID MemberID);
+
+    const TArray<FSteamLobbyMember>& GetMembers() const { return Members; }
+    const FSteamLobbyMember* FindMember(uint64 SteamID) const;
+    bool AreAllReady() const { return Members.Num() > 0 && NumReady == Members.Num(); }
+
+private:
+    CSteamID LobbyID;
+    TArray<FSteamLobbyMember> Members;
+    TMap<uint64, int32> MemberRows;           // SteamID -> row in Members
+    TArray<FString> WatchedKeys;
+    TArray<TArray<ANSICHAR>> WatchedKeysUtf8; // Same order, converted once for Steam
+    int32 NumReady = 0;
+
+    void ReadMember(ISteamBackend& Steam, CSteamID MemberID, FSteamLobbyMember& OutMember) const;
+};
+///////////////////////////////////////////
+// MORE COMING SOON  // A.S. - hajddeen //
+/////////////////////////////////////////
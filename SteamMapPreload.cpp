@@ -0,0 +1,250 @@
+// |------------------------------------|
+// |  !FOLLOW URBAN SHADOWS ON SOCIALS! |
+// |------------------------------------|
+//            \ (^ᴗ^) /
+//             \     /
+//              -----
+//              |   |
+//              |   |
+//              |_  |_
+////////////////////////////////////////////////////////////
+// STEAM P2P SESSIONS - Unreal 5.5 + Steamworks SDK 1.57 //
+//////////////////////////////////////////////////////////////////
+// LICENSE AGREEMENT // LICENSE AGREEMENT // LICENSE AGREEMENT //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                                                                                                                                                                                                                                          //
+// Last Updated: 03/12/2024                                                                                                                                                                                                                                //
+//                                                                                                                                                                                                                                                        //
+// 1. Grant of License                                                                                                                                                                                                                                   //
+// This license permits anyone to use, modify, and distribute the provided code (the "Code") in projects free of charge under the following conditions:                                                                                                 //
+// 1.1. The Code must only be used for lawful purposes.                                                                                                                                                                                                //
+// 1.2. The user must include proper credit in their project as described in Section 3 below.                                                                                                                                                         //
+//                                                                                                                                                                                                                                                   //
+// 2. Restrictions                                                                                                                                                                                                                                  //
+// 2.1. This Code cannot be sold, sublicensed, or redistributed as a standalone product or as part of a similar development toolkit.                                                                                                               //
+// 2.2. The Code must not be used for projects that violate local laws or promote harmful, discriminatory, or illegal activities.                                                                                                                 //
+// 2.3. The user must not remove, alter, or obscure this license agreement, attribution requirements, or copyright notices within the Code.                                                                                                      //
+//                                                                                                                                                                                                                                              //
+// 3. Attribution                                                                                                                                                                                                                              //
+// 3.1. The user must include the following credit in a visible location within their project (e.g., splash screen, credits screen, or documentation):                                                                                        //
+// "Steam Multiplayer Code developed by Adrian Szajewski. Used under license."                                                                                                                                                               //
+// 3.2. For distributed or published projects, a link to https://adrianszajewskidev.wordpress.com/ or other contact details must also be included if applicable.                                                                            //
+//                                                                                                                                                                                                                                         //
+// 4. Breach of Agreement                                                                                                                                                                                                                 //
+// 4.1. If this license is violated, the licensor reserves the right to revoke the user's rights to use the Code immediately.                                                                                                            //
+// 4.2. The licensor may take legal action to recover damages or enforce compliance, depending on the severity of the violation.                                                                                                        //
+// 4.3. Users found in breach of this license may be required to:                                                                                                                                                                      //
+// Remove the Code from their project(s).                                                                                                                                                                                             //
+// Cease distribution of any projects using the Code.                                                                                                                                                                                //
+//                                                                                                                                                                                                                                  //
+// 5. Disclaimer                                                                                                                                                                                                                   //
+// 5.1. The Code is provided "as is" without any warranty, express or implied. The licensor is not liable for any damages arising from the use or misuse of the Code.                                                             //
+// 5.2. It is the user's responsibility to ensure compatibility and safe usage of the Code in their projects.                                                                                                                    //
+//                                                                                                                                                                                                                              //
+// 6. Governing Law                                                                                                                                                                                                            //
+// This agreement shall be governed and construed in accordance with the laws of Poland. Any disputes arising under or in connection with this license will be subject to the exclusive jurisdiction of the courts of Poland. //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////
+// INCLUDE //
+////////////
+#include "SteamMapPreload.h"
+#include "SteamMultiplayerStats.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "AssetRegistry/AssetData.h"
+#include "Misc/PackageName.h"
+#include "Engine/World.h"
+/////////////////////////
+// 1. Package Cache   //
+////////////////////////////////////////
+// 1.1 - Build from the registry     //
+// 1.2 - Does the map exist         //
+// 1.3 - Cache state               //
+////////////////////////////////////
+// - 1.1 - //
+void FSteamMapPackageCache::Build()
+{
+    // In-memory query, cooked builds load the whole registry at startup
+    IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+    TArray<FAssetData> Worlds;
+    AssetRegistry.GetAssetsByClass(UWorld::StaticClass()->GetClassPathName(), Worlds);
+
+    TSet<FName> Maps;
+    Maps.Reserve(Worlds.Num());
+    for (const FAssetData& World : Worlds)
+    {
+        Maps.Add(World.PackageName);
+    }
+
+    FWriteScopeLock WriteLock(Lock);
+    KnownMaps = MoveTemp(Maps);
+    ProbedMaps.Reset();
+    bComplete = !AssetRegistry.IsLoadingAssets();
+}
+// - 1.2 - //
+bool FSteamMapPackageCache::DoesMapExist(const FString& MapName)
+{
+    if (!FPackageName::IsValidLongPackageName(MapName))
+    {
+        return false;
+    }
+
+    const FName MapPackage(*MapName);
+    {
+        FReadScopeLock ReadLock(Lock);
+        if (KnownMaps.Contains(MapPackage))
+        {
+            return true;
+        }
+        else if (bComplete)
+        {
+            return false;
+        }
+        else if (const bool* bProbed = ProbedMaps.Find(MapPackage))
+        {
+            return *bProbed;
+        }
+    }
+
+    // Registry still scanning (editor), ask the filesystem once per map
+    const bool bExists = FPackageName::DoesPackageExist(MapName);
+    FWriteScopeLock WriteLock(Lock);
+    ProbedMaps.Add(MapPackage, bExists);
+    return bExists;
+}
+// - 1.3 - //
+bool FSteamMapPackageCache::IsComplete() const
+{
+    FReadScopeLock ReadLock(Lock);
+    return bComplete;
+}
+
+int32 FSteamMapPackageCache::GetNumMaps() const
+{
+    FReadScopeLock ReadLock(Lock);
+    return KnownMaps.Num();
+}
+/////////////////////////
+// 2. Lifecycle       //
+///////////////////////////////////////
+// 2.1 - Build the package cache    //
+// 2.2 - Drop the preload          //
+//////////////////////////////////////
+// - 2.1 - //
+void USteamMapPreloadSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    PackageCache = MakeShared<FSteamMapPackageCache, ESPMode::ThreadSafe>();
+    PackageCache->Build();
+    if (!PackageCache->IsComplete())
+    {
+        FilesLoadedHandle = IAssetRegistry::GetChecked().OnFilesLoaded().AddWeakLambda(this, [this]()
+        {
+            PackageCache->Build();
+            UE_LOG(LogSteamMultiplayer, Log, TEXT("Map package cache rebuilt: %d maps."), PackageCache->GetNumMaps());
+        });
+    }
+
+    PostLoadMapHandle = FCoreUObjectDelegates::PostLoadMapWithWorld.AddUObject(this, &USteamMapPreloadSubsystem::OnPostLoadMap);
+    UE_LOG(LogSteamMultiplayer, Log, TEXT("Map package cache: %d maps%s."), PackageCache->GetNumMaps(), PackageCache->IsComplete() ? TEXT("") : TEXT(" (asset registry still scanning)"));
+}
+// - 2.2 - //
+void USteamMapPreloadSubsystem::Deinitialize()
+{
+    if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+    {
+        AssetRegistry->OnFilesLoaded().Remove(FilesLoadedHandle);
+    }
+    FCoreUObjectDelegates::PostLoadMapWithWorld.Remove(PostLoadMapHandle);
+
+    ReleasePreloadedMap();
+    Super::Deinitialize();
+}
+/////////////////////////
+// 3. Preload         //
+///////////////////////////////////////////////
+// 3.1 - Start streaming a map              //
+// 3.2 - Let go of the preloaded map       //
+// 3.3 - Get preload state                //
+// 3.4 - Does the map exist              //
+// 3.5 - Async load finished            //
+// 3.6 - Travel landed                 //
+////////////////////////////////////////
+// - 3.1 - //
+void USteamMapPreloadSubsystem::PreloadMap(const FString& MapName)
+{
+    const FName MapPackage(*MapName);
+    if (MapPackage == PreloadingMap && (PreloadState == ESteamMapPreloadState::Loading || PreloadState == ESteamMapPreloadState::Loaded))
+    {
+        return;
+    }
+
+    ReleasePreloadedMap();
+    PreloadingMap = MapPackage;
+
+    if (!DoesMapExist(MapName))
+    {
+        PreloadState = ESteamMapPreloadState::Missing;
+        UE_LOG(LogSteamMultiplayer, Warning, TEXT("Map %s is not packaged, nothing to preload."), *MapName);
+        return;
+    }
+    else
+    {
+        PreloadState = ESteamMapPreloadState::Loading;
+        PreloadStartTime = FPlatformTime::Seconds();
+        LoadPackageAsync(MapName, FLoadPackageAsyncDelegate::CreateUObject(this, &USteamMapPreloadSubsystem::OnMapPreloaded));
+    }
+}
+// - 3.2 - //
+void USteamMapPreloadSubsystem::ReleasePreloadedMap()
+{
+    // An unfinished load still completes, OnMapPreloaded ignores it and GC takes it
+    PreloadedWorld = nullptr;
+    PreloadingMap = NAME_None;
+    PreloadState = ESteamMapPreloadState::None;
+}
+// - 3.3 - //
+ESteamMapPreloadState USteamMapPreloadSubsystem::GetPreloadState(const FString& MapName) const
+{
+    return FName(*MapName) == PreloadingMap ? PreloadState : ESteamMapPreloadState::None;
+}
+// - 3.4 - //
+bool USteamMapPreloadSubsystem::DoesMapExist(const FString& MapName) const
+{
+    return PackageCache.IsValid() ? PackageCache->DoesMapExist(MapName) : FPackageName::DoesPackageExist(MapName);
+}
+// - 3.5 - //
+void USteamMapPreloadSubsystem::OnMapPreloaded(const FName& PackageName, UPackage* Package, EAsyncLoadingResult::Type Result)
+{
+    if (PackageName != PreloadingMap)
+    {
+        // Superseded by a newer preload
+        return;
+    }
+    else if (Result != EAsyncLoadingResult::Succeeded || !Package)
+    {
+        PreloadState = ESteamMapPreloadState::Failed;
+        UE_LOG(LogSteamMultiplayer, Warning, TEXT("Preloading %s failed."), *PackageName.ToString());
+        return;
+    }
+    else
+    {
+        PreloadedWorld = UWorld::FindWorldInPackage(Package);
+        PreloadState = PreloadedWorld ? ESteamMapPreloadState::Loaded : ESteamMapPreloadState::Failed;
+        UE_LOG(LogSteamMultiplayer, Log, TEXT("Preloaded %s in %.1f ms."), *PackageName.ToString(), (FPlatformTime::Seconds() - PreloadStartTime) * 1000.0);
+    }
+}
+// - 3.6 - //
+void USteamMapPreloadSubsystem::OnPostLoadMap(UWorld* LoadedWorld)
+{
+    if (PreloadedWorld && LoadedWorld == PreloadedWorld)
+    {
+        UE_LOG(LogSteamMultiplayer, Log, TEXT("Travel picked up the preloaded map %s."), *PreloadingMap.ToString());
+    }
+
+    // The engine owns the new world now, and a preload for any other map is stale
+    ReleasePreloadedMap();
+}
+///////////////////////////////////////////
+// MORE COMING SOON  // A.S. - hajddeen //
+/////////////////////////////////////////
@@ -0,0 +1,150 @@
+// |------------------------------------|
+// |  !FOLLOW URBAN SHADOWS ON SOCIALS! |
+// |------------------------------------|
+//            \ (^ᴗ^) /
+//             \     /
+//              -----
+//              |   |
+//              |   |
+//              |_  |_ 
+////////////////////////////////////////////////////////////
+// STEAM P2P SESSIONS - Unreal 5.5 + Steamworks SDK 1.57 //
+//////////////////////////////////////////////////////////////////
+// LICENSE AGREEMENT // LICENSE AGREEMENT // LICENSE AGREEMENT //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                                                                                                                                                                                                                                          //
+// Last Updated: 03/12/2024                                                                                                                                                                                                                                //
+//                                                                                                                                                                                                                                                        //
+// 1. Grant of License                                                                                                                                                                                                                                   //
+// This license permits anyone to use, modify, and distribute the provided code (the "Code") in projects free of charge under the following conditions:                                                                                                 //
+// 1.1. The Code must only be used for lawful purposes.                                                                                                                                                                                                //
+// 1.2. The user must include proper credit in their project as described in Section 3 below.                                                                                                                                                         //
+//                                                                                                                                                                                                                                                   //
+// 2. Restrictions                                                                                                                                                                                                                                  //
+// 2.1. This Code cannot be sold, sublicensed, or redistributed as a standalone product or as part of a similar development toolkit.                                                                                                               //
+// 2.2. The Code must not be used for projects that violate local laws or promote harmful, discriminatory, or illegal activities.                                                                                                                 //
+// 2.3. The user must not remove, alter, or obscure this license agreement, attribution requirements, or copyright notices within the Code.                                                                                                      //
+//                                                                                                                                                                                                                                              //
+// 3. Attribution                                                                                                                                                                                                                              //
+// 3.1. The user must include the following credit in a visible location within their project (e.g., splash screen, credits screen, or documentation):                                                                                        //
+// "Steam Multiplayer Code developed by Adrian Szajewski. Used under license."                                                                                                                                                               //
+// 3.2. For distributed or published projects, a link to https://adrianszajewskidev.wordpress.com/ or other contact details must also be included if applicable.                                                                            //
+//                                                                                                                                                                                                                                         //
+// 4. Breach of Agreement                                                                                                                                                                                                                 //
+// 4.1. If this license is violated, the licensor reserves the right to revoke the user's rights to use the Code immediately.                                                                                                            //
+// 4.2. The licensor may take legal action to recover damages or enforce compliance, depending on the severity of the violation.                                                                                                        //
+// 4.3. Users found in breach of this license may be required to:                                                                                                                                                                      //
+// Remove the Code from their project(s).                                                                                                                                                                                             //
+// Cease distribution of any projects using the Code.                                                                                                                                                                                //
+//                                                                                                                                                                                                                                  //
+// 5. Disclaimer                                                                                                                                                                                                                   //
+// 5.1. The Code is provided "as is" without any warranty, express or implied. The licensor is not liable for any damages arising from the use or misuse of the Code.                                                             //
+// 5.2. It is the user's responsibility to ensure compatibility and safe usage of the Code in their projects.                                                                                                                    //
+//                                                                                                                                                                                                                              //
+// 6. Governing Law                                                                                                                                                                                                            //
+// This agreement shall be governed and construed in accordance with the laws of Poland. Any disputes arising under or in connection with this license will be subject to the exclusive jurisdiction of the courts of Poland. //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+/////////////////////////////////////////////////////////
+// INCLUDE //
+////////////
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Misc/ScopeRWLock.h"
+#include "UObject/UObjectGlobals.h"
+#include "SteamMapPreload.generated.h"
+
+/////////////////////////////////////////////////////////////////////////////////////
+// STEAM MAP PRELOAD - NOTES                                                       //
+/////////////////////////////////////////////////////////////////////////////////////
+// 1. Known map packages come from the asset registry once at startup, so "does   //
+//    this map exist" is a set lookup instead of a filesystem probe.             //
+// 2. Picking a lobby streams its map in with LoadPackageAsync. Travel then     //
+//    finds the package already in memory and skips the blocking load.         //
+// 3. The preloaded world is held until the next map finishes loading.        //
+///////////////////////////////////////////////////////////////////////////////
+
+UENUM(BlueprintType)
+enum class ESteamMapPreloadState : uint8
+{
+    None,
+    Loading,
+    Loaded,
+    Missing, // Not in the package cache
+    Failed
+};
+////////////////////////////////////////////////
+// MAP PACKAGE NAMES - SAFE FROM ANY THREAD   //
+////////////////////////////////////////////////
+// Read by the callback pump while preparing LobbyEnter_t
+class URBANSHADOWS_API FSteamMapPackageCache
+{
+public:
+    // Game thread, again once the registry finishes scanning (editor)
+    void Build();
+
+    bool DoesMapExist(const FString& MapName);
+    bool IsComplete() const;
+    int32 GetNumMaps() const;
+
+private:
+    mutable FRWLock Lock;
+    TSet<FName> KnownMaps;
+    TMap<FName, bool> ProbedMaps; // Filesystem answers while the registry is incomplete
+    bool bComplete = false;
+};
+////////////////
+// MAIN BODY //
+////////////////
+UCLASS()
+class URBANSHADOWS_API USteamMapPreloadSubsystem : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    //////////////////////////////////////////////
+    // 1. Subsystem Lifecycle                  //
+    ////////////////////////////////////////////
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    //////////////////////////////////////////////
+    // 2. Preload                              //
+    ////////////////////////////////////////////
+    // Starts streaming the map in, a newer map replaces the one held so far
+    UFUNCTION(BlueprintCallable, Category = "Steam|Map Preload")
+    void PreloadMap(const FString& MapName);
+
+    UFUNCTION(BlueprintCallable, Category = "Steam|Map Preload")
+    void ReleasePreloadedMap();
+
+    UFUNCTION(BlueprintPure, Category = "Steam|Map Preload")
+    ESteamMapPreloadState GetPreloadState(const FString& MapName) const;
+
+    UFUNCTION(BlueprintPure, Category = "Steam|Map Preload")
+    bool DoesMapExist(const FString& MapName) const;
+
+    TSharedPtr<FSteamMapPackageCache, ESPMode::ThreadSafe> GetPackageCache() const { return PackageCache; }
+
+private:
+    //////////////////////////////////////////////
+    // 1. Private Data Members                 //
+    ////////////////////////////////////////////
+    TSharedPtr<FSteamMapPackageCache, ESPMode::ThreadSafe> PackageCache;
+
+    UPROPERTY()
+    TObjectPtr<UWorld> PreloadedWorld; // Keeps the streamed-in map alive until travel picks it up
+
+    FName PreloadingMap;
+    ESteamMapPreloadState PreloadState = ESteamMapPreloadState::None;
+    double PreloadStartTime = 0.0;
+
+    FDelegateHandle FilesLoadedHandle;
+    FDelegateHandle PostLoadMapHandle;
+
+    void OnMapPreloaded(const FName& PackageName, UPackage* Package, EAsyncLoadingResult::Type Result);
+    void OnPostLoadMap(UWorld* LoadedWorld);
+};
+///////////////////////////////////////////
+// MORE COMING SOON  // A.S. - hajddeen //
+/////////////////////////////////////////
@@ -55,14 +55,35 @@
 // INCLUDE //
 ////////////
 #include "SteamMultiplayer.h"
+#include "SteamAvatarAtlas.h"
+#include "SteamMapPreload.h"
+#include "SteamQuickMatch.h"
+#include "SteamVoice.h"
+#include "SteamLobbyChat.h"
+#include "SteamInit.h"
+#include "SteamStats.h"
+#include "Misc/CommandLine.h"
+#include "Async/Async.h"
+#include "Tasks/Task.h"
+#include "TextureResource.h"
+#include "RenderingThread.h"
+#include "Engine/Engine.h"
+#include "GameFramework/PlayerController.h"
+#include "UObject/UObjectGlobals.h"
+#include "Algo/IsSorted.h"
+#include "Algo/StableSort.h"
 //////////////////////////
 // Constructor - Notes //
 ////////////////////////////////////////////////////////////////////////////////////////
 // 1. No need to initialize Steam callbacks explicitly, STEAM_CALLBACK handles this. //
 //////////////////////////////////////////////////////////////////////////////////////
 USteamMultiplayer::USteamMultiplayer()
-    : bIsHost(false), LobbyIDString("")
+    : bInitializeSteamOnStartup(true), bUseFakeSteamBackend(false), bManualSteamDispatch(false), SteamCallbackBudgetMs(1.f), bUseSteamSockets(true), AvatarCacheBudgetKB(8192), bUseAvatarAtlas(false), bEnableLobbyVoice(true), bEnableLobbyChat(true), bPublishLobbyPresence(true), StatsFlushIntervalSeconds(30.f), bEnableHostMigration(true), SessionSnapshotIntervalSeconds(2.f), HostMigrationTimeoutSeconds(10.f), bIsHost(false), AvatarCacheClock(0), AvatarPipelineSampleCursor(0)
+    , LobbyListGeneration(0), NextSearchHandle(1), ActiveSearchHandle(0), ActiveSearchPageSize(16), ActiveSearchCall(k_uAPICallInvalid), ActiveSearchMaxPingMs(0), bActiveSearchSortByPing(true), PendingLobbyCursor(0)
+    , bSessionSnapshotDirty(false), SessionHostSteamID(0), MigrationSuccessor(0), MigrationTimeLeft(0.f), MigrationStartTime(0.0), bMigrationTravelled(false), bMigrationMapLoaded(false)
 {
+    PingLocations = MakeShared<FSteamPingLocationCache, ESPMode::ThreadSafe>();
+    LobbyMemberDataKeys = { TEXT("Ready"), TEXT("Team"), TEXT("Loadout") };
 }
 /////////////////////////
 // 1. Basic Functions //
@@ -70,111 +91,295 @@ USteamMultiplayer::USteamMultiplayer()
 // 1.1 - Initialize SteamAPI                //
 // 1.2 - Shutdown SteamAPI                 //
 // 1.3 - Check if SteamAPI is initialized //
-///////////////////////////////////////////
+// 1.4 - Game instance shutdown          //
+// 1.5 - Get (or create) the Steam backend //
+// 1.6 - Route fake backend callbacks     //
+// 1.7 - Use Steam sockets for gameplay  //
+// 1.8 - Snapshot call results on arrival //
+// 1.9 - Get (or create) the async calls //
+//////////////////////////////////////////
 // - 1.1 - //
 void USteamMultiplayer::InitializeSteam()
 {
-    if (SteamAPI_IsSteamRunning())
+    STEAM_MP_SCOPE(STAT_SteamInitialize);
+
+    ISteamBackend* Steam = GetSteamBackend();
+    if (Steam->IsRunning())
     {
-        UE_LOG(LogTemp, Warning, TEXT("Steam is already initialized."));
+        UE_LOG(LogSteamMultiplayer, Verbose, TEXT("Steam is already initialized."));
         return;
     }
     else
     {
-        if (SteamAPI_Init())
+        // Routed backends need their handlers and prepare steps before Init starts delivering
+        if (Steam->UsesCallbackRouter())
+        {
+            BindRoutedCallbacks();
+        }
+        BindCallResultPreparers();
+
+        if (Steam->Init())
         {
-            UE_LOG(LogTemp, Log, TEXT("Steam API initialized successfully."));
+            // Persona, avatar and friends are read by USteamInitSubsystem's prewarm, not on this frame
+            UE_LOG(LogSteamMultiplayer, Log, TEXT("Steam API initialized successfully."));
 
-            FString SteamUsername = UTF8_TO_TCHAR(SteamFriends()->GetPersonaName());
-            uint64 SteamID = SteamUser()->GetSteamID().ConvertToUint64();
-            UE_LOG(LogTemp, Log, TEXT("Logged into Steam as: %s (SteamID: %llu)"), *SteamUsername, SteamID);
+            if (Steam->UsesCallbackRouter())
+            {
+                // Routed callbacks reach the game thread from the core ticker
+                BackendTicker = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateWeakLambda(this, [this](float DeltaTime)
+                {
+                    SteamBackend->Tick(DeltaTime);
+                    return true;
+                }));
+            }
 
-            if (SteamMatchmaking())
+            if (Steam->IsFake())
             {
-                UE_LOG(LogTemp, Log, TEXT("Steam Matchmaking is available."));
+                UE_LOG(LogSteamMultiplayer, Log, TEXT("Using fake Steam backend (seed %d, %d lobbies)."), FakeSteamConfig.Seed, FakeSteamConfig.NumLobbies);
+            }
+            else if (SteamMatchmaking())
+            {
+                UE_LOG(LogSteamMultiplayer, Log, TEXT("Steam Matchmaking is available."));
             }
             else
             {
-                UE_LOG(LogTemp, Warning, TEXT("Steam Matchmaking is unavailable."));
+                UE_LOG(LogSteamMultiplayer, Warning, TEXT("Steam Matchmaking is unavailable."));
+            }
+
+            if (!Steam->IsFake() && bUseSteamSockets)
+            {
+                RegisterSteamSocketsNetDriver();
+            }
+
+            // Ping location measurements take a few seconds, start them before the first search or lobby
+            Steam->InitRelayNetworkAccess();
+
+            if (USteamStatsSubsystem* Stats = GetSubsystem<USteamStatsSubsystem>())
+            {
+                Stats->StartStats();
             }
         }
         else
         {
-            UE_LOG(LogTemp, Error, TEXT("Failed to initialize Steam API!"));
+            UE_LOG(LogSteamMultiplayer, Error, TEXT("Failed to initialize Steam API!"));
         }
     }
 }
 // - 1.2 - //
 void USteamMultiplayer::ShutdownSteam()
 {
-    SteamAPI_Shutdown();
-    UE_LOG(LogTemp, Log, TEXT("Steam API shut down."));
+    // Last stats flush goes out while Steam can still take it
+    if (USteamStatsSubsystem* Stats = GetSubsystem<USteamStatsSubsystem>())
+    {
+        Stats->StopStats();
+    }
+
+    // Outstanding requests resolve as Cancelled while the backend is still up
+    StopLobbySearchPaging();
+    CancelQuickMatch();
+    ResetHostMigration();
+    if (AsyncCalls.IsValid())
+    {
+        AsyncCalls->CancelAll();
+    }
+    RebuildLobbyRoster(FSteamLobbyId());
+    if (USteamInitSubsystem* Init = GetSubsystem<USteamInitSubsystem>())
+    {
+        Init->CancelPrewarm();
+    }
+
+    if (PingPublishTicker.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(PingPublishTicker);
+        PingPublishTicker.Reset();
+    }
+    if (BackendTicker.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(BackendTicker);
+        BackendTicker.Reset();
+    }
+    GetSteamBackend()->Shutdown();
+    UE_LOG(LogSteamMultiplayer, Log, TEXT("Steam API shut down."));
 }
 // - 1.3 - //
 bool USteamMultiplayer::IsSteamInitialized() const
 {
-    return SteamAPI_IsSteamRunning();
+    return GetSteamBackend()->IsRunning();
+}
+// - 1.4 - //
+void USteamMultiplayer::Shutdown()
+{
+    StopLobbySearchPaging();
+    CancelQuickMatch();
+    QuickMatch.Reset();
+    ResetHostMigration();
+    AsyncCalls.Reset();
+    LobbyRoster.Reset();
+    FriendsCache.Reset();
+    if (PingPublishTicker.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(PingPublishTicker);
+        PingPublishTicker.Reset();
+    }
+    if (BackendTicker.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(BackendTicker);
+        BackendTicker.Reset();
+    }
+    Super::Shutdown();
+}
+// - 1.5 - //
+ISteamBackend* USteamMultiplayer::GetSteamBackend() const
+{
+    if (!SteamBackend.IsValid())
+    {
+        // -FakeSteam on the command line runs without a Steam client (CI, profiling)
+        if (bUseFakeSteamBackend || FParse::Param(FCommandLine::Get(), TEXT("FakeSteam")))
+        {
+            SteamBackend = MakeShared<FFakeSteamBackend, ESPMode::ThreadSafe>(FakeSteamConfig);
+        }
+        else
+        {
+            // -SteamManualDispatch drains Steam on a background thread instead of SteamAPI_RunCallbacks
+            const bool bManualDispatch = bManualSteamDispatch || FParse::Param(FCommandLine::Get(), TEXT("SteamManualDispatch"));
+            SteamBackend = MakeShared<FSteamworksBackend, ESPMode::ThreadSafe>(bManualDispatch, SteamCallbackBudgetMs);
+        }
+    }
+    return SteamBackend.Get();
+}
+// - 1.6 - //
+void USteamMultiplayer::BindRoutedCallbacks()
+{
+    // Same handlers STEAM_CALLBACK wires up for the real client
+    FSteamCallbackRouter& Router = SteamBackend->GetCallbackRouter();
+    for (const FSteamCallbackRouter::FHandle Handle : RoutedHandles)
+    {
+        Router.Unbind(Handle);
+    }
+    RoutedHandles.Reset();
+
+    // Lobby reads and the map lookup run on the pump thread, only the travel is left for the game thread
+    ISteamBackend* Backend = SteamBackend.Get();
+    USteamMapPreloadSubsystem* MapPreload = GetMapPreload();
+    TSharedPtr<FSteamMapPackageCache, ESPMode::ThreadSafe> MapCache = MapPreload ? MapPreload->GetPackageCache() : nullptr;
+    RoutedHandles.Add(Router.BindPrepared<LobbyEnter_t, FSteamLobbyEnterInfo>(
+        [Backend, MapCache](const LobbyEnter_t& Callback, FSteamLobbyEnterInfo& OutInfo) { PrepareLobbyEntered(*Backend, MapCache.Get(), Callback, OutInfo); },
+        [this](LobbyEnter_t* pCallback, const FSteamLobbyEnterInfo& Info) { HandleLobbyEntered(pCallback, Info); }));
+    RoutedHandles.Add(Router.Bind<LobbyDataUpdate_t>([this](LobbyDataUpdate_t* pCallback) { OnLobbyDataUpdated(pCallback); }));
+    RoutedHandles.Add(Router.Bind<LobbyChatUpdate_t>([this](LobbyChatUpdate_t* pCallback) { OnLobbyChatUpdated(pCallback); }));
+    RoutedHandles.Add(Router.Bind<AvatarImageLoaded_t>([this](AvatarImageLoaded_t* pCallback) { OnAvatarImageLoaded(pCallback); }));
+    RoutedHandles.Add(Router.Bind<PersonaStateChange_t>([this](PersonaStateChange_t* pCallback) { OnPersonaStateChanged(pCallback); }));
+    RoutedHandles.Add(Router.Bind<FriendRichPresenceUpdate_t>([this](FriendRichPresenceUpdate_t* pCallback) { OnFriendRichPresenceUpdated(pCallback); }));
+}
+// - 1.7 - //
+void USteamMultiplayer::RegisterSteamSocketsNetDriver()
+{
+    if (!GEngine)
+    {
+        return;
+    }
+
+    // Swap the game driver, whatever was configured before stays as the fallback
+    const FName SteamSocketsDriver(*USteamSocketsNetDriver::StaticClass()->GetPathName());
+    for (FNetDriverDefinition& Definition : GEngine->NetDriverDefinitions)
+    {
+        if (Definition.DefName == NAME_GameNetDriver && Definition.DriverClassName != SteamSocketsDriver)
+        {
+            Definition.DriverClassNameFallback = Definition.DriverClassName;
+            Definition.DriverClassName = SteamSocketsDriver;
+            UE_LOG(LogSteamMultiplayer, Log, TEXT("GameNetDriver now uses Steam sockets (fallback %s)."), *Definition.DriverClassNameFallback.ToString());
+        }
+    }
+}
+// - 1.8 - //
+void USteamMultiplayer::BindCallResultPreparers()
+{
+    // Runs on the pump thread or inline when the result lands, before a newer list can replace it
+    ISteamBackend* Backend = SteamBackend.Get();
+    TSharedPtr<FSteamPingLocationCache, ESPMode::ThreadSafe> Pings = PingLocations;
+    Backend->GetCallbackRouter().SetPreparer<LobbyMatchList_t, FSteamLobbyListSnapshot>([Backend, Pings](const LobbyMatchList_t& Callback, FSteamLobbyListSnapshot& OutSnapshot)
+    {
+        PrepareLobbyList(*Backend, *Pings, Callback, OutSnapshot);
+    });
+
+    // Downloaded leaderboard entries are only readable until their callback returns
+    Backend->GetCallbackRouter().SetPreparer<LeaderboardScoresDownloaded_t, FSteamLeaderboardDownload>([Backend](const LeaderboardScoresDownloaded_t& Callback, FSteamLeaderboardDownload& OutDownload)
+    {
+        USteamStatsSubsystem::PrepareLeaderboardDownload(*Backend, Callback, OutDownload);
+    });
+}
+// - 1.9 - //
+FSteamAsyncCalls& USteamMultiplayer::GetAsyncCalls()
+{
+    if (!AsyncCalls.IsValid())
+    {
+        AsyncCalls = MakeUnique<FSteamAsyncCalls>(*GetSteamBackend());
+    }
+    return *AsyncCalls;
 }
 //////////////////////
 // 2. Hosting Game //
 /////////////////////////////////////////////////
 // 2.1 - Host a game using Steam Matchmaking  //
-// 2.2 - Callback: Lobby created             //
-// 2.3 - // Callback: Lobby entered         //
-/////////////////////////////////////////////
+// 2.2 - Call result: Lobby created          //
+// 2.3 - Callback: Lobby entered            //
+// 2.4 - Lobby entered, thread-safe part   //
+// 2.5 - Lobby entered, game thread part  //
+// 2.6 - Publish the host ping location  //
+// 2.7 - Publish the host lobby data    //
+// 2.8 - Travel to the lobby host      //
+////////////////////////////////////////////
 // - 2.1 - //
 void USteamMultiplayer::HostGameWithSteamMatchmaking()
 {
-    if (!SteamAPI_IsSteamRunning())
+    if (!IsSteamInitialized())
     {
-        UE_LOG(LogTemp, Error, TEXT("Steam API is not initialized."));
+        UE_LOG(LogSteamMultiplayer, Error, TEXT("Steam API is not initialized."));
         return;
     }
     else
     {
-        ISteamMatchmaking* SteamMatchmakingTemp = SteamMatchmaking();
-        if (!SteamMatchmakingTemp)
+        const int32 MaxPlayers = 4;
+        UE_LOG(LogSteamMultiplayer, Log, TEXT("Lobby creation requested with max players %d"), MaxPlayers);
+
+        // The map streams in while Steam creates the lobby, ServerTravel then finds it loaded
+        if (USteamMapPreloadSubsystem* MapPreload = GetMapPreload())
         {
-            UE_LOG(LogTemp, Error, TEXT("Steam Matchmaking interface is not available!"));
-            return;
+            MapPreload->PreloadMap(HostLobbyMetadata.MapName);
         }
-        else
-        {
-            int32 MaxPlayers = 4;
-            int32 LobbyVisibility = k_ELobbyTypePublic;
 
-            SteamAPICall_t CreateLobbyCall = SteamMatchmakingTemp->CreateLobby((ELobbyType)LobbyVisibility, MaxPlayers);
-            UE_LOG(LogTemp, Log, TEXT("Lobby creation requested with max players %d"), MaxPlayers);
-
-            FString LobbyMap = "/Game/Maps/Map_Lobby";
-            SteamMatchmakingTemp->SetLobbyData(CreateLobbyCall, "MapName", TCHAR_TO_UTF8(*LobbyMap));
-        }
+        // Lobby data (map included) goes out in OnLobbyCreated, once there is a lobby ID to set it on
+        // The game instance may be gone by the time the lobby lands (timeout, shutdown)
+        TWeakObjectPtr<USteamMultiplayer> WeakThis(this);
+        CreateLobbyAsync(k_ELobbyTypePublic, MaxPlayers).Next([WeakThis](TSteamAsyncResult<FSteamLobbyId> Result)
+        {
+            if (USteamMultiplayer* This = WeakThis.Get())
+            {
+                This->OnLobbyCreated(Result);
+            }
+        });
     }
 }
 // - 2.2 - //
-void USteamMultiplayer::OnLobbyCreated(LobbyCreated_t* pCallback)
+void USteamMultiplayer::OnLobbyCreated(const TSteamAsyncResult<FSteamLobbyId>& Result)
 {
-    if (pCallback->m_eResult != k_EResultOK)
+    STEAM_MP_SCOPE(STAT_SteamOnLobbyCreated);
+
+    if (!Result.IsSuccess())
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to create lobby: %d"), pCallback->m_eResult);
+        UE_LOG(LogSteamMultiplayer, Error, TEXT("Failed to create lobby: %s (result %d)"), *UEnum::GetValueAsString(Result.Status), Result.SteamResult);
         return;
     }
     else
     {
-        CSteamID LobbyID = CSteamID(pCallback->m_ulSteamIDLobby);
-        LobbyIDString = FString::Printf(TEXT("%llu"), LobbyID.ConvertToUint64());
-        UE_LOG(LogTemp, Log, TEXT("Lobby created successfully: %llu"), LobbyID.ConvertToUint64());
+        CSteamID LobbyID = Result.Value.ToSteamID();
+        CurrentLobbyId = FSteamLobbyId(LobbyID);
+        UE_LOG(LogSteamMultiplayer, Log, TEXT("Lobby created successfully: %llu"), LobbyID.ConvertToUint64());
 
-        // Set up lobby data
-        CSteamID HostSteamID = SteamMatchmaking()->GetLobbyOwner(LobbyID);
-        const char* HostName = SteamFriends()->GetFriendPersonaName(HostSteamID);
-        SteamMatchmaking()->SetLobbyData(LobbyID, "HostName", HostName);
-        SteamMatchmaking()->SetLobbyData(LobbyID, "GameKey", "urbanshadows");
-        SteamMatchmaking()->SetLobbyData(LobbyID, "Region", "Auto");
-        SteamMatchmaking()->SetLobbyData(LobbyID, "MapName", "/Game/Maps/Map_Lobby"); // Set the map in lobby data
+        PublishLobbyMetadata(LobbyID);
 
         // Travel to the map
-        FString LobbyMap = SteamMatchmaking()->GetLobbyData(LobbyID, "MapName");
+        const FString& LobbyMap = HostLobbyMetadata.MapName;
 
         // Check if the map name is valid
         if (!LobbyMap.IsEmpty())
@@ -183,10 +388,10 @@ void USteamMultiplayer::OnLobbyCreated(LobbyCreated_t* pCallback)
             FString TravelCommand = FString::Printf(TEXT("%s?listen"), *LobbyMap);
 
             // Log the travel command
-            UE_LOG(LogTemp, Log, TEXT("Attempting to travel to: %s"), *TravelCommand);
+            UE_LOG(LogSteamMultiplayer, Log, TEXT("Attempting to travel to: %s"), *TravelCommand);
 
-            // Check if the map exists before traveling
-            if (FPackageName::DoesPackageExist(LobbyMap))
+            // Check if the map exists before traveling (package cache, no disk hit)
+            if (DoesMapExist(LobbyMap))
             {
                 // Ensure GetWorld() is valid before calling ServerTravel
                 if (GetWorld())
@@ -195,54 +400,198 @@ void USteamMultiplayer::OnLobbyCreated(LobbyCreated_t* pCallback)
                 }
                 else
                 {
-                    UE_LOG(LogTemp, Error, TEXT("World is not valid, cannot travel."));
+                    UE_LOG(LogSteamMultiplayer, Error, TEXT("World is not valid, cannot travel."));
                 }
             }
             else
             {
-                UE_LOG(LogTemp, Error, TEXT("Map does not exist: %s"), *LobbyMap);
+                UE_LOG(LogSteamMultiplayer, Error, TEXT("Map does not exist: %s"), *LobbyMap);
             }
         }
         else
         {
-            UE_LOG(LogTemp, Warning, TEXT("No map name found in lobby data."));
+            UE_LOG(LogSteamMultiplayer, Warning, TEXT("No map name found in lobby data."));
         }
     }
 }
 // - 2.3 - //
 void USteamMultiplayer::OnLobbyEntered(LobbyEnter_t* pCallback)
 {
-    if (pCallback->m_EChatRoomEnterResponse != k_EChatRoomEnterResponseSuccess)
+    FSteamLobbyEnterInfo Info;
+    USteamMapPreloadSubsystem* MapPreload = GetMapPreload();
+    PrepareLobbyEntered(*GetSteamBackend(), MapPreload ? MapPreload->GetPackageCache().Get() : nullptr, *pCallback, Info);
+    HandleLobbyEntered(pCallback, Info);
+}
+// - 2.4 - //
+void USteamMultiplayer::PrepareLobbyEntered(ISteamBackend& Steam, FSteamMapPackageCache* MapCache, const LobbyEnter_t& Callback, FSteamLobbyEnterInfo& OutInfo)
+{
+    if (Callback.m_EChatRoomEnterResponse != k_EChatRoomEnterResponseSuccess)
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to enter lobby. Response: %d"), pCallback->m_EChatRoomEnterResponse);
         return;
     }
     else
     {
-        UE_LOG(LogTemp, Log, TEXT("Successfully entered lobby: %llu"), pCallback->m_ulSteamIDLobby);
+        const CSteamID LobbyID(Callback.m_ulSteamIDLobby);
+        const CSteamID Owner = Steam.GetLobbyOwner(LobbyID);
+        OutInfo.OwnerSteamID = Owner.ConvertToUint64();
+        OutInfo.bLocalOwner = Owner == Steam.GetLocalSteamID();
+
+        FLobbyMetadataView Metadata;
+        if (FLobbyMetadataView::Parse(Steam.GetLobbyData(LobbyID, FLobbyMetadata::BlobKey), Metadata) && !Metadata.MapName.IsEmpty())
+        {
+            OutInfo.MapName = FString(Metadata.MapName.Len(), Metadata.MapName.GetData());
+        }
+        else
+        {
+            OutInfo.MapName = FLobbyMetadata().MapName;
+        }
+
+        // Set lookup normally, a disk probe only without the package cache
+        OutInfo.bMapExists = !OutInfo.bLocalOwner && (MapCache ? MapCache->DoesMapExist(OutInfo.MapName) : FPackageName::DoesPackageExist(OutInfo.MapName));
+    }
+}
+// - 2.5 - //
+void USteamMultiplayer::HandleLobbyEntered(LobbyEnter_t* pCallback, const FSteamLobbyEnterInfo& Info)
+{
+    STEAM_MP_SCOPE(STAT_SteamOnLobbyEntered);
 
-        // Check if the world is valid before traveling
-        UWorld* CurrentWorld = GetWorld();
-        if (CurrentWorld)
+    if (pCallback->m_EChatRoomEnterResponse != k_EChatRoomEnterResponseSuccess)
+    {
+        UE_LOG(LogSteamMultiplayer, Error, TEXT("Failed to enter lobby. Response: %d"), pCallback->m_EChatRoomEnterResponse);
+        return;
+    }
+    else
+    {
+        // Speculative quick match joins: only the first one to land is kept
+        const FSteamLobbyId EnteredLobby(pCallback->m_ulSteamIDLobby);
+        if (QuickMatch.IsValid() && !QuickMatch->AcceptEnteredLobby(EnteredLobby))
         {
-            // Log the map name before traveling
-            FString MapName = "/Game/Maps/Map_Lobby"; // This should match the actual map you're trying to travel to
-            UE_LOG(LogTemp, Log, TEXT("Attempting to travel to map: %s"), *MapName);
+            UE_LOG(LogSteamMultiplayer, Log, TEXT("Leaving lobby %llu, the quick match went elsewhere."), pCallback->m_ulSteamIDLobby);
+            GetSteamBackend()->LeaveLobby(EnteredLobby.ToSteamID());
+            return;
+        }
+
+        UE_LOG(LogSteamMultiplayer, Log, TEXT("Successfully entered lobby: %llu"), pCallback->m_ulSteamIDLobby);
+        CurrentLobbyId = EnteredLobby;
 
-            // Check if the map exists
-            if (FPackageName::DoesPackageExist(MapName))
+        // The one full member scan, joins / leaves / data changes come in as callbacks from here on
+        RebuildLobbyRoster(EnteredLobby);
+        SessionHostSteamID = Info.OwnerSteamID;
+
+        // Host enters its own lobby right after creating it, OnLobbyCreated already started the listen server
+        if (Info.bLocalOwner)
+        {
+            bIsHost = true;
+            if (bEnableHostMigration)
             {
-                CurrentWorld->ServerTravel(MapName);
-                UE_LOG(LogTemp, Log, TEXT("ServerTravel to %s was successful."), *MapName);
+                StartSessionSnapshots();
             }
-            else
+            return;
+        }
+
+        // No-op when the map was already picked in the browser, otherwise it loads while we connect
+        USteamMapPreloadSubsystem* MapPreload = GetMapPreload();
+        if (MapPreload && Info.bMapExists)
+        {
+            MapPreload->PreloadMap(Info.MapName);
+        }
+
+        TravelToLobbyHost(Info.OwnerSteamID, Info.MapName, Info.bMapExists);
+    }
+}
+// - 2.6 - //
+bool USteamMultiplayer::PublishPingLocation()
+{
+    // True once done or once there is nothing left to publish for
+    TArray<ANSICHAR> Location;
+    if (!IsSteamInitialized() || !CurrentLobbyId.IsValid() || GetSteamBackend()->GetLobbyOwner(CurrentLobbyId.ToSteamID()) != GetSteamBackend()->GetLocalSteamID())
+    {
+        return true;
+    }
+    else if (!PingLocations->Refresh(*GetSteamBackend()) || !PingLocations->GetLocalLocationString(*GetSteamBackend(), Location))
+    {
+        return false;
+    }
+    else
+    {
+        GetSteamBackend()->SetLobbyData(CurrentLobbyId.ToSteamID(), FSteamPingLocationCache::LobbyKey, Location.GetData());
+        UE_LOG(LogSteamMultiplayer, Log, TEXT("Ping location published for lobby %llu."), CurrentLobbyId.ToSteamID().ConvertToUint64());
+        return true;
+    }
+}
+// - 2.7 - //
+void USteamMultiplayer::PublishLobbyMetadata(CSteamID LobbyID)
+{
+    // Set up lobby data, display-only fields go out as one packed key. Also re-run by a migrated host
+    CSteamID HostSteamID = GetSteamBackend()->GetLobbyOwner(LobbyID);
+    const bool bLocalHost = HostSteamID == GetSteamBackend()->GetLocalSteamID() && !LocalPersonaName.IsEmpty();
+    HostLobbyMetadata.HostName = bLocalHost ? LocalPersonaName : FString(UTF8_TO_TCHAR(GetSteamBackend()->GetFriendPersonaName(HostSteamID)));
+
+    TUtf8StringBuilder<512> MetadataBlob;
+    HostLobbyMetadata.Encode(MetadataBlob);
+    GetSteamBackend()->SetLobbyData(LobbyID, FLobbyMetadata::BlobKey, (const char*)MetadataBlob.ToString());
+
+    // Filterable fields stay as their own keys
+    GetSteamBackend()->SetLobbyData(LobbyID, "GameKey", "urbanshadows");
+    GetSteamBackend()->SetLobbyData(LobbyID, "Region", "Auto");
+
+    // Browsers rank us by this, right after startup the relay measurements may still be running
+    if (!PublishPingLocation() && !PingPublishTicker.IsValid())
+    {
+        PingPublishTicker = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateWeakLambda(this, [this](float DeltaTime)
+        {
+            if (!PublishPingLocation())
             {
-                UE_LOG(LogTemp, Error, TEXT("Map %s does not exist or is not packaged."), *MapName);
+                return true;
             }
+            PingPublishTicker.Reset();
+            return false;
+        }), 1.f);
+    }
+}
+// - 2.8 - //
+bool USteamMultiplayer::TravelToLobbyHost(uint64 HostSteamID, const FString& MapName, bool bMapExists)
+{
+    // Clients connect straight to the lobby owner over Steam sockets
+    if (bUseSteamSockets && !GetSteamBackend()->IsFake())
+    {
+        APlayerController* PlayerController = GetFirstLocalPlayerController();
+        if (PlayerController)
+        {
+            const FString HostURL = FString::Printf(TEXT("steam.%llu"), HostSteamID);
+            UE_LOG(LogSteamMultiplayer, Log, TEXT("Connecting to host: %s"), *HostURL);
+            PlayerController->ClientTravel(HostURL, TRAVEL_Absolute);
+            return true;
+        }
+        else
+        {
+            UE_LOG(LogSteamMultiplayer, Error, TEXT("No local player controller, cannot connect to host."));
+            return false;
+        }
+    }
+
+    // Check if the world is valid before traveling
+    UWorld* CurrentWorld = GetWorld();
+    if (!CurrentWorld)
+    {
+        UE_LOG(LogSteamMultiplayer, Error, TEXT("World is not valid, cannot travel."));
+        return false;
+    }
+    else
+    {
+        UE_LOG(LogSteamMultiplayer, Log, TEXT("Attempting to travel to map: %s"), *MapName);
+
+        // Existence was checked when the callback was prepared, the load itself is already under way
+        if (bMapExists)
+        {
+            CurrentWorld->ServerTravel(MapName);
+            UE_LOG(LogSteamMultiplayer, Log, TEXT("ServerTravel to %s was successful."), *MapName);
+            return true;
         }
         else
         {
-            UE_LOG(LogTemp, Error, TEXT("World is not valid, cannot travel."));
+            UE_LOG(LogSteamMultiplayer, Error, TEXT("Map %s does not exist or is not packaged."), *MapName);
+            return false;
         }
     }
 }
@@ -250,188 +599,1890 @@ void USteamMultiplayer::OnLobbyEntered(LobbyEnter_t* pCallback)
 // 3. Finding Games //
 ////////////////////////////////////////////////////////////////////////
 // 3.1 - Find lobbies with specified settings, example: region, tag  //
-// 3.2 - Callback: Found lobbies                                    //
+// 3.2 - Call result: Found lobbies                                 //
 // 3.3 - Join lobby by using LobbyID                               //
-////////////////////////////////////////////////////////////////////
+// 3.4 - Callback: Lobby (or member) data updated                 //
+// 3.5 - Read lobby info from Steam                              //
+// 3.6 - Lobby list, thread-safe part                            //
+// 3.7 - Select a lobby, preload its map                        //
+// 3.8 - Rank a lobby list by ping                             //
+////////////////////////////////////////////////////////////////
 // - 3.1 - //
 void USteamMultiplayer::FindLobbiesWithSettings(FString Tag, FString Region)
 {
-    if (!SteamAPI_IsSteamRunning())
+    FLobbySearchQuery Query;
+    Query.GameKey = Tag;
+    Query.Region = Region;
+    FindLobbies(Query);
+}
+// - 3.2 - //
+void USteamMultiplayer::OnLobbyListReceived(LobbyMatchList_t* pCallback, const FSteamLobbyListSnapshot& Snapshot)
+{
+    STEAM_MP_SCOPE(STAT_SteamOnLobbyListReceived);
+
+    if (ActiveSearchHandle == 0)
     {
-        UE_LOG(LogTemp, Error, TEXT("Steam API is not initialized."));
+        // Search was cancelled or superseded, leave FoundLobbies alone
         return;
     }
-    else
+    else if (Snapshot.LobbyIDs.Num() == 0)
+    {
+        UE_LOG(LogSteamMultiplayer, Log, TEXT("No matching lobbies found."));
+    }
+
+    // The snapshot holds the whole result set (IDs and pings only), rows are materialized page by page afterwards
+    TArray<int32> Order;
+    Snapshot.Rank(ActiveSearchMaxPingMs, bActiveSearchSortByPing, Order);
+
+    const uint32 Generation = ++LobbyListGeneration;
+    PendingLobbyRows.Reset(Order.Num());
+    PendingLobbyPings.Reset(Order.Num());
+    PendingLobbyCursor = 0;
+    for (int32 Index : Order)
     {
-        ISteamMatchmaking* SteamMatchmakingTemp = SteamMatchmaking();
-        if (!SteamMatchmakingTemp)
+        PendingLobbyRows.Add(Snapshot.LobbyIDs[Index]);
+        PendingLobbyPings.Add(Snapshot.GetPing(Index));
+    }
+
+    // Lobbies over the ping limit are not marked, so they leave FoundLobbies like missing ones
+    for (const CSteamID& LobbyID : PendingLobbyRows)
+    {
+        if (FLobbyIndexEntry* Entry = LobbyIndex.Find(FSteamLobbyId(LobbyID)))
         {
-            UE_LOG(LogTemp, Error, TEXT("Steam Matchmaking interface is not available!"));
-            return;
+            Entry->Generation = Generation;
         }
-        else
-        {
-            // Reset the lobby array before searching
-            FoundLobbies.Empty();
+    }
 
-            // Add search filters for the tag and region
-            SteamMatchmakingTemp->AddRequestLobbyListStringFilter("GameKey", TCHAR_TO_UTF8(*Tag), k_ELobbyComparisonEqual);
-            //SteamMatchmakingTemp->AddRequestLobbyListStringFilter("Region", TCHAR_TO_UTF8(*Region), k_ELobbyComparisonEqual);
+    // Drop lobbies missing from this result, walk backwards so row indices stay valid
+    TArray<FLobbyInfoData> Removed;
+    for (int32 Row = FoundLobbies.Num() - 1; Row >= 0; --Row)
+    {
+        if (LobbyIndex.FindChecked(FoundLobbies[Row].LobbyId).Generation != Generation)
+        {
+            LobbyIndex.Remove(FoundLobbies[Row].LobbyId);
+            Removed.Add(MoveTemp(FoundLobbies[Row]));
+            FoundLobbies.RemoveAt(Row, 1, EAllowShrinking::No);
+        }
+    }
 
-            // Request the list of lobbies
-            SteamAPICall_t SearchCall = SteamMatchmakingTemp->RequestLobbyList();
-            UE_LOG(LogTemp, Log, TEXT("Lobby search requested for tag: %s, region: %s"), *Tag, *Region);
+    if (Removed.Num() > 0)
+    {
+        for (int32 Row = 0; Row < FoundLobbies.Num(); ++Row)
+        {
+            LobbyIndex.FindChecked(FoundLobbies[Row].LobbyId).FoundIndex = Row;
         }
     }
+
+    SET_DWORD_STAT(STAT_SteamFoundLobbies, FoundLobbies.Num());
+    for (const FLobbyInfoData& LobbyInfo : Removed)
+    {
+        OnFoundLobbyRemoved.Broadcast(LobbyInfo);
+    }
+
+    // First page right away, the rest on following frames
+    if (TickLobbySearchPages(0.f) && !LobbyPageTicker.IsValid())
+    {
+        LobbyPageTicker = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &USteamMultiplayer::TickLobbySearchPages));
+    }
 }
-// - 3.2 - //
-void USteamMultiplayer::OnLobbyListReceived(LobbyMatchList_t* pCallback)
+// - 3.3 - //
+void USteamMultiplayer::JoinLobby(FSteamLobbyId LobbyID)
 {
-    if (pCallback->m_nLobbiesMatching == 0)
+    if (!IsSteamInitialized())
     {
-        UE_LOG(LogTemp, Log, TEXT("No matching lobbies found."));
+        UE_LOG(LogSteamMultiplayer, Error, TEXT("Steam API is not initialized."));
         return;
     }
     else
     {
-        // Loop through the found lobbies and store their info
-        for (uint32 i = 0; i < pCallback->m_nLobbiesMatching; ++i)
+        CSteamID LobbyIDSteamFormat = LobbyID.ToSteamID();
+        CurrentLobbyId = LobbyID;
+        bIsHost = false;
+        SelectLobby(LobbyID);
+        if (!LobbyRoster.IsFor(LobbyIDSteamFormat))
         {
-            CSteamID LobbyID = SteamMatchmaking()->GetLobbyByIndex(i);
-            FString LobbyIDStringTemp = FString::Printf(TEXT("%llu"), LobbyID.ConvertToUint64());
-            FString HostNameString = UTF8_TO_TCHAR(SteamMatchmaking()->GetLobbyData(LobbyID, "HostName"));
-            int32 CurrentPlayers = SteamMatchmaking()->GetNumLobbyMembers(LobbyID);
-            int32 MaxPlayers = SteamMatchmaking()->GetLobbyMemberLimit(LobbyID);
-            FString Region = UTF8_TO_TCHAR(SteamMatchmaking()->GetLobbyData(LobbyID, "Region"));
-            FString MapName = UTF8_TO_TCHAR(SteamMatchmaking()->GetLobbyData(LobbyID, "MapName"));
-
-            // Create a lobby struct and add it to the array
-            FLobbyInfoData LobbyInfo;
-            LobbyInfo.HostName = HostNameString;
-            LobbyInfo.CurrentPlayers = CurrentPlayers;
-            LobbyInfo.MaxPlayers = MaxPlayers;
-            LobbyInfo.Region = Region;
-            LobbyInfo.MapName = MapName;
-            LobbyInfo.LobbyIDString = LobbyIDStringTemp;
+            RebuildLobbyRoster(FSteamLobbyId());
+        }
 
-            FoundLobbies.Add(LobbyInfo);
+        // A manual join overrides quick match, its LobbyEnter_t must not be turned away
+        CancelQuickMatch();
+        if (QuickMatch.IsValid())
+        {
+            QuickMatch->ReleaseLobby(LobbyID);
         }
+
+        // Travel happens in OnLobbyEntered, the future is only for the latency sample
+        JoinLobbyAsync(LobbyID);
+        UE_LOG(LogSteamMultiplayer, Log, TEXT("Attempting to join lobby: %llu"), LobbyIDSteamFormat.ConvertToUint64());
     }
 }
-// - 3.3 - //
-void USteamMultiplayer::JoinLobby(FString LobbyID)
+// - 3.4 - //
+void USteamMultiplayer::OnLobbyDataUpdated(LobbyDataUpdate_t* pCallback)
 {
-    if (!SteamAPI_IsSteamRunning())
+    STEAM_MP_SCOPE(STAT_SteamOnLobbyDataUpdated);
+
+    // Member data updates carry the member's ID, only the roster of our own lobby wants those
+    if (pCallback->m_ulSteamIDMember != pCallback->m_ulSteamIDLobby)
     {
-        UE_LOG(LogTemp, Error, TEXT("Steam API is not initialized."));
+        TArray<FString> ChangedKeys;
+        const CSteamID MemberID(pCallback->m_ulSteamIDMember);
+        if (LobbyRoster.IsFor(CSteamID(pCallback->m_ulSteamIDLobby)) && LobbyRoster.RefreshMemberData(*GetSteamBackend(), MemberID, ChangedKeys))
+        {
+            // Copied, a handler may rebuild the roster under us
+            const FSteamLobbyMember Member = *LobbyRoster.FindMember(MemberID.ConvertToUint64());
+            OnLobbyMemberDataChanged.Broadcast(Member, ChangedKeys);
+        }
         return;
     }
     else
     {
-        ISteamMatchmaking* SteamMatchmakingTemp = SteamMatchmaking();
-        if (!SteamMatchmakingTemp)
+        // Ownership moving and the new host's snapshot both arrive as lobby data updates
+        if (IsHostMigrating() && LobbyRoster.IsFor(CSteamID(pCallback->m_ulSteamIDLobby)))
         {
-            UE_LOG(LogTemp, Error, TEXT("Steam Matchmaking interface is not available!"));
-            return;
+            UpdateHostMigration();
         }
-        else
+        if (FLobbyIndexEntry* Entry = LobbyIndex.Find(FSteamLobbyId(pCallback->m_ulSteamIDLobby)))
+        {
+            Entry->bDataDirty = true;
+        }
+    }
+}
+// - 3.5 - //
+void USteamMultiplayer::ReadLobbyInfo(CSteamID LobbyID, FLobbyInfoData& OutLobbyInfo) const
+{
+    OutLobbyInfo.LobbyId = FSteamLobbyId(LobbyID);
+    OutLobbyInfo.CurrentPlayers = GetSteamBackend()->GetNumLobbyMembers(LobbyID);
+    OutLobbyInfo.MaxPlayers = GetSteamBackend()->GetLobbyMemberLimit(LobbyID);
+    OutLobbyInfo.Region = UTF8_TO_TCHAR(GetSteamBackend()->GetLobbyData(LobbyID, "Region"));
+
+    // One fetch for everything display-only, parsed in place
+    FLobbyMetadataView Metadata;
+    if (FLobbyMetadataView::Parse(GetSteamBackend()->GetLobbyData(LobbyID, FLobbyMetadata::BlobKey), Metadata))
+    {
+        OutLobbyInfo.HostName = FString(Metadata.HostName.Len(), Metadata.HostName.GetData());
+        OutLobbyInfo.MapName = FString(Metadata.MapName.Len(), Metadata.MapName.GetData());
+        OutLobbyInfo.GameMode = FString(Metadata.GameMode.Len(), Metadata.GameMode.GetData());
+        OutLobbyInfo.BuildVersion = Metadata.BuildVersion;
+    }
+    else
+    {
+        // Hosts running an older build still publish separate keys
+        OutLobbyInfo.HostName = UTF8_TO_TCHAR(GetSteamBackend()->GetLobbyData(LobbyID, "HostName"));
+        OutLobbyInfo.MapName = UTF8_TO_TCHAR(GetSteamBackend()->GetLobbyData(LobbyID, "MapName"));
+    }
+}
+// - 3.6 - //
+void USteamMultiplayer::PrepareLobbyList(ISteamBackend& Steam, const FSteamPingLocationCache& PingLocations, const LobbyMatchList_t& Callback, FSteamLobbyListSnapshot& OutSnapshot)
+{
+    // Lobby data of listed lobbies is already local, estimating is one parse + some math per lobby
+    OutSnapshot.LobbyIDs.Reserve(Callback.m_nLobbiesMatching);
+    OutSnapshot.PingMs.Reserve(Callback.m_nLobbiesMatching);
+    for (uint32 i = 0; i < Callback.m_nLobbiesMatching; ++i)
+    {
+        const CSteamID LobbyID = Steam.GetLobbyByIndex(i);
+        OutSnapshot.LobbyIDs.Add(LobbyID);
+        OutSnapshot.PingMs.Add(PingLocations.EstimatePingTo(Steam, Steam.GetLobbyData(LobbyID, FSteamPingLocationCache::LobbyKey)));
+    }
+}
+// - 3.7 - //
+void USteamMultiplayer::SelectLobby(FSteamLobbyId LobbyID)
+{
+    const FLobbyIndexEntry* Entry = LobbyIndex.Find(LobbyID);
+    USteamMapPreloadSubsystem* MapPreload = GetMapPreload();
+    if (!Entry || !MapPreload || !FoundLobbies.IsValidIndex(Entry->FoundIndex))
+    {
+        return;
+    }
+    else if (!FoundLobbies[Entry->FoundIndex].MapName.IsEmpty())
+    {
+        MapPreload->PreloadMap(FoundLobbies[Entry->FoundIndex].MapName);
+    }
+}
+// - 3.8 - //
+void FSteamLobbyListSnapshot::Rank(int32 MaxPingMs, bool bSortByPing, TArray<int32>& OutOrder) const
+{
+    OutOrder.Reset(LobbyIDs.Num());
+    for (int32 Index = 0; Index < LobbyIDs.Num(); ++Index)
+    {
+        // Unknown pings are never filtered, the host may just run an older build
+        const int32 Ping = GetPing(Index);
+        if (MaxPingMs <= 0 || Ping < 0 || Ping <= MaxPingMs)
         {
-            FString LobbyIDStringTemp = LobbyID;
-            uint64 LobbyIDNumeric = FCString::Strtoui64(*LobbyIDStringTemp, nullptr, 10);
-            CSteamID LobbyIDSteamFormat((uint64)LobbyIDNumeric);
-            LobbyIDString = LobbyID;
-            bIsHost = false;
-            SteamMatchmaking()->JoinLobby(LobbyIDSteamFormat);
-            UE_LOG(LogTemp, Log, TEXT("Attempting to join lobby: %llu"), LobbyIDSteamFormat.ConvertToUint64());
+            OutOrder.Add(Index);
         }
     }
+
+    // Stable, so equal pings keep Steam's own order, unknown pings go last
+    if (bSortByPing)
+    {
+        Algo::StableSortBy(OutOrder, [this](int32 Index) { const int32 Ping = GetPing(Index); return Ping < 0 ? MAX_int32 : Ping; });
+    }
 }
 ///////////////////////
 // 4. Lobby Data    //
 /////////////////////////////////////////////////////
 // 4.1 - Get lobby members informations + avatar  //
 // 4.2 - Get avatar texture                      //
-//////////////////////////////////////////////////
+// 4.3 - Get avatar texture through the cache   //
+// 4.4 - Read raw avatar RGBA from Steam       //
+// 4.5 - Get the avatar atlas subsystem       //
+// 4.6 - Get the map preload subsystem       //
+// 4.7 - Does a map exist (package cache)   //
+// 4.8 - Get the voice subsystem           //
+// 4.9 - Get the lobby chat subsystem     //
+///////////////////////////////////////////
 // - 4.1 - //
 TArray<FLobbyPlayerInfo> USteamMultiplayer::GetLobbyMembersWithAvatars()
 {
+    STEAM_MP_SCOPE(STAT_SteamLobbyMembers);
+
     TArray<FLobbyPlayerInfo> PlayerInfos;
 
-    FString LobbyIDStringTemp = LobbyIDString;
-    uint64 LobbyIDNumeric = FCString::Strtoui64(*LobbyIDStringTemp, nullptr, 10);
-    CSteamID LobbyIDSteamFormat((uint64)LobbyIDNumeric);
+    CSteamID LobbyIDSteamFormat = CurrentLobbyId.ToSteamID();
+
+    USteamAvatarAtlasSubsystem* AvatarAtlas = bUseAvatarAtlas ? GetAvatarAtlas() : nullptr;
 
-    int32 NumMembers = SteamMatchmaking()->GetNumLobbyMembers(LobbyIDSteamFormat);
+    // The roster already holds IDs and names, Steam is only walked when there is none for this lobby
+    const bool bUseRoster = LobbyRoster.IsFor(LobbyIDSteamFormat);
+    int32 NumMembers = bUseRoster ? LobbyRoster.GetMembers().Num() : GetSteamBackend()->GetNumLobbyMembers(LobbyIDSteamFormat);
     for (int32 i = 0; i < NumMembers; ++i)
     {
-        CSteamID MemberID = SteamMatchmaking()->GetLobbyMemberByIndex(LobbyIDSteamFormat, i);
+        CSteamID MemberID = bUseRoster ? CSteamID(LobbyRoster.GetMembers()[i].SteamID) : GetSteamBackend()->GetLobbyMemberByIndex(LobbyIDSteamFormat, i);
         FLobbyPlayerInfo PlayerInfo;
+        PlayerInfo.SteamID = MemberID.ConvertToUint64();
 
-        const char* Name = SteamFriends()->GetFriendPersonaName(MemberID);
-        PlayerInfo.PlayerName = Name ? FString(Name) : TEXT("Unknown");
+        if (bUseRoster)
+        {
+            PlayerInfo.PlayerName = LobbyRoster.GetMembers()[i].PlayerName;
+        }
+        else
+        {
+            const char* Name = GetSteamBackend()->GetFriendPersonaName(MemberID);
+            PlayerInfo.PlayerName = Name ? FString(UTF8_TO_TCHAR(Name)) : TEXT("Unknown");
+        }
 
-        int AvatarHandle = SteamFriends()->GetLargeFriendAvatar(MemberID);
-        PlayerInfo.PlayerAvatar = AvatarHandle != -1 ? GetAvatarTexture(AvatarHandle) : nullptr;
+        int AvatarHandle = GetSteamBackend()->GetLargeFriendAvatar(MemberID);
+        if (AvatarHandle > 0 && AvatarAtlas)
+        {
+            // Atlas path, pixels are only read and queued when the slot is missing or stale
+            if (!AvatarAtlas->FindAvatar(MemberID.ConvertToUint64(), AvatarHandle, PlayerInfo))
+            {
+                uint32 Width = 0, Height = 0;
+                TArray<uint8> AvatarRGBA;
+                if (ReadAvatarRGBA(*GetSteamBackend(), AvatarHandle, Width, Height, AvatarRGBA))
+                {
+                    AvatarAtlas->AddAvatar(MemberID.ConvertToUint64(), AvatarHandle, Width, Height, MoveTemp(AvatarRGBA), PlayerInfo);
+                }
+            }
+        }
+        else
+        {
+            PlayerInfo.PlayerAvatar = AvatarHandle > 0 ? FindOrCreateAvatarTexture(MemberID, AvatarHandle) : nullptr;
+        }
 
         PlayerInfos.Add(PlayerInfo);
     }
 
+    if (AvatarAtlas)
+    {
+        AvatarAtlas->FlushUploads();
+    }
+
     return PlayerInfos;
 }
 // - 4.2 - //
 UTexture2D* USteamMultiplayer::GetAvatarTexture(int AvatarHandle)
 {
-    // Get the image size from Steam API
+    STEAM_MP_SCOPE(STAT_SteamAvatarUpload);
+
     uint32 Width = 0, Height = 0;
-    if (!SteamUtils()->GetImageSize(AvatarHandle, &Width, &Height) || Width == 0 || Height == 0)
+    TArray<uint8> AvatarRGBA;
+    if (!ReadAvatarRGBA(*GetSteamBackend(), AvatarHandle, Width, Height, AvatarRGBA))
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to get avatar image size."));
         return nullptr;
     }
     else
     {
-        // Retrieve the raw RGBA data from Steam
-        TArray<uint8> AvatarRGBA;
-        AvatarRGBA.AddUninitialized(Width * Height * 4);
-        if (!SteamUtils()->GetImageRGBA(AvatarHandle, AvatarRGBA.GetData(), AvatarRGBA.Num()))
+        // Create a new transient texture
+        UTexture2D* AvatarTexture = UTexture2D::CreateTransient(Width, Height, PF_R8G8B8A8);
+        if (!AvatarTexture)
         {
-            UE_LOG(LogTemp, Error, TEXT("Failed to get avatar image RGBA data."));
+            UE_LOG(LogSteamMultiplayer, Error, TEXT("Failed to create transient texture."));
             return nullptr;
         }
         else
         {
-            // Create a new transient texture
-            UTexture2D* AvatarTexture = UTexture2D::CreateTransient(Width, Height, PF_R8G8B8A8);
-            if (!AvatarTexture)
+            // Lock the texture for editing
+            void* TextureData = AvatarTexture->GetPlatformData()->Mips[0].BulkData.Lock(LOCK_READ_WRITE);
+            if (!TextureData)
             {
-                UE_LOG(LogTemp, Error, TEXT("Failed to create transient texture."));
+                UE_LOG(LogSteamMultiplayer, Error, TEXT("Failed to lock texture data for editing."));
                 return nullptr;
             }
             else
             {
-                // Lock the texture for editing
-                void* TextureData = AvatarTexture->GetPlatformData()->Mips[0].BulkData.Lock(LOCK_READ_WRITE);
-                if (!TextureData)
-                {
-                    UE_LOG(LogTemp, Error, TEXT("Failed to lock texture data for editing."));
-                    return nullptr;
-                }
-                else
-                {
-                    // Copy the RGBA data into the texture
-                    FMemory::Memcpy(TextureData, AvatarRGBA.GetData(), AvatarRGBA.Num());
-                    AvatarTexture->GetPlatformData()->Mips[0].BulkData.Unlock();
+                // Copy the RGBA data into the texture
+                FMemory::Memcpy(TextureData, AvatarRGBA.GetData(), AvatarRGBA.Num());
+                AvatarTexture->GetPlatformData()->Mips[0].BulkData.Unlock();
 
-                    // Update the texture
-                    AvatarTexture->UpdateResource();
+                // Update the texture
+                AvatarTexture->UpdateResource();
 
-                    // Return the created texture
-                    return AvatarTexture;
-                }
+                // Return the created texture
+                return AvatarTexture;
             }
         }
     }
 }
+// - 4.3 - //
+UTexture2D* USteamMultiplayer::FindOrCreateAvatarTexture(CSteamID MemberID, int AvatarHandle)
+{
+    const uint64 SteamID = MemberID.ConvertToUint64();
+    if (UTexture2D* CachedTexture = FindCachedAvatar(SteamID, AvatarHandle))
+    {
+        return CachedTexture;
+    }
+    else
+    {
+        UTexture2D* AvatarTexture = GetAvatarTexture(AvatarHandle);
+        if (AvatarTexture)
+        {
+            CacheAvatar(SteamID, AvatarHandle, AvatarTexture);
+        }
+        return AvatarTexture;
+    }
+}
+// - 4.4 - //
+bool USteamMultiplayer::ReadAvatarRGBA(ISteamBackend& Steam, int AvatarHandle, uint32& OutWidth, uint32& OutHeight, TArray<uint8>& OutRGBA)
+{
+    // Get the image size from Steam API
+    if (!Steam.GetImageSize(AvatarHandle, &OutWidth, &OutHeight) || OutWidth == 0 || OutHeight == 0)
+    {
+        UE_LOG(LogSteamMultiplayer, Error, TEXT("Failed to get avatar image size."));
+        return false;
+    }
+    else
+    {
+        // Retrieve the raw RGBA data from Steam
+        OutRGBA.SetNumUninitialized(OutWidth * OutHeight * 4);
+        if (!Steam.GetImageRGBA(AvatarHandle, OutRGBA.GetData(), OutRGBA.Num()))
+        {
+            UE_LOG(LogSteamMultiplayer, Error, TEXT("Failed to get avatar image RGBA data."));
+            OutRGBA.Empty();
+            return false;
+        }
+        else
+        {
+            return true;
+        }
+    }
+}
+// - 4.5 - //
+USteamAvatarAtlasSubsystem* USteamMultiplayer::GetAvatarAtlas() const
+{
+    return GetSubsystem<USteamAvatarAtlasSubsystem>();
+}
+// - 4.6 - //
+USteamMapPreloadSubsystem* USteamMultiplayer::GetMapPreload() const
+{
+    return GetSubsystem<USteamMapPreloadSubsystem>();
+}
+// - 4.7 - //
+bool USteamMultiplayer::DoesMapExist(const FString& MapName) const
+{
+    USteamMapPreloadSubsystem* MapPreload = GetMapPreload();
+    return MapPreload ? MapPreload->DoesMapExist(MapName) : FPackageName::DoesPackageExist(MapName);
+}
+// - 4.8 - //
+USteamVoiceSubsystem* USteamMultiplayer::GetVoice() const
+{
+    return GetSubsystem<USteamVoiceSubsystem>();
+}
+// - 4.9 - //
+USteamLobbyChatSubsystem* USteamMultiplayer::GetLobbyChat() const
+{
+    return GetSubsystem<USteamLobbyChatSubsystem>();
+}
+/////////////////////////
+// 5. Avatar Cache    //
+////////////////////////////////////////////////////////
+// 5.1 - Get avatar cache stats                       //
+// 5.2 - Clear avatar cache                          //
+// 5.3 - Drop a single cached avatar                //
+// 5.4 - Evict least recently used over budget     //
+// 5.5 - Callback: Avatar image loaded            //
+// 5.6 - Callback: Persona state changed         //
+// 5.7 - Look up a cached avatar                //
+// 5.8 - Store an avatar in the cache          //
+////////////////////////////////////////////////
+// - 5.1 - //
+FAvatarCacheStats USteamMultiplayer::GetAvatarCacheStats() const
+{
+    return AvatarCacheStats;
+}
+// - 5.2 - //
+void USteamMultiplayer::ClearAvatarCache()
+{
+    if (USteamAvatarAtlasSubsystem* AvatarAtlas = GetAvatarAtlas())
+    {
+        AvatarAtlas->ClearAtlas();
+    }
+
+    AvatarCacheStats.Invalidations += AvatarCache.Num();
+    AvatarCache.Empty();
+    AvatarCacheStats.Entries = 0;
+    AvatarCacheStats.BytesUsed = 0;
+    UpdateAvatarCacheStats();
+}
+// - 5.3 - //
+void USteamMultiplayer::InvalidateAvatar(uint64 SteamID)
+{
+    FSteamAvatarCacheEntry Removed;
+    if (AvatarCache.RemoveAndCopyValue(SteamID, Removed))
+    {
+        ++AvatarCacheStats.Invalidations;
+        AvatarCacheStats.BytesUsed -= Removed.SizeBytes;
+        AvatarCacheStats.Entries = AvatarCache.Num();
+        UpdateAvatarCacheStats();
+    }
+}
+// - 5.4 - //
+void USteamMultiplayer::EvictAvatarsOverBudget(uint64 KeepSteamID)
+{
+    const int64 BudgetBytes = (int64)FMath::Max(AvatarCacheBudgetKB, 0) * 1024;
+    while (AvatarCacheStats.BytesUsed > BudgetBytes && AvatarCache.Num() > 1)
+    {
+        // Cache holds a lobby or friends list worth of avatars, a linear scan is cheaper than keeping a list in sync
+        uint64 OldestID = 0;
+        uint64 OldestUse = MAX_uint64;
+        for (const TPair<uint64, FSteamAvatarCacheEntry>& Pair : AvatarCache)
+        {
+            if (Pair.Key != KeepSteamID && Pair.Value.LastUsed < OldestUse)
+            {
+                OldestID = Pair.Key;
+                OldestUse = Pair.Value.LastUsed;
+            }
+        }
+
+        FSteamAvatarCacheEntry Removed;
+        AvatarCache.RemoveAndCopyValue(OldestID, Removed);
+        AvatarCacheStats.BytesUsed -= Removed.SizeBytes;
+        ++AvatarCacheStats.Evictions;
+    }
+}
+// - 5.5 - //
+void USteamMultiplayer::OnAvatarImageLoaded(AvatarImageLoaded_t* pCallback)
+{
+    STEAM_MP_SCOPE(STAT_SteamOnAvatarImageLoaded);
+
+    // Steam finished downloading a new image for this user, the old handle is stale
+    InvalidateAvatar(pCallback->m_steamID.ConvertToUint64());
+    if (USteamAvatarAtlasSubsystem* AvatarAtlas = GetAvatarAtlas())
+    {
+        AvatarAtlas->ReleaseAvatar(pCallback->m_steamID.ConvertToUint64());
+    }
+}
+// - 5.6 - //
+void USteamMultiplayer::OnPersonaStateChanged(PersonaStateChange_t* pCallback)
+{
+    STEAM_MP_SCOPE(STAT_SteamOnPersonaStateChanged);
+
+    if (pCallback->m_nChangeFlags & k_EPersonaChangeAvatar)
+    {
+        InvalidateAvatar(pCallback->m_ulSteamID);
+        if (USteamAvatarAtlasSubsystem* AvatarAtlas = GetAvatarAtlas())
+        {
+            AvatarAtlas->ReleaseAvatar(pCallback->m_ulSteamID);
+        }
+    }
+
+    if ((pCallback->m_nChangeFlags & k_EPersonaChangeName) && LobbyRoster.RefreshMemberName(*GetSteamBackend(), CSteamID(pCallback->m_ulSteamID)))
+    {
+        const FSteamLobbyMember Member = *LobbyRoster.FindMember(pCallback->m_ulSteamID);
+        OnLobbyMemberDataChanged.Broadcast(Member, { TEXT("PlayerName") });
+    }
+
+    if ((pCallback->m_nChangeFlags & k_EPersonaChangeName) && pCallback->m_ulSteamID == GetSteamBackend()->GetLocalSteamID().ConvertToUint64())
+    {
+        LocalPersonaName = UTF8_TO_TCHAR(GetSteamBackend()->GetPersonaName());
+    }
+
+    // Friends only keep name and online state, other flags (game played, nickname...) are ignored
+    constexpr int32 FriendFlags = k_EPersonaChangeName | k_EPersonaChangeStatus | k_EPersonaChangeComeOnline | k_EPersonaChangeGoneOffline;
+    if ((pCallback->m_nChangeFlags & FriendFlags) && FriendsCache.RefreshPersona(*GetSteamBackend(), CSteamID(pCallback->m_ulSteamID)))
+    {
+        FSteamFriendInfo Friend;
+        FriendsCache.GetInfo(FriendsCache.FindRow(pCallback->m_ulSteamID), Friend);
+        OnFriendUpdated.Broadcast(Friend);
+    }
+
+    // Added or removed friends reshape the list, listeners query it again
+    if (pCallback->m_nChangeFlags & k_EPersonaChangeRelationshipChanged)
+    {
+        const CSteamID UserID(pCallback->m_ulSteamID);
+        const bool bChanged = GetSteamBackend()->IsFriend(UserID) ? FriendsCache.AddFriend(*GetSteamBackend(), UserID) : FriendsCache.RemoveFriend(pCallback->m_ulSteamID);
+        if (bChanged)
+        {
+            SET_DWORD_STAT(STAT_SteamFriends, FriendsCache.Num());
+            OnFriendsRebuilt.Broadcast();
+        }
+    }
+}
+// - 5.7 - //
+UTexture2D* USteamMultiplayer::FindCachedAvatar(uint64 SteamID, int AvatarHandle)
+{
+    ++AvatarCacheClock;
+
+    // Hit only if Steam still hands out the same image handle for this user
+    FSteamAvatarCacheEntry* Entry = AvatarCache.Find(SteamID);
+    if (Entry && Entry->AvatarHandle == AvatarHandle && IsValid(Entry->Texture))
+    {
+        ++AvatarCacheStats.Hits;
+        Entry->LastUsed = AvatarCacheClock;
+
+        // A recreated resource came up from the blank mip, send the kept pixels again
+        FTextureResource* Resource = Entry->Texture->GetResource();
+        if (Entry->Pixels.IsValid() && Resource && Resource != Entry->UploadedTo)
+        {
+            Entry->UploadedTo = Resource;
+            TArray<FSteamAvatarUpload> Uploads;
+            Uploads.Add({ Resource, (uint32)Entry->Texture->GetSizeX(), (uint32)Entry->Texture->GetSizeY(), Entry->Pixels });
+            EnqueueAvatarUploads(MoveTemp(Uploads));
+        }
+        return Entry->Texture;
+    }
+    else
+    {
+        ++AvatarCacheStats.Misses;
+        InvalidateAvatar(SteamID);
+        return nullptr;
+    }
+}
+// - 5.8 - //
+void USteamMultiplayer::CacheAvatar(uint64 SteamID, int AvatarHandle, UTexture2D* AvatarTexture, TSharedPtr<const TArray<uint8>, ESPMode::ThreadSafe> Pixels)
+{
+    InvalidateAvatar(SteamID);
+
+    FSteamAvatarCacheEntry& NewEntry = AvatarCache.Add(SteamID);
+    NewEntry.Texture = AvatarTexture;
+    NewEntry.AvatarHandle = AvatarHandle;
+    NewEntry.SizeBytes = (int64)AvatarTexture->GetSizeX() * AvatarTexture->GetSizeY() * 4 + (Pixels.IsValid() ? Pixels->Num() : 0);
+    NewEntry.LastUsed = AvatarCacheClock;
+    NewEntry.UploadedTo = Pixels.IsValid() ? AvatarTexture->GetResource() : nullptr;
+    NewEntry.Pixels = MoveTemp(Pixels);
+    AvatarCacheStats.BytesUsed += NewEntry.SizeBytes;
+
+    EvictAvatarsOverBudget(SteamID);
+    AvatarCacheStats.Entries = AvatarCache.Num();
+    UpdateAvatarCacheStats();
+}
+/////////////////////////
+// 6. Async Avatars   //
+////////////////////////////////////////////////////////////
+// 6.1 - Get lobby members, decode missing avatars async //
+// 6.2 - Create textures and upload them in one batch   //
+// 6.3 - Get avatar pipeline timings                   //
+// 6.4 - Record a pipeline timing sample              //
+// 6.5 - Decode avatars on a worker                  //
+// 6.6 - Prewarm one avatar                         //
+/////////////////////////////////////////////////////
+// - 6.1 - //
+TArray<FLobbyPlayerInfo> USteamMultiplayer::GetLobbyMembersWithAvatarsAsync()
+{
+    TArray<FLobbyPlayerInfo> PlayerInfos;
+    TArray<FSteamAvatarDecodeJob> Jobs;
+    const double StartTime = FPlatformTime::Seconds();
+
+    CSteamID LobbyIDSteamFormat = CurrentLobbyId.ToSteamID();
+
+    USteamAvatarAtlasSubsystem* AvatarAtlas = bUseAvatarAtlas ? GetAvatarAtlas() : nullptr;
+
+    // Same as the sync path, the roster holds IDs and names and Steam is only walked when there is none for this lobby
+    const bool bUseRoster = LobbyRoster.IsFor(LobbyIDSteamFormat);
+    int32 NumMembers = bUseRoster ? LobbyRoster.GetMembers().Num() : GetSteamBackend()->GetNumLobbyMembers(LobbyIDSteamFormat);
+    PlayerInfos.Reserve(NumMembers);
+    for (int32 i = 0; i < NumMembers; ++i)
+    {
+        CSteamID MemberID = bUseRoster ? CSteamID(LobbyRoster.GetMembers()[i].SteamID) : GetSteamBackend()->GetLobbyMemberByIndex(LobbyIDSteamFormat, i);
+        const uint64 SteamID = MemberID.ConvertToUint64();
+        FLobbyPlayerInfo& PlayerInfo = PlayerInfos.AddDefaulted_GetRef();
+        PlayerInfo.SteamID = SteamID;
+
+        if (bUseRoster)
+        {
+            PlayerInfo.PlayerName = LobbyRoster.GetMembers()[i].PlayerName;
+        }
+        else
+        {
+            const char* Name = GetSteamBackend()->GetFriendPersonaName(MemberID);
+            PlayerInfo.PlayerName = Name ? FString(UTF8_TO_TCHAR(Name)) : TEXT("Unknown");
+        }
+        PlayerInfo.PlayerAvatar = nullptr;
+
+        int AvatarHandle = GetSteamBackend()->GetLargeFriendAvatar(MemberID);
+        if (AvatarHandle <= 0)
+        {
+            continue;
+        }
+
+        bool bHit = false;
+        if (AvatarAtlas)
+        {
+            bHit = AvatarAtlas->FindAvatar(SteamID, AvatarHandle, PlayerInfo);
+        }
+        else
+        {
+            PlayerInfo.PlayerAvatar = FindCachedAvatar(SteamID, AvatarHandle);
+            bHit = PlayerInfo.PlayerAvatar != nullptr;
+        }
+
+        if (!bHit && !AvatarsInFlight.Contains(SteamID))
+        {
+            AvatarsInFlight.Add(SteamID);
+            SET_DWORD_STAT(STAT_SteamAvatarsInFlight, AvatarsInFlight.Num());
+
+            FSteamAvatarDecodeJob& Job = Jobs.AddDefaulted_GetRef();
+            Job.MemberIndex = i;
+            Job.SteamID = SteamID;
+            Job.AvatarHandle = AvatarHandle;
+            Job.PlayerName = PlayerInfo.PlayerName;
+        }
+    }
+
+    if (Jobs.Num() > 0)
+    {
+        LaunchAvatarDecodes(MoveTemp(Jobs), StartTime);
+    }
+
+    return PlayerInfos;
+}
+// - 6.2 - //
+void USteamMultiplayer::UploadDecodedAvatars(TArray<FSteamAvatarDecodeJob>&& Jobs, double StartTime)
+{
+    STEAM_MP_SCOPE(STAT_SteamAvatarUploadBatch);
+
+    TArray<FSteamAvatarUpload> Uploads;
+    TArray<TPair<int32, FLobbyPlayerInfo>> Ready;
+    Uploads.Reserve(Jobs.Num());
+    USteamAvatarAtlasSubsystem* AvatarAtlas = bUseAvatarAtlas ? GetAvatarAtlas() : nullptr;
+
+    for (FSteamAvatarDecodeJob& Job : Jobs)
+    {
+        AvatarsInFlight.Remove(Job.SteamID);
+        if (Job.RGBA.Num() == 0)
+        {
+            continue;
+        }
+
+        if (AvatarAtlas)
+        {
+            // Atlas batches its own uploads, flushed once below
+            FLobbyPlayerInfo PlayerInfo;
+            PlayerInfo.SteamID = Job.SteamID;
+            PlayerInfo.PlayerName = MoveTemp(Job.PlayerName);
+            if (AvatarAtlas->AddAvatar(Job.SteamID, Job.AvatarHandle, Job.Width, Job.Height, MoveTemp(Job.RGBA), PlayerInfo))
+            {
+                Ready.Emplace(Job.MemberIndex, MoveTemp(PlayerInfo));
+            }
+            continue;
+        }
+
+        UTexture2D* AvatarTexture = UTexture2D::CreateTransient(Job.Width, Job.Height, PF_R8G8B8A8);
+        if (!AvatarTexture)
+        {
+            UE_LOG(LogSteamMultiplayer, Error, TEXT("Failed to create transient texture."));
+            continue;
+        }
+
+        // Creates the RHI texture, pixels are written straight from the worker buffer below.
+        // The cache keeps that buffer (moved, not copied) to re-send it if the resource is ever recreated
+        AvatarTexture->UpdateResource();
+        TSharedPtr<const TArray<uint8>, ESPMode::ThreadSafe> Pixels = MakeShared<const TArray<uint8>, ESPMode::ThreadSafe>(MoveTemp(Job.RGBA));
+        Uploads.Add({ AvatarTexture->GetResource(), Job.Width, Job.Height, Pixels });
+        CacheAvatar(Job.SteamID, Job.AvatarHandle, AvatarTexture, MoveTemp(Pixels));
+
+        FLobbyPlayerInfo PlayerInfo;
+        PlayerInfo.SteamID = Job.SteamID;
+        PlayerInfo.PlayerName = MoveTemp(Job.PlayerName);
+        PlayerInfo.PlayerAvatar = AvatarTexture;
+        Ready.Emplace(Job.MemberIndex, MoveTemp(PlayerInfo));
+    }
+
+    SET_DWORD_STAT(STAT_SteamAvatarsInFlight, AvatarsInFlight.Num());
+    if (AvatarAtlas)
+    {
+        AvatarAtlas->FlushUploads();
+    }
+    EnqueueAvatarUploads(MoveTemp(Uploads));
+
+    for (const TPair<int32, FLobbyPlayerInfo>& Pair : Ready)
+    {
+        // Prewarmed avatars have no member row to tell anyone about
+        if (Pair.Key != INDEX_NONE)
+        {
+            OnLobbyMemberAvatarReady.Broadcast(Pair.Key, Pair.Value);
+        }
+    }
+
+    RecordAvatarPipelineSample((float)((FPlatformTime::Seconds() - StartTime) * 1000.0));
+}
+
+void USteamMultiplayer::EnqueueAvatarUploads(TArray<FSteamAvatarUpload>&& Uploads)
+{
+    if (Uploads.Num() == 0)
+    {
+        return;
+    }
+
+    // One render command for the whole batch
+    ENQUEUE_RENDER_COMMAND(UploadSteamAvatars)(
+        [Uploads = MoveTemp(Uploads)](FRHICommandListImmediate& RHICmdList)
+        {
+            for (const FSteamAvatarUpload& Upload : Uploads)
+            {
+                if (Upload.Resource && Upload.Resource->GetTexture2DRHI())
+                {
+                    const FUpdateTextureRegion2D Region(0, 0, 0, 0, Upload.Width, Upload.Height);
+                    RHICmdList.UpdateTexture2D(Upload.Resource->GetTexture2DRHI(), 0, Region, Upload.Width * 4, Upload.Pixels->GetData());
+                }
+            }
+        });
+}
+// - 6.3 - //
+FAvatarPipelineStats USteamMultiplayer::GetAvatarPipelineStats() const
+{
+    FAvatarPipelineStats Stats;
+    Stats.Samples = AvatarPipelineSamples.Num();
+    if (Stats.Samples > 0)
+    {
+        TArray<float> Sorted = AvatarPipelineSamples;
+        Sorted.Sort();
+        Stats.P50Ms = Sorted[(Stats.Samples - 1) * 50 / 100];
+        Stats.P99Ms = Sorted[(Stats.Samples - 1) * 99 / 100];
+    }
+    return Stats;
+}
+// - 6.4 - //
+void USteamMultiplayer::RecordAvatarPipelineSample(float Ms)
+{
+    constexpr int32 MaxSamples = 256;
+    if (AvatarPipelineSamples.Num() < MaxSamples)
+    {
+        AvatarPipelineSamples.Add(Ms);
+    }
+    else
+    {
+        AvatarPipelineSamples[AvatarPipelineSampleCursor] = Ms;
+        AvatarPipelineSampleCursor = (AvatarPipelineSampleCursor + 1) % MaxSamples;
+    }
+}
+// - 6.5 - //
+void USteamMultiplayer::LaunchAvatarDecodes(TArray<FSteamAvatarDecodeJob>&& Jobs, double StartTime)
+{
+    // Pull RGBA off the game thread, then come back to create the textures
+    TWeakObjectPtr<USteamMultiplayer> WeakThis(this);
+    TSharedPtr<ISteamBackend, ESPMode::ThreadSafe> Backend = SteamBackend;
+    UE::Tasks::Launch(UE_SOURCE_LOCATION, [WeakThis, Backend, Jobs = MoveTemp(Jobs), StartTime]() mutable
+    {
+        for (FSteamAvatarDecodeJob& Job : Jobs)
+        {
+            ReadAvatarRGBA(*Backend, Job.AvatarHandle, Job.Width, Job.Height, Job.RGBA);
+        }
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, Jobs = MoveTemp(Jobs), StartTime]() mutable
+        {
+            if (USteamMultiplayer* This = WeakThis.Get())
+            {
+                This->UploadDecodedAvatars(MoveTemp(Jobs), StartTime);
+            }
+        });
+    });
+}
+// - 6.6 - //
+bool USteamMultiplayer::PrewarmAvatar(CSteamID UserID)
+{
+    // -1 = Steam is still fetching the image, 0 = the user has none
+    const int AvatarHandle = IsSteamInitialized() ? GetSteamBackend()->GetLargeFriendAvatar(UserID) : 0;
+    if (AvatarHandle < 0)
+    {
+        return false;
+    }
+    else if (AvatarHandle == 0)
+    {
+        return true;
+    }
+
+    const uint64 SteamID = UserID.ConvertToUint64();
+    USteamAvatarAtlasSubsystem* AvatarAtlas = bUseAvatarAtlas ? GetAvatarAtlas() : nullptr;
+    FLobbyPlayerInfo Cached;
+    const bool bHit = AvatarAtlas ? AvatarAtlas->FindAvatar(SteamID, AvatarHandle, Cached) : FindCachedAvatar(SteamID, AvatarHandle) != nullptr;
+    if (!bHit && !AvatarsInFlight.Contains(SteamID))
+    {
+        AvatarsInFlight.Add(SteamID);
+        SET_DWORD_STAT(STAT_SteamAvatarsInFlight, AvatarsInFlight.Num());
+
+        TArray<FSteamAvatarDecodeJob> Jobs;
+        FSteamAvatarDecodeJob& Job = Jobs.AddDefaulted_GetRef();
+        Job.SteamID = SteamID;
+        Job.AvatarHandle = AvatarHandle;
+        LaunchAvatarDecodes(MoveTemp(Jobs), FPlatformTime::Seconds());
+    }
+    return true;
+}
+/////////////////////////
+// 7. Server Browser  //
+////////////////////////////////////////////////////////
+// 7.1 - Start a filtered lobby search                //
+// 7.2 - Cancel a lobby search                       //
+// 7.3 - Materialize one page of results            //
+// 7.4 - Stop paging                               //
+// 7.5 - Push search filters to Steam             //
+// 7.6 - Order FoundLobbies by ping             //
+////////////////////////////////////////////////
+// - 7.1 - //
+int32 USteamMultiplayer::FindLobbies(const FLobbySearchQuery& Query)
+{
+    if (!IsSteamInitialized())
+    {
+        UE_LOG(LogSteamMultiplayer, Error, TEXT("Steam API is not initialized."));
+        return 0;
+    }
+    else
+    {
+        ISteamBackend* Steam = GetSteamBackend();
+
+        // A new search supersedes whatever is still paging in
+        StopLobbySearchPaging();
+        ActiveSearchHandle = NextSearchHandle++;
+        ActiveSearchPageSize = FMath::Max(Query.PageSize, 1);
+        ActiveSearchMaxPingMs = Query.MaxPingMs;
+        bActiveSearchSortByPing = Query.bSortByPing;
+
+        // One local location for the whole result set, the preparer estimates every host from it
+        PingLocations->Refresh(*Steam);
+
+        PushLobbySearchFilters(*Steam, Query);
+        ActiveSearchCall = Steam->RequestLobbyList();
+        if (ActiveSearchCall == k_uAPICallInvalid)
+        {
+            UE_LOG(LogSteamMultiplayer, Error, TEXT("Steam refused the lobby list request."));
+            StopLobbySearchPaging();
+            return 0;
+        }
+
+        // Only this request's result may fill FoundLobbies, a newer search cancels the wait
+        const double StartTime = BeginOperation(ESteamOperation::RequestLobbyList);
+        Steam->WatchCallResult<LobbyMatchList_t>(ActiveSearchCall, [this, StartTime](LobbyMatchList_t* pCallback, bool bIOFailure, const void* Prepared)
+        {
+            EndOperation(ESteamOperation::RequestLobbyList, StartTime);
+            ActiveSearchCall = k_uAPICallInvalid;
+
+            if (!pCallback || !Prepared)
+            {
+                UE_LOG(LogSteamMultiplayer, Error, TEXT("Lobby search %d failed, Steam did not deliver the list."), ActiveSearchHandle);
+                StopLobbySearchPaging();
+            }
+            else
+            {
+                OnLobbyListReceived(pCallback, *(const FSteamLobbyListSnapshot*)Prepared);
+            }
+        });
+
+        UE_LOG(LogSteamMultiplayer, Log, TEXT("Lobby search %d requested for tag: %s, region: %s"), ActiveSearchHandle, *Query.GameKey, *Query.Region);
+        return ActiveSearchHandle;
+    }
+}
+// - 7.2 - //
+void USteamMultiplayer::CancelLobbySearch(int32 SearchHandle)
+{
+    if (SearchHandle != 0 && SearchHandle == ActiveSearchHandle)
+    {
+        StopLobbySearchPaging();
+    }
+}
+// - 7.3 - //
+bool USteamMultiplayer::TickLobbySearchPages(float DeltaTime)
+{
+    STEAM_MP_SCOPE(STAT_SteamLobbyListPage);
+
+    if (ActiveSearchHandle == 0)
+    {
+        return false;
+    }
+
+    const uint32 Generation = LobbyListGeneration;
+    const int32 FirstRow = FoundLobbies.Num();
+    const int32 PageEnd = FMath::Min(PendingLobbyCursor + ActiveSearchPageSize, PendingLobbyRows.Num());
+    TArray<FSteamLobbyId, TInlineAllocator<16>> Changed;
+
+    // Only new or dirty lobbies get their strings re-read
+    for (; PendingLobbyCursor < PageEnd; ++PendingLobbyCursor)
+    {
+        CSteamID LobbyID = PendingLobbyRows[PendingLobbyCursor];
+        const FSteamLobbyId LobbyKey(LobbyID);
+
+        FLobbyIndexEntry* Entry = LobbyIndex.Find(LobbyKey);
+        if (!Entry)
+        {
+            FLobbyIndexEntry& NewEntry = LobbyIndex.Add(LobbyKey);
+            NewEntry.Generation = Generation;
+            NewEntry.FoundIndex = FoundLobbies.Num();
+            FLobbyInfoData& LobbyInfo = FoundLobbies.AddDefaulted_GetRef();
+            ReadLobbyInfo(LobbyID, LobbyInfo);
+            LobbyInfo.PingMs = PendingLobbyPings[PendingLobbyCursor];
+        }
+        else
+        {
+            FLobbyInfoData& LobbyInfo = FoundLobbies[Entry->FoundIndex];
+            const int32 PingMs = PendingLobbyPings[PendingLobbyCursor];
+            if (Entry->bDataDirty)
+            {
+                Entry->bDataDirty = false;
+                ReadLobbyInfo(LobbyID, LobbyInfo);
+                LobbyInfo.PingMs = PingMs;
+                Changed.Add(LobbyKey);
+            }
+            else
+            {
+                // Member counts are plain ints, cheap enough to check every refresh
+                const int32 CurrentPlayers = GetSteamBackend()->GetNumLobbyMembers(LobbyID);
+                const int32 MaxPlayers = GetSteamBackend()->GetLobbyMemberLimit(LobbyID);
+                if (CurrentPlayers != LobbyInfo.CurrentPlayers || MaxPlayers != LobbyInfo.MaxPlayers || PingMs != LobbyInfo.PingMs)
+                {
+                    LobbyInfo.CurrentPlayers = CurrentPlayers;
+                    LobbyInfo.MaxPlayers = MaxPlayers;
+                    LobbyInfo.PingMs = PingMs;
+                    Changed.Add(LobbyKey);
+                }
+            }
+        }
+    }
+
+    SET_DWORD_STAT(STAT_SteamFoundLobbies, FoundLobbies.Num());
+    const int32 SearchHandle = ActiveSearchHandle;
+    const bool bLastPage = PendingLobbyCursor >= PendingLobbyRows.Num();
+    const bool bSortByPing = bActiveSearchSortByPing;
+    if (bLastPage)
+    {
+        StopLobbySearchPaging();
+    }
+
+    for (int32 Row = FirstRow; Row < FoundLobbies.Num(); ++Row)
+    {
+        OnFoundLobbyAdded.Broadcast(FoundLobbies[Row]);
+    }
+    for (const FSteamLobbyId& LobbyKey : Changed)
+    {
+        OnFoundLobbyChanged.Broadcast(FoundLobbies[LobbyIndex.FindChecked(LobbyKey).FoundIndex]);
+    }
+
+    // Rows kept from the previous result sit where they were, one final sort covers them too
+    if (bLastPage && bSortByPing && SortFoundLobbiesByPing())
+    {
+        OnLobbySearchPage.Broadcast(SearchHandle, 0, FoundLobbies.Num(), bLastPage);
+    }
+    else
+    {
+        OnLobbySearchPage.Broadcast(SearchHandle, FirstRow, FoundLobbies.Num() - FirstRow, bLastPage);
+    }
+
+    return !bLastPage;
+}
+// - 7.4 - //
+void USteamMultiplayer::StopLobbySearchPaging()
+{
+    if (LobbyPageTicker.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(LobbyPageTicker);
+        LobbyPageTicker.Reset();
+    }
+    if (ActiveSearchCall != k_uAPICallInvalid)
+    {
+        GetSteamBackend()->CancelCallResult(ActiveSearchCall);
+        ActiveSearchCall = k_uAPICallInvalid;
+    }
+    ActiveSearchHandle = 0;
+    PendingLobbyRows.Reset();
+    PendingLobbyPings.Reset();
+    PendingLobbyCursor = 0;
+}
+// - 7.5 - //
+void USteamMultiplayer::PushLobbySearchFilters(ISteamBackend& Steam, const FLobbySearchQuery& Query)
+{
+    // Every filter goes to Steam, so only matching lobbies come back over the wire
+    Steam.AddRequestLobbyListStringFilter("GameKey", TCHAR_TO_UTF8(*Query.GameKey), k_ELobbyComparisonEqual);
+    if (!Query.Region.IsEmpty() && Query.Region != TEXT("Auto"))
+    {
+        Steam.AddRequestLobbyListStringFilter("Region", TCHAR_TO_UTF8(*Query.Region), k_ELobbyComparisonEqual);
+    }
+    Steam.AddRequestLobbyListDistanceFilter((ELobbyDistanceFilter)Query.Distance);
+    if (Query.MinOpenSlots > 0)
+    {
+        Steam.AddRequestLobbyListFilterSlotsAvailable(Query.MinOpenSlots);
+    }
+    for (const FLobbyNumericFilter& Filter : Query.NumericFilters)
+    {
+        const ELobbyComparison Comparison = (ELobbyComparison)((int32)Filter.Comparison + k_ELobbyComparisonEqualToOrLessThan);
+        Steam.AddRequestLobbyListNumericalFilter(TCHAR_TO_UTF8(*Filter.Key), Filter.Value, Comparison);
+    }
+    for (const FLobbyNearValueFilter& Filter : Query.NearValueFilters)
+    {
+        Steam.AddRequestLobbyListNearValueFilter(TCHAR_TO_UTF8(*Filter.Key), Filter.Value);
+    }
+    if (Query.MaxResults > 0)
+    {
+        Steam.AddRequestLobbyListResultCountFilter(Query.MaxResults);
+    }
+}
+// - 7.6 - //
+bool USteamMultiplayer::SortFoundLobbiesByPing()
+{
+    // False when already in order, so the common refresh skips the re-index
+    auto PingKey = [](const FLobbyInfoData& LobbyInfo) { return LobbyInfo.PingMs < 0 ? MAX_int32 : LobbyInfo.PingMs; };
+    if (Algo::IsSortedBy(FoundLobbies, PingKey))
+    {
+        return false;
+    }
+    else
+    {
+        Algo::StableSortBy(FoundLobbies, PingKey);
+        for (int32 Row = 0; Row < FoundLobbies.Num(); ++Row)
+        {
+            LobbyIndex.FindChecked(FoundLobbies[Row].LobbyId).FoundIndex = Row;
+        }
+        return true;
+    }
+}
+/////////////////////////
+// 8. Diagnostics     //
+////////////////////////////////////////////////////////
+// 8.1 - Get request -> callback latency              //
+// 8.2 - Request sent, start the clock               //
+// 8.3 - Callback landed, record the sample         //
+// 8.4 - Push avatar cache numbers to stats        //
+// 8.5 - Get Steam socket connection stats         //
+////////////////////////////////////////////////////
+// - 8.1 - //
+FSteamOperationLatency USteamMultiplayer::GetOperationLatency(ESteamOperation Operation) const
+{
+    FSteamOperationLatency Latency;
+#if STEAM_MULTIPLAYER_INSTRUMENTATION
+    if (Operation < ESteamOperation::Count)
+    {
+        const FSteamLatencyHistogram& Histogram = OperationLatency[(int32)Operation];
+        Latency.Samples = Histogram.Count;
+        Latency.MeanMs = Histogram.Count > 0 ? (float)(Histogram.SumMs / Histogram.Count) : 0.f;
+        Latency.P50Ms = (float)Histogram.GetPercentileMs(0.5f);
+        Latency.P99Ms = (float)Histogram.GetPercentileMs(0.99f);
+        Latency.MaxMs = (float)Histogram.MaxMs;
+        Latency.Buckets.Append(Histogram.Buckets, FSteamLatencyHistogram::NumBuckets);
+    }
+#endif
+    return Latency;
+}
+// - 8.2 - //
+double USteamMultiplayer::BeginOperation(ESteamOperation Operation) const
+{
+#if STEAM_MULTIPLAYER_INSTRUMENTATION
+    return FPlatformTime::Seconds();
+#else
+    return 0.0;
+#endif
+}
+// - 8.3 - //
+void USteamMultiplayer::EndOperation(ESteamOperation Operation, double StartTime)
+{
+#if STEAM_MULTIPLAYER_INSTRUMENTATION
+    if (StartTime > 0.0)
+    {
+        const double Ms = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+        OperationLatency[(int32)Operation].Record(Ms);
+
+        switch (Operation)
+        {
+        case ESteamOperation::CreateLobby: SET_FLOAT_STAT(STAT_SteamCreateLobbyLatency, Ms); break;
+        case ESteamOperation::RequestLobbyList: SET_FLOAT_STAT(STAT_SteamRequestLobbyListLatency, Ms); break;
+        case ESteamOperation::JoinLobby: SET_FLOAT_STAT(STAT_SteamJoinLobbyLatency, Ms); break;
+        case ESteamOperation::QuickMatch: SET_FLOAT_STAT(STAT_SteamQuickMatchLatency, Ms); break;
+        case ESteamOperation::HostMigration: SET_FLOAT_STAT(STAT_SteamHostMigrationTime, Ms); break;
+        default: break;
+        }
+    }
+#endif
+}
+// - 8.4 - //
+void USteamMultiplayer::UpdateAvatarCacheStats()
+{
+    SET_DWORD_STAT(STAT_SteamAvatarCacheEntries, AvatarCache.Num());
+    SET_MEMORY_STAT(STAT_SteamAvatarCacheMemory, AvatarCacheStats.BytesUsed);
+}
+// - 8.5 - //
+TArray<FSteamConnectionStats> USteamMultiplayer::GetNetConnectionStats() const
+{
+    UWorld* World = GetWorld();
+    USteamSocketsNetDriver* NetDriver = World ? Cast<USteamSocketsNetDriver>(World->GetNetDriver()) : nullptr;
+    return NetDriver ? NetDriver->GetConnectionStats() : TArray<FSteamConnectionStats>();
+}
+/////////////////////////
+// 9. Async Requests  //
+////////////////////////////////////////////////////////
+// 9.1 - Create a lobby                               //
+// 9.2 - Request a lobby list                        //
+// 9.3 - Join a lobby                               //
+// 9.4 - Stop waiting on a request                 //
+// 9.5 - Quick match                              //
+// 9.6 - Cancel the quick match                  //
+// 9.7 - Is a quick match running               //
+/////////////////////////////////////////////////
+// - 9.1 - //
+TFuture<TSteamAsyncResult<FSteamLobbyId>> USteamMultiplayer::CreateLobbyAsync(ELobbyType LobbyType, int32 MaxMembers, float TimeoutSeconds, SteamAPICall_t* OutCall)
+{
+    if (!IsSteamInitialized())
+    {
+        UE_LOG(LogSteamMultiplayer, Error, TEXT("Steam API is not initialized."));
+        return MakeFulfilledPromise<TSteamAsyncResult<FSteamLobbyId>>(TSteamAsyncResult<FSteamLobbyId>(ESteamAsyncStatus::Failed)).GetFuture();
+    }
+    else
+    {
+        const SteamAPICall_t Call = GetSteamBackend()->CreateLobby(LobbyType, MaxMembers);
+        const double StartTime = BeginOperation(ESteamOperation::CreateLobby);
+        if (OutCall)
+        {
+            *OutCall = Call;
+        }
+
+        return GetAsyncCalls().Watch<LobbyCreated_t, FSteamLobbyId>(Call, TimeoutSeconds,
+            [this, StartTime](const LobbyCreated_t& Created, const void* Prepared, TSteamAsyncResult<FSteamLobbyId>& Out)
+            {
+                EndOperation(ESteamOperation::CreateLobby, StartTime);
+                Out.SteamResult = Created.m_eResult;
+                Out.Value = FSteamLobbyId(Created.m_ulSteamIDLobby);
+                return Created.m_eResult == k_EResultOK;
+            },
+            [this](const LobbyCreated_t& Created)
+            {
+                // Nobody waits for this lobby any more, don't leave it open on Steam
+                if (Created.m_eResult == k_EResultOK)
+                {
+                    UE_LOG(LogSteamMultiplayer, Log, TEXT("Leaving lobby %llu, its request was abandoned."), Created.m_ulSteamIDLobby);
+                    GetSteamBackend()->LeaveLobby(CSteamID(Created.m_ulSteamIDLobby));
+                }
+            });
+    }
+}
+// - 9.2 - //
+TFuture<TSteamAsyncResult<TArray<FLobbyInfoData>>> USteamMultiplayer::FindLobbiesAsync(const FLobbySearchQuery& Query, float TimeoutSeconds, SteamAPICall_t* OutCall)
+{
+    if (!IsSteamInitialized())
+    {
+        UE_LOG(LogSteamMultiplayer, Error, TEXT("Steam API is not initialized."));
+        return MakeFulfilledPromise<TSteamAsyncResult<TArray<FLobbyInfoData>>>(TSteamAsyncResult<TArray<FLobbyInfoData>>(ESteamAsyncStatus::Failed)).GetFuture();
+    }
+    else
+    {
+        // Filters attach to the next RequestLobbyList, so pushing and requesting back to back keeps queries apart
+        PingLocations->Refresh(*GetSteamBackend());
+        PushLobbySearchFilters(*GetSteamBackend(), Query);
+        const SteamAPICall_t Call = GetSteamBackend()->RequestLobbyList();
+        if (OutCall)
+        {
+            *OutCall = Call;
+        }
+
+        return GetAsyncCalls().Watch<LobbyMatchList_t, TArray<FLobbyInfoData>, FSteamLobbyListSnapshot>(Call, TimeoutSeconds,
+            [this, MaxPingMs = Query.MaxPingMs, bSortByPing = Query.bSortByPing](const LobbyMatchList_t& List, const FSteamLobbyListSnapshot* Snapshot, TSteamAsyncResult<TArray<FLobbyInfoData>>& Out)
+            {
+                if (!Snapshot)
+                {
+                    return false;
+                }
+
+                TArray<int32> Order;
+                Snapshot->Rank(MaxPingMs, bSortByPing, Order);
+                Out.Value.SetNum(Order.Num());
+                for (int32 Row = 0; Row < Order.Num(); ++Row)
+                {
+                    ReadLobbyInfo(Snapshot->LobbyIDs[Order[Row]], Out.Value[Row]);
+                    Out.Value[Row].PingMs = Snapshot->GetPing(Order[Row]);
+                }
+                return true;
+            });
+    }
+}
+// - 9.3 - //
+TFuture<TSteamAsyncResult<FSteamLobbyId>> USteamMultiplayer::JoinLobbyAsync(FSteamLobbyId LobbyID, float TimeoutSeconds, SteamAPICall_t* OutCall)
+{
+    if (!IsSteamInitialized())
+    {
+        UE_LOG(LogSteamMultiplayer, Error, TEXT("Steam API is not initialized."));
+        return MakeFulfilledPromise<TSteamAsyncResult<FSteamLobbyId>>(TSteamAsyncResult<FSteamLobbyId>(ESteamAsyncStatus::Failed)).GetFuture();
+    }
+    else
+    {
+        const SteamAPICall_t Call = GetSteamBackend()->JoinLobby(LobbyID.ToSteamID());
+        const double StartTime = BeginOperation(ESteamOperation::JoinLobby);
+        if (OutCall)
+        {
+            *OutCall = Call;
+        }
+
+        return GetAsyncCalls().Watch<LobbyEnter_t, FSteamLobbyId>(Call, TimeoutSeconds,
+            [this, StartTime](const LobbyEnter_t& Entered, const void* Prepared, TSteamAsyncResult<FSteamLobbyId>& Out)
+            {
+                EndOperation(ESteamOperation::JoinLobby, StartTime);
+                Out.SteamResult = (int32)Entered.m_EChatRoomEnterResponse;
+                Out.Value = FSteamLobbyId(Entered.m_ulSteamIDLobby);
+                return Entered.m_EChatRoomEnterResponse == k_EChatRoomEnterResponseSuccess;
+            });
+    }
+}
+// - 9.4 - //
+bool USteamMultiplayer::CancelSteamCall(SteamAPICall_t Call)
+{
+    return AsyncCalls.IsValid() && AsyncCalls->Cancel(Call);
+}
+// - 9.5 - //
+TFuture<TSteamAsyncResult<FSteamLobbyId>> USteamMultiplayer::QuickMatchAsync(const FSteamQuickMatchSettings& Settings)
+{
+    if (!IsSteamInitialized())
+    {
+        UE_LOG(LogSteamMultiplayer, Error, TEXT("Steam API is not initialized."));
+        return MakeFulfilledPromise<TSteamAsyncResult<FSteamLobbyId>>(TSteamAsyncResult<FSteamLobbyId>(ESteamAsyncStatus::Failed)).GetFuture();
+    }
+    else
+    {
+        // The old match's joins may still land, the new one leaves them too
+        TSharedPtr<FSteamQuickMatch> Previous = QuickMatch;
+        if (Previous.IsValid())
+        {
+            Previous->Cancel();
+        }
+        QuickMatch = MakeShared<FSteamQuickMatch>(*this, Settings);
+        if (Previous.IsValid())
+        {
+            QuickMatch->InheritStragglers(*Previous);
+        }
+
+        bIsHost = false;
+        const double StartTime = BeginOperation(ESteamOperation::QuickMatch);
+        TWeakObjectPtr<USteamMultiplayer> WeakThis(this);
+        return QuickMatch->Start().Next([WeakThis, StartTime](TSteamAsyncResult<FSteamLobbyId> Result)
+        {
+            // Only matches that ended in a lobby count towards time-to-match, the result still passes through if we are gone
+            USteamMultiplayer* This = WeakThis.Get();
+            if (This && Result.IsSuccess())
+            {
+                This->EndOperation(ESteamOperation::QuickMatch, StartTime);
+            }
+            return Result;
+        });
+    }
+}
+// - 9.6 - //
+void USteamMultiplayer::CancelQuickMatch()
+{
+    if (QuickMatch.IsValid())
+    {
+        QuickMatch->Cancel();
+    }
+}
+// - 9.7 - //
+bool USteamMultiplayer::IsQuickMatching() const
+{
+    return QuickMatch.IsValid() && QuickMatch->IsRunning();
+}
+/////////////////////////
+// 10. Lobby Roster   //
+////////////////////////////////////////////////////////
+// 10.1 - Callback: Member joined or left            //
+// 10.2 - Rebuild the roster                        //
+// 10.3 - Get the roster                           //
+// 10.4 - Set local member data                   //
+// 10.5 - Set local ready state                  //
+// 10.6 - Is everyone ready                     //
+/////////////////////////////////////////////////
+// - 10.1 - //
+void USteamMultiplayer::OnLobbyChatUpdated(LobbyChatUpdate_t* pCallback)
+{
+    STEAM_MP_SCOPE(STAT_SteamOnLobbyChatUpdated);
+
+    const CSteamID MemberID(pCallback->m_ulSteamIDUserChanged);
+    FSteamLobbyMember Member;
+    if (!LobbyRoster.IsFor(CSteamID(pCallback->m_ulSteamIDLobby)))
+    {
+        return;
+    }
+    else if (pCallback->m_rgfChatMemberStateChange & k_EChatMemberStateChangeEntered)
+    {
+        if (LobbyRoster.AddMember(*GetSteamBackend(), MemberID, Member))
+        {
+            SET_DWORD_STAT(STAT_SteamLobbyRosterMembers, LobbyRoster.GetMembers().Num());
+            bSessionSnapshotDirty |= bIsHost;
+            OnLobbyMemberJoined.Broadcast(Member);
+        }
+    }
+    else if (LobbyRoster.RemoveMember(MemberID, Member))
+    {
+        // Left, disconnected, kicked and banned all end the membership the same way
+        SET_DWORD_STAT(STAT_SteamLobbyRosterMembers, LobbyRoster.GetMembers().Num());
+        bSessionSnapshotDirty |= bIsHost;
+        OnLobbyMemberLeft.Broadcast(Member);
+
+        // Steam lobby membership is how we learn the host is gone, long before the net driver times out
+        if (bEnableHostMigration && Member.SteamID != 0 && Member.SteamID == SessionHostSteamID)
+        {
+            BeginHostMigration(Member.SteamID);
+        }
+    }
+}
+// - 10.2 - //
+void USteamMultiplayer::RebuildLobbyRoster(FSteamLobbyId LobbyID)
+{
+    STEAM_MP_SCOPE(STAT_SteamLobbyRosterRebuild);
+
+    // Nothing to tell anyone when there was no roster and there still is none
+    if (!LobbyID.IsValid() && !LobbyRoster.GetLobbyID().IsValid())
+    {
+        return;
+    }
+    else
+    {
+        LobbyRoster.Rebuild(*GetSteamBackend(), LobbyID.ToSteamID(), LobbyMemberDataKeys);
+        SET_DWORD_STAT(STAT_SteamLobbyRosterMembers, LobbyRoster.GetMembers().Num());
+        PublishLobbyPresence(LobbyID);
+
+        // Out of the lobby there is no session left to publish or migrate
+        if (!LobbyID.IsValid())
+        {
+            ResetHostMigration();
+        }
+
+        // Voice and chat follow the roster, they only ever talk to people in it
+        if (USteamVoiceSubsystem* Voice = GetVoice())
+        {
+            if (LobbyID.IsValid() && bEnableLobbyVoice)
+            {
+                Voice->StartLobbyVoice(LobbyID);
+            }
+            else
+            {
+                Voice->StopLobbyVoice();
+            }
+        }
+        if (USteamLobbyChatSubsystem* Chat = GetLobbyChat())
+        {
+            if (LobbyID.IsValid() && bEnableLobbyChat)
+            {
+                Chat->StartLobbyChat(LobbyID);
+            }
+            else
+            {
+                Chat->StopLobbyChat();
+            }
+        }
+        OnLobbyRosterRebuilt.Broadcast();
+    }
+}
+// - 10.3 - //
+TArray<FSteamLobbyMember> USteamMultiplayer::GetLobbyRoster() const
+{
+    return LobbyRoster.GetMembers();
+}
+// - 10.4 - //
+void USteamMultiplayer::SetLobbyMemberData(const FString& Key, const FString& Value)
+{
+    if (!IsSteamInitialized() || !CurrentLobbyId.IsValid())
+    {
+        UE_LOG(LogSteamMultiplayer, Warning, TEXT("Not in a lobby, member data %s not set."), *Key);
+        return;
+    }
+    else
+    {
+        // Our own roster row updates when Steam echoes the change back as LobbyDataUpdate_t
+        GetSteamBackend()->SetLobbyMemberData(CurrentLobbyId.ToSteamID(), TCHAR_TO_UTF8(*Key), TCHAR_TO_UTF8(*Value));
+    }
+}
+// - 10.5 - //
+void USteamMultiplayer::SetLobbyReady(bool bReady)
+{
+    SetLobbyMemberData(UTF8_TO_TCHAR(FSteamLobbyRoster::ReadyKey), bReady ? TEXT("1") : TEXT("0"));
+}
+// - 10.6 - //
+bool USteamMultiplayer::AreAllLobbyMembersReady() const
+{
+    return LobbyRoster.AreAllReady();
+}
+/////////////////////////
+// 11. Friends        //
+///////////////////////////////////////////////////////
+// 11.1 - Re-read the friends list                  //
+// 11.2 - Rebuild the cache from friend IDs        //
+// 11.3 - Get filtered and sorted friends         //
+// 11.4 - Join the lobby a friend is in          //
+// 11.5 - Callback: Friend presence changed     //
+// 11.6 - Publish our lobby as rich presence   //
+////////////////////////////////////////////////
+// - 11.1 - //
+void USteamMultiplayer::RefreshFriends()
+{
+    if (!IsSteamInitialized())
+    {
+        UE_LOG(LogSteamMultiplayer, Warning, TEXT("Steam is not initialized, friends not refreshed."));
+        return;
+    }
+    else
+    {
+        ISteamBackend* Steam = GetSteamBackend();
+        TArray<uint64> FriendIDs;
+        const int32 NumFriends = Steam->GetFriendCount();
+        FriendIDs.Reserve(FMath::Max(NumFriends, 0));
+        for (int32 i = 0; i < NumFriends; ++i)
+        {
+            FriendIDs.Add(Steam->GetFriendByIndex(i).ConvertToUint64());
+        }
+        RebuildFriendsCache(FriendIDs);
+    }
+}
+// - 11.2 - //
+void USteamMultiplayer::RebuildFriendsCache(const TArray<uint64>& FriendIDs)
+{
+    STEAM_MP_SCOPE(STAT_SteamFriendsRebuild);
+
+    if (!IsSteamInitialized())
+    {
+        return;
+    }
+    else
+    {
+        LocalPersonaName = UTF8_TO_TCHAR(GetSteamBackend()->GetPersonaName());
+        FriendsCache.Rebuild(*GetSteamBackend(), FriendIDs);
+        SET_DWORD_STAT(STAT_SteamFriends, FriendsCache.Num());
+        OnFriendsRebuilt.Broadcast();
+    }
+}
+// - 11.3 - //
+TArray<FSteamFriendInfo> USteamMultiplayer::GetFriends(const FSteamFriendsQuery& Query)
+{
+    TArray<FSteamFriendInfo> Friends;
+    QueryFriends(Query, Friends);
+    return Friends;
+}
+
+void USteamMultiplayer::QueryFriends(const FSteamFriendsQuery& Query, TArray<FSteamFriendInfo>& OutFriends)
+{
+    STEAM_MP_SCOPE(STAT_SteamFriendsQuery);
+
+    // Assigning into rows that already hold a name reuses its buffer
+    FriendsCache.Query(Query, FriendQueryRows);
+    OutFriends.SetNum(FriendQueryRows.Num(), EAllowShrinking::No);
+    for (int32 i = 0; i < FriendQueryRows.Num(); ++i)
+    {
+        FriendsCache.GetInfo(FriendQueryRows[i], OutFriends[i]);
+    }
+}
+// - 11.4 - //
+bool USteamMultiplayer::JoinFriend(const FSteamFriendInfo& Friend)
+{
+    // The cache may know a newer lobby than the struct Blueprint held on to
+    const int32 Row = FriendsCache.FindRow(Friend.SteamID);
+    const uint64 LobbyID = Row != INDEX_NONE ? FriendsCache.GetLobbyID(Row) : Friend.LobbyID;
+    if (LobbyID == 0)
+    {
+        UE_LOG(LogSteamMultiplayer, Warning, TEXT("%s is not in a joinable lobby."), *Friend.PlayerName);
+        return false;
+    }
+    else
+    {
+        UE_LOG(LogSteamMultiplayer, Log, TEXT("Joining %s in lobby %llu."), *Friend.PlayerName, LobbyID);
+        JoinLobby(FSteamLobbyId(LobbyID));
+        return true;
+    }
+}
+// - 11.5 - //
+void USteamMultiplayer::OnFriendRichPresenceUpdated(FriendRichPresenceUpdate_t* pCallback)
+{
+    STEAM_MP_SCOPE(STAT_SteamOnFriendRichPresence);
+
+    if (FriendsCache.RefreshRichPresence(*GetSteamBackend(), pCallback->m_steamIDFriend))
+    {
+        FSteamFriendInfo Friend;
+        FriendsCache.GetInfo(FriendsCache.FindRow(pCallback->m_steamIDFriend.ConvertToUint64()), Friend);
+        OnFriendUpdated.Broadcast(Friend);
+    }
+}
+// - 11.6 - //
+void USteamMultiplayer::PublishLobbyPresence(FSteamLobbyId LobbyID)
+{
+    if (!bPublishLobbyPresence || !IsSteamInitialized())
+    {
+        return;
+    }
+    else if (LobbyID.IsValid())
+    {
+        TAnsiStringBuilder<64> Connect;
+        Connect << FSteamFriendsCache::ConnectLobbyPrefix << LobbyID.Value;
+        GetSteamBackend()->SetRichPresence(FSteamFriendsCache::ConnectKey, Connect.ToString());
+    }
+    else
+    {
+        GetSteamBackend()->SetRichPresence(FSteamFriendsCache::ConnectKey, "");
+    }
+}
+/////////////////////////
+// 12. Host Migration //
+///////////////////////////////////////////////////////////
+// 12.1 - Take the game's session snapshot              //
+// 12.2 - Start / stop publishing snapshots            //
+// 12.3 - Ticker: publish when something changed      //
+// 12.4 - Publish the snapshot                       //
+// 12.5 - Host left, start migrating                //
+// 12.6 - Pick the new host                        //
+// 12.7 - Move a running migration along          //
+// 12.8 - Map loaded during a migration          //
+// 12.9 - Ticker: give up after the timeout     //
+// 12.10 - End or drop the migration           //
+// 12.11 - Travel to the new host             //
+///////////////////////////////////////////////
+// - 12.1 - //
+void USteamMultiplayer::UpdateSessionSnapshot(const FSteamSessionSnapshot& Snapshot)
+{
+    // Sequence and host are filled in on publish, empty slots keep the order we already have
+    const int32 Sequence = SessionSnapshot.Sequence;
+    TArray<FSteamSessionSlot> Slots = MoveTemp(SessionSnapshot.Slots);
+    SessionSnapshot = Snapshot;
+    SessionSnapshot.Sequence = Sequence;
+    if (SessionSnapshot.Slots.Num() == 0)
+    {
+        SessionSnapshot.Slots = MoveTemp(Slots);
+    }
+    bSessionSnapshotDirty = true;
+}
+// - 12.2 - //
+void USteamMultiplayer::StartSessionSnapshots()
+{
+    // Whatever the game has not filled in comes from the lobby we host
+    if (SessionSnapshot.MapName.IsEmpty())
+    {
+        SessionSnapshot.MapName = HostLobbyMetadata.MapName;
+    }
+    if (SessionSnapshot.GameMode.IsEmpty())
+    {
+        SessionSnapshot.GameMode = HostLobbyMetadata.GameMode;
+    }
+
+    // The first one goes out right away, a host leaving early still leaves a snapshot behind
+    bSessionSnapshotDirty = true;
+    PublishSessionSnapshot();
+    if (!SessionSnapshotTicker.IsValid())
+    {
+        SessionSnapshotTicker = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &USteamMultiplayer::TickSessionSnapshot), FMath::Max(SessionSnapshotIntervalSeconds, 0.1f));
+    }
+}
+
+void USteamMultiplayer::StopSessionSnapshots()
+{
+    if (SessionSnapshotTicker.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(SessionSnapshotTicker);
+        SessionSnapshotTicker.Reset();
+    }
+}
+// - 12.3 - //
+bool USteamMultiplayer::TickSessionSnapshot(float DeltaTime)
+{
+    // Stops by itself once we no longer host
+    if (!bIsHost || !CurrentLobbyId.IsValid() || !IsSteamInitialized())
+    {
+        SessionSnapshotTicker.Reset();
+        return false;
+    }
+    else
+    {
+        if (bSessionSnapshotDirty)
+        {
+            PublishSessionSnapshot();
+        }
+        return true;
+    }
+}
+// - 12.4 - //
+bool USteamMultiplayer::PublishSessionSnapshot()
+{
+    STEAM_MP_SCOPE(STAT_SteamSessionSnapshotPublish);
+
+    // Only the lobby owner can write lobby data, a freshly migrated host may still wait for the handover
+    const CSteamID LobbyID = CurrentLobbyId.ToSteamID();
+    const CSteamID LocalID = GetSteamBackend()->GetLocalSteamID();
+    if (!CurrentLobbyId.IsValid() || GetSteamBackend()->GetLobbyOwner(LobbyID) != LocalID)
+    {
+        return false;
+    }
+    else
+    {
+        // Slot order picks the next host, so members keep their place and newcomers go last
+        SessionSnapshot.Slots.RemoveAll([this](const FSteamSessionSlot& Slot)
+        {
+            return LobbyRoster.FindMember(Slot.SteamID) == nullptr;
+        });
+        for (const FSteamLobbyMember& Member : LobbyRoster.GetMembers())
+        {
+            if (!SessionSnapshot.Slots.ContainsByPredicate([&Member](const FSteamSessionSlot& Slot) { return Slot.SteamID == Member.SteamID; }))
+            {
+                SessionSnapshot.Slots.AddDefaulted_GetRef().SteamID = Member.SteamID;
+            }
+        }
+
+        SessionSnapshot.HostSteamID = LocalID.ConvertToUint64();
+        ++SessionSnapshot.Sequence;
+
+        TUtf8StringBuilder<1024> SnapshotBlob;
+        SessionSnapshot.Encode(SnapshotBlob);
+        GetSteamBackend()->SetLobbyData(LobbyID, FSteamSessionSnapshot::BlobKey, (const char*)SnapshotBlob.ToString());
+        bSessionSnapshotDirty = false;
+        return true;
+    }
+}
+// - 12.5 - //
+void USteamMultiplayer::BeginHostMigration(uint64 OldHostSteamID)
+{
+    // Every member runs the same pick over the same snapshot and roster, so they agree without talking
+    const CSteamID LobbyID = CurrentLobbyId.ToSteamID();
+    const uint64 LocalSteamID = GetSteamBackend()->GetLocalSteamID().ConvertToUint64();
+    FSteamSessionSnapshot Snapshot;
+    if (!FSteamSessionSnapshot::Parse(GetSteamBackend()->GetLobbyData(LobbyID, FSteamSessionSnapshot::BlobKey), Snapshot))
+    {
+        UE_LOG(LogSteamMultiplayer, Warning, TEXT("Host left lobby %llu without a session snapshot, the new host comes from the roster."), LobbyID.ConvertToUint64());
+    }
+
+    const uint64 Successor = ChooseMigrationSuccessor(Snapshot, LobbyRoster, OldHostSteamID);
+    if (Successor == 0)
+    {
+        UE_LOG(LogSteamMultiplayer, Warning, TEXT("Host left lobby %llu and nobody is left to take over."), LobbyID.ConvertToUint64());
+        // Finish only tears down a migration that is running, the first host leaving alone still has to be reported
+        if (IsHostMigrating())
+        {
+            FinishHostMigration(false);
+        }
+        else
+        {
+            OnHostMigrationFinished.Broadcast(false);
+        }
+        return;
+    }
+    else
+    {
+        // The successor leaving halfway restarts the pick, the clock keeps running from the first host
+        if (!IsHostMigrating())
+        {
+            MigrationStartTime = BeginOperation(ESteamOperation::HostMigration);
+            MigrationTicker = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &USteamMultiplayer::TickHostMigration));
+            MigrationMapLoadedHandle = FCoreUObjectDelegates::PostLoadMapWithWorld.AddUObject(this, &USteamMultiplayer::OnMigrationMapLoaded);
+        }
+        MigrationSuccessor = Successor;
+        MigrationTimeLeft = HostMigrationTimeoutSeconds;
+        bMigrationTravelled = false;
+        bMigrationMapLoaded = false;
+        SessionHostSteamID = Successor;
+
+        // Without a snapshot map the match goes on where the lobby says it is
+        if (Snapshot.MapName.IsEmpty())
+        {
+            FLobbyMetadataView Metadata;
+            const bool bHasMap = FLobbyMetadataView::Parse(GetSteamBackend()->GetLobbyData(LobbyID, FLobbyMetadata::BlobKey), Metadata) && !Metadata.MapName.IsEmpty();
+            Snapshot.MapName = bHasMap ? FString(Metadata.MapName.Len(), Metadata.MapName.GetData()) : FLobbyMetadata().MapName;
+        }
+        SessionSnapshot = MoveTemp(Snapshot);
+        UE_LOG(LogSteamMultiplayer, Log, TEXT("Host %llu left lobby %llu, migrating to %llu."), OldHostSteamID, LobbyID.ConvertToUint64(), Successor);
+
+        // Steam names its own new owner, who hands the lobby to our pick so the new host can write lobby data
+        if (Successor != LocalSteamID && GetSteamBackend()->GetLobbyOwner(LobbyID).ConvertToUint64() == LocalSteamID && !GetSteamBackend()->SetLobbyOwner(LobbyID, CSteamID(Successor)))
+        {
+            UE_LOG(LogSteamMultiplayer, Warning, TEXT("Could not hand lobby %llu to the new host %llu."), LobbyID.ConvertToUint64(), Successor);
+        }
+
+        if (const FSteamLobbyMember* NewHost = LobbyRoster.FindMember(Successor))
+        {
+            // Copied, a handler may rebuild the roster under us
+            const FSteamLobbyMember NewHostMember = *NewHost;
+            OnHostMigrationStarted.Broadcast(NewHostMember);
+        }
+
+        // The new host starts listening straight away, the lobby handover can land while the map loads
+        if (MigrationSuccessor == LocalSteamID)
+        {
+            bIsHost = true;
+            HostLobbyMetadata.MapName = SessionSnapshot.MapName;
+            if (!SessionSnapshot.GameMode.IsEmpty())
+            {
+                HostLobbyMetadata.GameMode = SessionSnapshot.GameMode;
+            }
+
+            if (!TravelForHostMigration(true))
+            {
+                FinishHostMigration(false);
+                return;
+            }
+        }
+        UpdateHostMigration();
+    }
+}
+// - 12.6 - //
+uint64 USteamMultiplayer::ChooseMigrationSuccessor(const FSteamSessionSnapshot& Snapshot, const FSteamLobbyRoster& Roster, uint64 OldHostSteamID)
+{
+    // First slot still in the lobby, the host published the order so everyone reads the same one
+    for (const FSteamSessionSlot& Slot : Snapshot.Slots)
+    {
+        if (Slot.SteamID != OldHostSteamID && Roster.FindMember(Slot.SteamID))
+        {
+            return Slot.SteamID;
+        }
+    }
+
+    // Nobody from the snapshot is left (or there was none): lowest SteamID, just as stable
+    uint64 Lowest = 0;
+    for (const FSteamLobbyMember& Member : Roster.GetMembers())
+    {
+        if (Member.SteamID != OldHostSteamID && (Lowest == 0 || Member.SteamID < Lowest))
+        {
+            Lowest = Member.SteamID;
+        }
+    }
+    return Lowest;
+}
+// - 12.7 - //
+void USteamMultiplayer::UpdateHostMigration()
+{
+    const CSteamID LobbyID = CurrentLobbyId.ToSteamID();
+    const uint64 LocalSteamID = GetSteamBackend()->GetLocalSteamID().ConvertToUint64();
+    if (!IsHostMigrating())
+    {
+        return;
+    }
+    else if (MigrationSuccessor == LocalSteamID)
+    {
+        // Listening and owning the lobby, now the metadata and the snapshot can point everyone here
+        if (bMigrationMapLoaded && GetSteamBackend()->GetLobbyOwner(LobbyID).ConvertToUint64() == LocalSteamID)
+        {
+            PublishLobbyMetadata(LobbyID);
+            StartSessionSnapshots();
+            FinishHostMigration(true);
+        }
+    }
+    else if (!bMigrationTravelled)
+    {
+        // Clients only follow once the new host's own snapshot is up, by then it is listening
+        FSteamSessionSnapshot Snapshot;
+        if (FSteamSessionSnapshot::Parse(GetSteamBackend()->GetLobbyData(LobbyID, FSteamSessionSnapshot::BlobKey), Snapshot) && Snapshot.HostSteamID == MigrationSuccessor)
+        {
+            bMigrationTravelled = true;
+            SessionSnapshot = MoveTemp(Snapshot);
+            if (!TravelForHostMigration(false))
+            {
+                FinishHostMigration(false);
+            }
+        }
+    }
+    else if (bMigrationMapLoaded)
+    {
+        FinishHostMigration(true);
+    }
+}
+// - 12.8 - //
+void USteamMultiplayer::OnMigrationMapLoaded(UWorld* World)
+{
+    // A failed connect also ends in a map load (the default map), only the net mode we travelled for counts
+    const bool bNewHost = MigrationSuccessor == GetSteamBackend()->GetLocalSteamID().ConvertToUint64();
+    if (World && World->GetNetMode() == (bNewHost ? NM_ListenServer : NM_Client))
+    {
+        NotifyMigrationMapLoaded();
+    }
+}
+
+void USteamMultiplayer::NotifyMigrationMapLoaded()
+{
+    if (IsHostMigrating())
+    {
+        bMigrationMapLoaded = true;
+        UpdateHostMigration();
+    }
+}
+// - 12.9 - //
+bool USteamMultiplayer::TickHostMigration(float DeltaTime)
+{
+    MigrationTimeLeft -= DeltaTime;
+    if (MigrationTimeLeft > 0.f)
+    {
+        return true;
+    }
+    else
+    {
+        UE_LOG(LogSteamMultiplayer, Warning, TEXT("Host migration to %llu timed out after %.1fs."), MigrationSuccessor, HostMigrationTimeoutSeconds);
+        MigrationTicker.Reset();
+        FinishHostMigration(false);
+        return false;
+    }
+}
+// - 12.10 - //
+void USteamMultiplayer::FinishHostMigration(bool bSuccess)
+{
+    if (!IsHostMigrating())
+    {
+        return;
+    }
+    else
+    {
+        // Only recoveries are timed, a failed migration leaves no sample
+        if (bSuccess)
+        {
+            EndOperation(ESteamOperation::HostMigration, MigrationStartTime);
+        }
+        UE_LOG(LogSteamMultiplayer, Log, TEXT("Host migration to %llu %s."), MigrationSuccessor, bSuccess ? TEXT("finished") : TEXT("failed"));
+
+        MigrationSuccessor = 0;
+        bMigrationTravelled = false;
+        bMigrationMapLoaded = false;
+        if (MigrationTicker.IsValid())
+        {
+            FTSTicker::GetCoreTicker().RemoveTicker(MigrationTicker);
+            MigrationTicker.Reset();
+        }
+        if (MigrationMapLoadedHandle.IsValid())
+        {
+            FCoreUObjectDelegates::PostLoadMapWithWorld.Remove(MigrationMapLoadedHandle);
+            MigrationMapLoadedHandle.Reset();
+        }
+        OnHostMigrationFinished.Broadcast(bSuccess);
+    }
+}
+
+void USteamMultiplayer::ResetHostMigration()
+{
+    FinishHostMigration(false);
+    StopSessionSnapshots();
+    SessionSnapshot = FSteamSessionSnapshot();
+    bSessionSnapshotDirty = false;
+    SessionHostSteamID = 0;
+}
+// - 12.11 - //
+bool USteamMultiplayer::TravelForHostMigration(bool bAsNewHost)
+{
+    APlayerController* PlayerController = GetFirstLocalPlayerController();
+    if (!bAsNewHost)
+    {
+        return TravelToLobbyHost(MigrationSuccessor, SessionSnapshot.MapName, DoesMapExist(SessionSnapshot.MapName));
+    }
+    else if (!PlayerController || !DoesMapExist(SessionSnapshot.MapName))
+    {
+        UE_LOG(LogSteamMultiplayer, Error, TEXT("Cannot re-host on %s, no local player controller or the map is missing."), *SessionSnapshot.MapName);
+        return false;
+    }
+    else
+    {
+        // Opening the map as a listen server also drops the dead connection to the old host
+        PlayerController->ClientTravel(FString::Printf(TEXT("%s?listen"), *SessionSnapshot.MapName), TRAVEL_Absolute);
+        return true;
+    }
+}
 ///////////////////////////////////////////
 // MORE COMING SOON  // A.S. - hajddeen //
 /////////////////////////////////////////
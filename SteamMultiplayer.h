@@ -50,10 +50,176 @@
 ////////////
 #include "CoreMinimal.h"
 #include "Engine/GameInstance.h"
+#include "Engine/Texture2D.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "Containers/Ticker.h"
+#include "SteamLobbyMetadata.h"
+#include "SteamBackend.h"
+#include "SteamAsync.h"
+#include "SteamPingLocation.h"
+#include "SteamLobbyRoster.h"
+#include "SteamFriendsCache.h"
+#include "FakeSteamBackend.h"
+#include "SteamMultiplayerStats.h"
+#include "SteamSocketsNetDriver.h"
 #include "steam/steam_api.h"
 #include "steam/isteammatchmaking.h"
 #include "SteamMultiplayer.generated.h"
 
+////////////////////////////////////////
+// STRUCT TO HOLD A STEAM LOBBY ID    //
+////////////////////////////////////////
+// Raw 64-bit CSteamID, converted to text only for display
+USTRUCT(BlueprintType)
+struct FSteamLobbyId
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    uint64 Value = 0;
+
+    FSteamLobbyId() {}
+    explicit FSteamLobbyId(uint64 InValue) : Value(InValue) {}
+    explicit FSteamLobbyId(CSteamID InSteamID) : Value(InSteamID.ConvertToUint64()) {}
+
+    bool IsValid() const { return Value != 0; }
+    CSteamID ToSteamID() const { return CSteamID((uint64)Value); }
+    FString ToString() const { return FString::Printf(TEXT("%llu"), Value); }
+
+    bool operator==(const FSteamLobbyId& Other) const { return Value == Other.Value; }
+    bool operator!=(const FSteamLobbyId& Other) const { return Value != Other.Value; }
+    friend uint32 GetTypeHash(const FSteamLobbyId& LobbyId) { return GetTypeHash(LobbyId.Value); }
+};
+//////////////////////////////////////////
+// LOBBY SEARCH FILTERS - PUSHED TO STEAM //
+//////////////////////////////////////////
+UENUM(BlueprintType)
+enum class ESteamLobbyDistance : uint8
+{
+    Close,     // Same region only
+    Default,   // Same or nearby regions
+    Far,       // Roughly half the world
+    Worldwide  // No distance limit
+};
+
+// Mirrors ELobbyComparison, order matters for the cast in FindLobbies
+UENUM(BlueprintType)
+enum class ESteamLobbyComparison : uint8
+{
+    EqualToOrLessThan,
+    LessThan,
+    Equal,
+    GreaterThan,
+    EqualToOrGreaterThan,
+    NotEqual
+};
+
+USTRUCT(BlueprintType)
+struct FLobbyNumericFilter
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lobby Search")
+    FString Key;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lobby Search")
+    int32 Value = 0;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lobby Search")
+    ESteamLobbyComparison Comparison = ESteamLobbyComparison::Equal;
+};
+
+USTRUCT(BlueprintType)
+struct FLobbyNearValueFilter
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lobby Search")
+    FString Key;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lobby Search")
+    int32 Value = 0;
+};
+
+USTRUCT(BlueprintType)
+struct FLobbySearchQuery
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lobby Search")
+    FString GameKey = TEXT("urbanshadows");
+
+    // Empty or "Auto" leaves the region unfiltered
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lobby Search")
+    FString Region;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lobby Search")
+    ESteamLobbyDistance Distance = ESteamLobbyDistance::Default;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lobby Search")
+    int32 MinOpenSlots = 0;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lobby Search")
+    TArray<FLobbyNumericFilter> NumericFilters;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lobby Search")
+    TArray<FLobbyNearValueFilter> NearValueFilters;
+
+    // Upper bound Steam sends back, 0 keeps Steam's default
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lobby Search")
+    int32 MaxResults = 50;
+
+    // Rows materialized into FoundLobbies per frame
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lobby Search")
+    int32 PageSize = 16;
+
+    // Hosts estimated further away than this are dropped, 0 keeps everyone (hosts without a ping location always stay)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lobby Search")
+    int32 MaxPingMs = 0;
+
+    // Nearest hosts materialize first and FoundLobbies ends up ordered by PingMs
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lobby Search")
+    bool bSortByPing = true;
+};
+///////////////////////////////////////
+// QUICK MATCH SETTINGS              //
+///////////////////////////////////////
+USTRUCT(BlueprintType)
+struct FSteamQuickMatchSettings
+{
+    GENERATED_BODY()
+
+    // MinOpenSlots is raised to 1, full lobbies are never worth a join
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Quick Match")
+    FLobbySearchQuery Query;
+
+    // Best-scored lobbies that get a join attempt at all
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Quick Match")
+    int32 MaxCandidates = 6;
+
+    // Joins in flight at once
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Quick Match")
+    int32 MaxParallelJoins = 2;
+
+    // A join still unanswered after this gets company from the next candidate
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Quick Match")
+    float StaggerSeconds = 0.25f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Quick Match")
+    float JoinTimeoutSeconds = 3.f;
+
+    // Whole search + join budget
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Quick Match")
+    float DeadlineSeconds = 10.f;
+
+    // Score = ping - weight * free slots, a roomier lobby is less likely to fill during the join
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Quick Match")
+    int32 FreeSlotWeightMs = 10;
+
+    // Stand-in ping for hosts that published no ping location
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Quick Match")
+    int32 UnknownPingMs = 150;
+};
 ///////////////////////////////////////
 // STRUCT TO HOLD LOBBY INFORMATION //
 ///////////////////////////////////////
@@ -78,7 +244,17 @@ struct FLobbyInfoData
     FString MapName;
 
     UPROPERTY(BlueprintReadOnly, Category = "Lobby Info")
-    FString LobbyIDString; // Use FString instead of CSteamID
+    FString GameMode;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Lobby Info")
+    int32 BuildVersion = 0;
+
+    // Estimated round trip to the host in ms, -1 when the host published no ping location
+    UPROPERTY(BlueprintReadOnly, Category = "Lobby Info")
+    int32 PingMs = -1;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Lobby Info")
+    FSteamLobbyId LobbyId;
 };
 ///////////////////////////////////////
 // STRUCT TO HOLD PLAYER INFORMATION //
@@ -91,10 +267,204 @@ struct FLobbyPlayerInfo
     UPROPERTY(BlueprintReadOnly, Category = "Player Info")
     FString PlayerName;
 
+    UPROPERTY()
+    uint64 SteamID = 0;
+
     UPROPERTY(BlueprintReadOnly, Category = "Player Info")
-    UTexture2D* PlayerAvatar;
+    UTexture2D* PlayerAvatar = nullptr;
+
+    // Set instead of PlayerAvatar when the avatar atlas is enabled
+    UPROPERTY(BlueprintReadOnly, Category = "Player Info")
+    UTexture* AvatarAtlas = nullptr;
+
+    // Atlas sub-rect as (U0, V0, U1, V1)
+    UPROPERTY(BlueprintReadOnly, Category = "Player Info")
+    FVector4 AvatarUVRect = FVector4(0.f, 0.f, 1.f, 1.f);
+};
+/////////////////////////////////////////
+// STRUCT TO HOLD AVATAR CACHE ENTRY  //
+/////////////////////////////////////////
+USTRUCT()
+struct FSteamAvatarCacheEntry
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    UTexture2D* Texture = nullptr;
+
+    int32 AvatarHandle = -1; // Steam image handle the texture was built from
+    int64 SizeBytes = 0;     // RGBA bytes held by the texture, plus Pixels when kept
+    uint64 LastUsed = 0;     // LRU clock value of the last hit
+
+    // Batched uploads only: the mip stays blank, so a recreated resource gets these pixels again
+    TSharedPtr<const TArray<uint8>, ESPMode::ThreadSafe> Pixels;
+    const FTextureResource* UploadedTo = nullptr; // Resource Pixels last went to
+};
+///////////////////////////////////////
+// STRUCT TO HOLD AVATAR CACHE STATS //
+///////////////////////////////////////
+USTRUCT(BlueprintType)
+struct FAvatarCacheStats
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Avatar Cache")
+    int64 Hits = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Avatar Cache")
+    int64 Misses = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Avatar Cache")
+    int64 Evictions = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Avatar Cache")
+    int64 Invalidations = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Avatar Cache")
+    int32 Entries = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Avatar Cache")
+    int64 BytesUsed = 0;
+};
+//////////////////////////////////////////////
+// STRUCT TO HOLD AVATAR PIPELINE TIMINGS  //
+//////////////////////////////////////////////
+USTRUCT(BlueprintType)
+struct FAvatarPipelineStats
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Avatar Pipeline")
+    float P50Ms = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Avatar Pipeline")
+    float P99Ms = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Avatar Pipeline")
+    int32 Samples = 0;
+};
+////////////////////////////////////////////
+// STEAM REQUESTS WITH LATENCY TRACKING   //
+////////////////////////////////////////////
+UENUM(BlueprintType)
+enum class ESteamOperation : uint8
+{
+    CreateLobby,
+    RequestLobbyList,
+    JoinLobby,
+    QuickMatch, // Search through the winning lobby entered
+    HostMigration, // Host left through the new host listening / us connected to it
+    Count UMETA(Hidden)
+};
+//////////////////////////////////////////////
+// STRUCT TO HOLD REQUEST -> CALLBACK TIMES //
+//////////////////////////////////////////////
+USTRUCT(BlueprintType)
+struct FSteamOperationLatency
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Steam|Diagnostics")
+    int32 Samples = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Steam|Diagnostics")
+    float MeanMs = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Steam|Diagnostics")
+    float P50Ms = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Steam|Diagnostics")
+    float P99Ms = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Steam|Diagnostics")
+    float MaxMs = 0.f;
+
+    // Log2 buckets: [0,1) [1,2) [2,4) ... ms
+    UPROPERTY(BlueprintReadOnly, Category = "Steam|Diagnostics")
+    TArray<int32> Buckets;
+};
+//////////////////////////////////////////////////
+// LOBBY ENTER - READ OFF THE GAME THREAD        //
+//////////////////////////////////////////////////
+struct FSteamLobbyEnterInfo
+{
+    uint64 OwnerSteamID = 0;
+    bool bLocalOwner = false; // Host entering the lobby it just created
+    FString MapName;
+    bool bMapExists = false;
+};
+//////////////////////////////////////////////////
+// LOBBY LIST - READ THE MOMENT IT LANDS         //
+//////////////////////////////////////////////////
+// GetLobbyByIndex only knows the newest list, so each result keeps its own IDs
+struct FSteamLobbyListSnapshot
+{
+    TArray<CSteamID> LobbyIDs;
+    TArray<int32> PingMs; // Same order as LobbyIDs, may be shorter (missing = -1)
+
+    int32 GetPing(int32 Index) const { return PingMs.IsValidIndex(Index) ? PingMs[Index] : -1; }
+
+    // Indices into LobbyIDs that pass MaxPingMs, nearest first when sorting
+    void Rank(int32 MaxPingMs, bool bSortByPing, TArray<int32>& OutOrder) const;
+};
+/////////////////////////////////////////////////
+// AVATAR DECODE JOB - WORKER -> RENDER THREAD //
+/////////////////////////////////////////////////
+struct FSteamAvatarDecodeJob
+{
+    int32 MemberIndex = INDEX_NONE;
+    uint64 SteamID = 0;
+    int AvatarHandle = 0;
+    FString PlayerName;
+    uint32 Width = 0;
+    uint32 Height = 0;
+    TArray<uint8> RGBA; // Filled by GetImageRGBA on the worker and handed to the RHI as-is
+};
+///////////////////////////////////////////////
+// AVATAR UPLOAD - GAME -> RENDER THREAD    //
+///////////////////////////////////////////////
+struct FSteamAvatarUpload
+{
+    FTextureResource* Resource = nullptr;
+    uint32 Width = 0;
+    uint32 Height = 0;
+    TSharedPtr<const TArray<uint8>, ESPMode::ThreadSafe> Pixels; // Shared with the cache entry, never copied
+};
+///////////////////////////////////////
+// BLUEPRINT HELPERS FOR LOBBY IDS  //
+///////////////////////////////////////
+UCLASS()
+class URBANSHADOWS_API USteamLobbyIdLibrary : public UBlueprintFunctionLibrary
+{
+    GENERATED_BODY()
+
+public:
+    UFUNCTION(BlueprintPure, Category = "Steam|Lobby Id", meta = (DisplayName = "To String (Steam Lobby Id)", CompactNodeTitle = "->", BlueprintAutocast))
+    static FString Conv_SteamLobbyIdToString(const FSteamLobbyId& LobbyId) { return LobbyId.ToString(); }
+
+    UFUNCTION(BlueprintPure, Category = "Steam|Lobby Id")
+    static bool IsValidLobbyId(const FSteamLobbyId& LobbyId) { return LobbyId.IsValid(); }
+
+    UFUNCTION(BlueprintPure, Category = "Steam|Lobby Id", meta = (DisplayName = "Equal (Steam Lobby Id)", CompactNodeTitle = "=="))
+    static bool EqualEqual_SteamLobbyId(const FSteamLobbyId& A, const FSteamLobbyId& B) { return A == B; }
+
+    UFUNCTION(BlueprintPure, Category = "Steam|Lobby Id", meta = (DisplayName = "Not Equal (Steam Lobby Id)", CompactNodeTitle = "!="))
+    static bool NotEqual_SteamLobbyId(const FSteamLobbyId& A, const FSteamLobbyId& B) { return A != B; }
 };
 ////////////////
+// DELEGATES //
+////////////////
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnLobbyMemberAvatarReady, int32, MemberIndex, const FLobbyPlayerInfo&, PlayerInfo);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnFoundLobbyEvent, const FLobbyInfoData&, LobbyInfo);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_FourParams(FOnLobbySearchPage, int32, SearchHandle, int32, FirstRow, int32, NumRows, bool, bLastPage);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnLobbyMemberEvent, const FSteamLobbyMember&, Member);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnLobbyMemberDataChanged, const FSteamLobbyMember&, Member, const TArray<FString>&, ChangedKeys);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnLobbyRosterRebuilt);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnFriendUpdated, const FSteamFriendInfo&, Friend);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnFriendsRebuilt);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnHostMigrationStarted, const FSteamLobbyMember&, NewHost);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnHostMigrationFinished, bool, bSuccess);
+////////////////
 // MAIN BODY //
 ////////////////
 UCLASS()
@@ -102,12 +472,17 @@ class URBANSHADOWS_API USteamMultiplayer : public UGameInstance
 {
     GENERATED_BODY()
 
+    // Benchmarks and tests drive the callback handlers and internals directly
+    friend class USteamLobbyBenchmarkCommandlet;
+    friend class FFakeSteamBackendHostListJoinTest;
+
 public:
     //////////////////////////////////////////////
     // 1. Constructor and Initialization       //
     ////////////////////////////////////////////
     USteamMultiplayer();
 
+    // Idempotent. USteamInitSubsystem already calls it at startup when bInitializeSteamOnStartup is set
     UFUNCTION(BlueprintCallable, Category = "Steam")
     void InitializeSteam();
 
@@ -117,29 +492,101 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Steam")
     bool IsSteamInitialized() const;
 
+    virtual void Shutdown() override;
+
+    // Everything Steam goes through this, real Steamworks or the in-process fake
+    ISteamBackend* GetSteamBackend() const;
+
+    // Initialize while the game instance starts and prewarm avatar, friends and ping (see USteamInitSubsystem)
+    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Steam")
+    bool bInitializeSteamOnStartup;
+
+    // Simulate Steam in-process instead of talking to the client (also enabled by -FakeSteam)
+    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Steam|Fake Backend")
+    bool bUseFakeSteamBackend;
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Steam|Fake Backend")
+    FFakeSteamConfig FakeSteamConfig;
+
+    // Drain Steam callbacks on a background thread (SteamAPI_ManualDispatch), also enabled by -SteamManualDispatch
+    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Steam|Callbacks")
+    bool bManualSteamDispatch;
+
+    // Game thread time spent per frame dispatching pumped callbacks, the rest waits for the next frame
+    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Steam|Callbacks", meta = (ClampMin = "0.1"))
+    float SteamCallbackBudgetMs;
+
     //////////////////////////////////////////////
     // 2. Steam Matchmaking and Multiplayer    //
     ////////////////////////////////////////////
     UFUNCTION(BlueprintCallable, Category = "Steam")
     void HostGameWithSteamMatchmaking();
 
+    // Published as a single packed lobby key when hosting, HostName is filled in automatically
+    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Steam|Lobby Metadata")
+    FLobbyMetadata HostLobbyMetadata;
+
+    // Replicate over Steam Networking Sockets (P2P, relayed) instead of plain IP, needs the real Steam backend
+    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Steam|Networking")
+    bool bUseSteamSockets;
+
     UFUNCTION(BlueprintCallable, Category = "Steam")
     void FindLobbiesWithSettings(FString Tag, FString Region);
 
     UFUNCTION(BlueprintCallable, Category = "Steam")
-    void JoinLobby(FString LobbyID);
+    void JoinLobby(FSteamLobbyId LobbyID);
+
+    // Call when the player highlights a lobby in FoundLobbies, its map starts streaming in before the join
+    UFUNCTION(BlueprintCallable, Category = "Steam")
+    void SelectLobby(FSteamLobbyId LobbyID);
 
+    UFUNCTION(BlueprintPure, Category = "Steam")
+    FSteamLobbyId GetCurrentLobbyId() const { return CurrentLobbyId; }
 
     UFUNCTION(BlueprintCallable, Category = "Steam")
     TArray<FLobbyPlayerInfo> GetLobbyMembersWithAvatars();
 
+    //////////////////////////////////////////////
+    // 3. Avatar Cache                         //
+    ////////////////////////////////////////////
+    UFUNCTION(BlueprintCallable, Category = "Steam|Avatar Cache")
+    FAvatarCacheStats GetAvatarCacheStats() const;
+
+    UFUNCTION(BlueprintCallable, Category = "Steam|Avatar Cache")
+    void ClearAvatarCache();
+
+    // Memory budget for cached avatar textures, least recently used avatars are dropped above it
+    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Steam|Avatar Cache")
+    int32 AvatarCacheBudgetKB;
+
+    //////////////////////////////////////////////
+    // 4. Async Avatars                        //
+    ////////////////////////////////////////////
+    // Returns names and cached avatars right away, missing avatars arrive through OnLobbyMemberAvatarReady
+    UFUNCTION(BlueprintCallable, Category = "Steam|Avatar Pipeline")
+    TArray<FLobbyPlayerInfo> GetLobbyMembersWithAvatarsAsync();
+
+    UFUNCTION(BlueprintCallable, Category = "Steam|Avatar Pipeline")
+    FAvatarPipelineStats GetAvatarPipelineStats() const;
+
+    // Gets one user's avatar into the cache (or atlas) ahead of use, nothing is broadcast.
+    // False while Steam is still downloading the image, call again later.
+    bool PrewarmAvatar(CSteamID UserID);
+
+    UPROPERTY(BlueprintAssignable, Category = "Steam|Avatar Pipeline")
+    FOnLobbyMemberAvatarReady OnLobbyMemberAvatarReady;
+
+    // Pack avatars into USteamAvatarAtlasSubsystem pages (AvatarAtlas + AvatarUVRect) instead of one texture each
+    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Steam|Avatar Atlas")
+    bool bUseAvatarAtlas;
+
 protected:
     //////////////////////////////////////////////
     // 1. Steam Callbacks                      //
     ////////////////////////////////////////////    
-    STEAM_CALLBACK(USteamMultiplayer, OnLobbyCreated, LobbyCreated_t);
     STEAM_CALLBACK(USteamMultiplayer, OnLobbyEntered, LobbyEnter_t);
-    STEAM_CALLBACK(USteamMultiplayer, OnLobbyListReceived, LobbyMatchList_t);
+    STEAM_CALLBACK(USteamMultiplayer, OnAvatarImageLoaded, AvatarImageLoaded_t);
+    STEAM_CALLBACK(USteamMultiplayer, OnPersonaStateChanged, PersonaStateChange_t);
 
     //////////////////////////////////////////////
     // 2. Blueprint-Accessible Members         //
@@ -147,13 +594,363 @@ protected:
     UPROPERTY(BlueprintReadOnly, Category = "Lobbies")
     TArray<FLobbyInfoData> FoundLobbies;
 
+public:
+    //////////////////////////////////////////////
+    // 5. Lobby List Events                    //
+    ////////////////////////////////////////////
+    // FoundLobbies is updated in place, these fire only for rows that actually changed
+    UPROPERTY(BlueprintAssignable, Category = "Lobbies")
+    FOnFoundLobbyEvent OnFoundLobbyAdded;
+
+    UPROPERTY(BlueprintAssignable, Category = "Lobbies")
+    FOnFoundLobbyEvent OnFoundLobbyRemoved;
+
+    UPROPERTY(BlueprintAssignable, Category = "Lobbies")
+    FOnFoundLobbyEvent OnFoundLobbyChanged;
+
+    //////////////////////////////////////////////
+    // 6. Server Browser                       //
+    ////////////////////////////////////////////
+    // Starts a filtered search and supersedes any running one, returns a handle for CancelLobbySearch
+    UFUNCTION(BlueprintCallable, Category = "Steam|Server Browser")
+    int32 FindLobbies(const FLobbySearchQuery& Query);
+
+    UFUNCTION(BlueprintCallable, Category = "Steam|Server Browser")
+    void CancelLobbySearch(int32 SearchHandle);
+
+    // Fires once per materialized page, FoundLobbies rows [FirstRow, FirstRow + NumRows) are new or updated
+    UPROPERTY(BlueprintAssignable, Category = "Steam|Server Browser")
+    FOnLobbySearchPage OnLobbySearchPage;
+
+    //////////////////////////////////////////////
+    // 7. Diagnostics                          //
+    ////////////////////////////////////////////
+    // Request -> callback times, always empty in Shipping
+    UFUNCTION(BlueprintCallable, Category = "Steam|Diagnostics")
+    FSteamOperationLatency GetOperationLatency(ESteamOperation Operation) const;
+
+    // Ping, throughput and queue depth of every Steam socket connection in the current world
+    UFUNCTION(BlueprintCallable, Category = "Steam|Diagnostics")
+    TArray<FSteamConnectionStats> GetNetConnectionStats() const;
+
+    //////////////////////////////////////////////
+    // 8. Async Requests                       //
+    ////////////////////////////////////////////
+    // Each request waits on its own call result, so they can be pipelined freely.
+    // OutCall (optional) is the handle CancelSteamCall takes, TimeoutSeconds <= 0 waits forever.
+    TFuture<TSteamAsyncResult<FSteamLobbyId>> CreateLobbyAsync(ELobbyType LobbyType, int32 MaxMembers, float TimeoutSeconds = 10.f, SteamAPICall_t* OutCall = nullptr);
+
+    // Rows are read when the result lands and returned as-is, FoundLobbies and the server browser are untouched
+    TFuture<TSteamAsyncResult<TArray<FLobbyInfoData>>> FindLobbiesAsync(const FLobbySearchQuery& Query, float TimeoutSeconds = 10.f, SteamAPICall_t* OutCall = nullptr);
+
+    // Travel still happens through OnLobbyEntered, cancelling only stops waiting and does not undo a join
+    TFuture<TSteamAsyncResult<FSteamLobbyId>> JoinLobbyAsync(FSteamLobbyId LobbyID, float TimeoutSeconds = 10.f, SteamAPICall_t* OutCall = nullptr);
+
+    // Resolves the request as Cancelled, false when it already finished
+    bool CancelSteamCall(SteamAPICall_t Call);
+
+    // Searches, then races joins against the best candidates. The first lobby entered wins and travels
+    // like JoinLobby, the other joins are left as they land. A new quick match cancels the running one.
+    TFuture<TSteamAsyncResult<FSteamLobbyId>> QuickMatchAsync(const FSteamQuickMatchSettings& Settings);
+
+    UFUNCTION(BlueprintCallable, Category = "Steam|Quick Match")
+    void CancelQuickMatch();
+
+    UFUNCTION(BlueprintPure, Category = "Steam|Quick Match")
+    bool IsQuickMatching() const;
+
+    //////////////////////////////////////////////
+    // 9. Lobby Roster                         //
+    ////////////////////////////////////////////
+    // Members of the current lobby, kept up to date from callbacks without walking the lobby again
+    UFUNCTION(BlueprintPure, Category = "Steam|Lobby Roster")
+    TArray<FSteamLobbyMember> GetLobbyRoster() const;
+
+    // Only the local member's data can be set (Steam rule), everyone sees it through OnLobbyMemberDataChanged
+    UFUNCTION(BlueprintCallable, Category = "Steam|Lobby Roster")
+    void SetLobbyMemberData(const FString& Key, const FString& Value);
+
+    UFUNCTION(BlueprintCallable, Category = "Steam|Lobby Roster")
+    void SetLobbyReady(bool bReady);
+
+    UFUNCTION(BlueprintPure, Category = "Steam|Lobby Roster")
+    bool AreAllLobbyMembersReady() const;
+
+    // Member keys the roster reads (Steam cannot list them), Ready is always watched
+    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Steam|Lobby Roster")
+    TArray<FString> LobbyMemberDataKeys;
+
+    UPROPERTY(BlueprintAssignable, Category = "Steam|Lobby Roster")
+    FOnLobbyMemberEvent OnLobbyMemberJoined;
+
+    UPROPERTY(BlueprintAssignable, Category = "Steam|Lobby Roster")
+    FOnLobbyMemberEvent OnLobbyMemberLeft;
+
+    // ChangedKeys holds watched keys, or "PlayerName" when the persona name came in or changed
+    UPROPERTY(BlueprintAssignable, Category = "Steam|Lobby Roster")
+    FOnLobbyMemberDataChanged OnLobbyMemberDataChanged;
+
+    // The whole roster was replaced (lobby entered or left), re-read it with GetLobbyRoster
+    UPROPERTY(BlueprintAssignable, Category = "Steam|Lobby Roster")
+    FOnLobbyRosterRebuilt OnLobbyRosterRebuilt;
+
+    // Read-only roster for C++ callers that should not copy it (voice reads it every tick)
+    const FSteamLobbyRoster& GetLobbyRosterView() const { return LobbyRoster; }
+
+    // Voice chat with the lobby through USteamVoiceSubsystem, started and stopped with the roster
+    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Steam|Voice")
+    bool bEnableLobbyVoice;
+
+    // Text, ready pings and emotes with the lobby through USteamLobbyChatSubsystem, started and stopped with the roster
+    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Steam|Lobby Chat")
+    bool bEnableLobbyChat;
+
+    //////////////////////////////////////////////
+    // 10. Friends                             //
+    ////////////////////////////////////////////
+    // Re-reads the whole friends list, USteamInitSubsystem already does it once during startup prewarm
+    UFUNCTION(BlueprintCallable, Category = "Steam|Friends")
+    void RefreshFriends();
+
+    void RebuildFriendsCache(const TArray<uint64>& FriendIDs);
+
+    // Filtered and sorted from the cache. Allocates a new array and a name per friend on every call,
+    // C++ callers that query every frame use QueryFriends or GetFriendsCache().Query rows instead
+    UFUNCTION(BlueprintCallable, Category = "Steam|Friends")
+    TArray<FSteamFriendInfo> GetFriends(const FSteamFriendsQuery& Query);
+
+    // Same result into a caller-owned array, OutFriends and its names keep their capacity between calls
+    void QueryFriends(const FSteamFriendsQuery& Query, TArray<FSteamFriendInfo>& OutFriends);
+
+    const FSteamFriendsCache& GetFriendsCache() const { return FriendsCache; }
+
+    // Straight into the lobby the friend publishes through rich presence, no lobby search.
+    // False when the friend is not in a lobby we know of
+    UFUNCTION(BlueprintCallable, Category = "Steam|Friends")
+    bool JoinFriend(const FSteamFriendInfo& Friend);
+
+    // Publish the lobby we are in as rich presence, so friends can join through JoinFriend or the overlay
+    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Steam|Friends")
+    bool bPublishLobbyPresence;
+
+    // Name, online state or joinable lobby changed
+    UPROPERTY(BlueprintAssignable, Category = "Steam|Friends")
+    FOnFriendUpdated OnFriendUpdated;
+
+    // Whole list re-read, or a friend was added or removed
+    UPROPERTY(BlueprintAssignable, Category = "Steam|Friends")
+    FOnFriendsRebuilt OnFriendsRebuilt;
+
+    //////////////////////////////////////////////
+    // 11. Stats                               //
+    ////////////////////////////////////////////
+    // Stats, achievements and leaderboards go through USteamStatsSubsystem. Seconds between its batched stores
+    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Steam|Stats", meta = (ClampMin = "5.0"))
+    float StatsFlushIntervalSeconds;
+
+    // Found and their top page cached as soon as Steam is up
+    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Steam|Stats")
+    TArray<FName> PrefetchLeaderboards;
+
+    //////////////////////////////////////////////
+    // 12. Host Migration                      //
+    ////////////////////////////////////////////
+    // When the host leaves, the next player in the session snapshot re-hosts and everyone else follows
+    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Steam|Host Migration")
+    bool bEnableHostMigration;
+
+    // Snapshot changes are published at most this often while hosting (lobby data writes are rate limited)
+    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Steam|Host Migration", meta = (ClampMin = "0.1"))
+    float SessionSnapshotIntervalSeconds;
+
+    // A migration that has not finished by then is given up, OnHostMigrationFinished(false)
+    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Steam|Host Migration", meta = (ClampMin = "1.0"))
+    float HostMigrationTimeoutSeconds;
+
+    // Host only. Match state and player slots as the game sees them, published on the next interval.
+    // Empty Slots keeps the current ones. Slots follow the roster either way: leavers drop out, joiners go last
+    UFUNCTION(BlueprintCallable, Category = "Steam|Host Migration")
+    void UpdateSessionSnapshot(const FSteamSessionSnapshot& Snapshot);
+
+    // Host: what we publish. New host after a migration: what to restore the match from
+    UFUNCTION(BlueprintPure, Category = "Steam|Host Migration")
+    FSteamSessionSnapshot GetSessionSnapshot() const { return SessionSnapshot; }
+
+    UFUNCTION(BlueprintPure, Category = "Steam|Host Migration")
+    bool IsHostMigrating() const { return MigrationSuccessor != 0; }
+
+    // NewHost may be the local player, who then re-hosts from GetSessionSnapshot
+    UPROPERTY(BlueprintAssignable, Category = "Steam|Host Migration")
+    FOnHostMigrationStarted OnHostMigrationStarted;
+
+    UPROPERTY(BlueprintAssignable, Category = "Steam|Host Migration")
+    FOnHostMigrationFinished OnHostMigrationFinished;
+
+protected:
+    STEAM_CALLBACK(USteamMultiplayer, OnLobbyDataUpdated, LobbyDataUpdate_t);
+    STEAM_CALLBACK(USteamMultiplayer, OnLobbyChatUpdated, LobbyChatUpdate_t);
+    STEAM_CALLBACK(USteamMultiplayer, OnFriendRichPresenceUpdated, FriendRichPresenceUpdate_t);
+
+    // Matched to our own requests by call handle, not STEAM_CALLBACKs
+    void OnLobbyCreated(const TSteamAsyncResult<FSteamLobbyId>& Result);
+    void OnLobbyListReceived(LobbyMatchList_t* pCallback, const FSteamLobbyListSnapshot& Snapshot);
+
+    // Host migration travel: the new host reopens the snapshot map as a listen server, clients connect to it.
+    // False if it cannot start. Without a world (fake backend runs) override it and call NotifyMigrationMapLoaded
+    virtual bool TravelForHostMigration(bool bAsNewHost);
+    void NotifyMigrationMapLoaded();
+
 private:
     //////////////////////////////////////////////
     // 1. Private Data Members                 //
     ////////////////////////////////////////////
+    mutable TSharedPtr<ISteamBackend, ESPMode::ThreadSafe> SteamBackend; // Created on first use
+    FTSTicker::FDelegateHandle BackendTicker;
+    TArray<FSteamCallbackRouter::FHandle> RoutedHandles; // Ours only, subsystems bind to the same router
+    void BindRoutedCallbacks();
+    static void PrepareLobbyEntered(ISteamBackend& Steam, class FSteamMapPackageCache* MapCache, const LobbyEnter_t& Callback, FSteamLobbyEnterInfo& OutInfo);
+    void HandleLobbyEntered(LobbyEnter_t* pCallback, const FSteamLobbyEnterInfo& Info);
+    bool TravelToLobbyHost(uint64 HostSteamID, const FString& MapName, bool bMapExists);
+    void PublishLobbyMetadata(CSteamID LobbyID);
+    void RegisterSteamSocketsNetDriver();
+    void BindCallResultPreparers();
+    static void PrepareLobbyList(ISteamBackend& Steam, const FSteamPingLocationCache& PingLocations, const LobbyMatchList_t& Callback, FSteamLobbyListSnapshot& OutSnapshot);
+
+    TSharedPtr<FSteamPingLocationCache, ESPMode::ThreadSafe> PingLocations; // Shared with the lobby list preparer
+    FTSTicker::FDelegateHandle PingPublishTicker;
+    bool PublishPingLocation();
+
+    TUniquePtr<FSteamAsyncCalls> AsyncCalls; // Created on first request, gone before the backend
+    FSteamAsyncCalls& GetAsyncCalls();
+
+    TSharedPtr<class FSteamQuickMatch> QuickMatch; // Kept after it finishes, to leave joins that land late
+
     bool bIsHost;          // Is the player hosting the game?
-    FString LobbyIDString; // Current Lobby ID as string
+    FSteamLobbyId CurrentLobbyId; // Lobby we created or joined
     UTexture2D* GetAvatarTexture(int AvatarHandle);
+    static bool ReadAvatarRGBA(ISteamBackend& Steam, int AvatarHandle, uint32& OutWidth, uint32& OutHeight, TArray<uint8>& OutRGBA);
+    class USteamAvatarAtlasSubsystem* GetAvatarAtlas() const;
+    class USteamMapPreloadSubsystem* GetMapPreload() const;
+    class USteamVoiceSubsystem* GetVoice() const;
+    class USteamLobbyChatSubsystem* GetLobbyChat() const;
+    bool DoesMapExist(const FString& MapName) const;
+
+    //////////////////////////////////////////////
+    // 2. Avatar Cache Internals               //
+    ////////////////////////////////////////////
+    UPROPERTY()
+    TMap<uint64, FSteamAvatarCacheEntry> AvatarCache; // Keyed by member SteamID, validated against avatar handle
+
+    FAvatarCacheStats AvatarCacheStats;
+    uint64 AvatarCacheClock; // Bumped on every lookup, used for LRU ordering
+
+    UTexture2D* FindOrCreateAvatarTexture(CSteamID MemberID, int AvatarHandle);
+    UTexture2D* FindCachedAvatar(uint64 SteamID, int AvatarHandle);
+    void CacheAvatar(uint64 SteamID, int AvatarHandle, UTexture2D* AvatarTexture, TSharedPtr<const TArray<uint8>, ESPMode::ThreadSafe> Pixels = nullptr);
+    void InvalidateAvatar(uint64 SteamID);
+    void EvictAvatarsOverBudget(uint64 KeepSteamID);
+
+    //////////////////////////////////////////////
+    // 3. Async Avatar Pipeline Internals      //
+    ////////////////////////////////////////////
+    TSet<uint64> AvatarsInFlight;         // Members with a decode job already queued
+    TArray<float> AvatarPipelineSamples;  // Ring of request -> delivered timings in ms
+    int32 AvatarPipelineSampleCursor;
+
+    void LaunchAvatarDecodes(TArray<FSteamAvatarDecodeJob>&& Jobs, double StartTime);
+    void UploadDecodedAvatars(TArray<FSteamAvatarDecodeJob>&& Jobs, double StartTime);
+    static void EnqueueAvatarUploads(TArray<FSteamAvatarUpload>&& Uploads);
+    void RecordAvatarPipelineSample(float Ms);
+
+    //////////////////////////////////////////////
+    // 4. Lobby Index Internals                //
+    ////////////////////////////////////////////
+    struct FLobbyIndexEntry
+    {
+        int32 FoundIndex = INDEX_NONE; // Row in FoundLobbies
+        uint32 Generation = 0;         // Last lobby list result this lobby appeared in
+        bool bDataDirty = false;       // LobbyDataUpdate_t fired since the last read
+    };
+    TMap<FSteamLobbyId, FLobbyIndexEntry> LobbyIndex;
+    uint32 LobbyListGeneration;
+
+    void ReadLobbyInfo(CSteamID LobbyID, FLobbyInfoData& OutLobbyInfo) const;
+
+    //////////////////////////////////////////////
+    // 5. Server Browser Internals             //
+    ////////////////////////////////////////////
+    int32 NextSearchHandle;
+    int32 ActiveSearchHandle;        // 0 when no search is running or it was cancelled
+    int32 ActiveSearchPageSize;
+    SteamAPICall_t ActiveSearchCall; // Lobby list request the running search waits on
+    int32 ActiveSearchMaxPingMs;
+    bool bActiveSearchSortByPing;
+    TArray<CSteamID> PendingLobbyRows; // Result set still waiting to be materialized
+    TArray<int32> PendingLobbyPings;   // Estimated ping per pending row
+    int32 PendingLobbyCursor;
+    FTSTicker::FDelegateHandle LobbyPageTicker;
+
+    bool TickLobbySearchPages(float DeltaTime);
+    void StopLobbySearchPaging();
+    bool SortFoundLobbiesByPing();
+    static void PushLobbySearchFilters(ISteamBackend& Steam, const FLobbySearchQuery& Query);
+
+    //////////////////////////////////////////////
+    // 6. Diagnostics Internals                //
+    ////////////////////////////////////////////
+#if STEAM_MULTIPLAYER_INSTRUMENTATION
+    FSteamLatencyHistogram OperationLatency[(int32)ESteamOperation::Count];
+#endif
+
+    // Begin returns the start stamp its request carries to EndOperation, so overlapping requests each keep their own clock
+    double BeginOperation(ESteamOperation Operation) const;
+    void EndOperation(ESteamOperation Operation, double StartTime);
+    void UpdateAvatarCacheStats();
+
+    //////////////////////////////////////////////
+    // 7. Lobby Roster Internals               //
+    ////////////////////////////////////////////
+    FSteamLobbyRoster LobbyRoster;
+
+    // Full scan of LobbyID (invalid empties the roster), then OnLobbyRosterRebuilt
+    void RebuildLobbyRoster(FSteamLobbyId LobbyID);
+
+    //////////////////////////////////////////////
+    // 8. Friends Internals                    //
+    ////////////////////////////////////////////
+    FSteamFriendsCache FriendsCache;
+    FString LocalPersonaName;      // Kept current from PersonaStateChange_t
+    TArray<int32> FriendQueryRows; // Reused by GetFriends
+
+    void PublishLobbyPresence(FSteamLobbyId LobbyID);
+
+    //////////////////////////////////////////////
+    // 9. Host Migration Internals             //
+    ////////////////////////////////////////////
+    FSteamSessionSnapshot SessionSnapshot;
+    bool bSessionSnapshotDirty;
+    uint64 SessionHostSteamID;     // Who we play on, 0 outside a lobby
+    FTSTicker::FDelegateHandle SessionSnapshotTicker;
+
+    uint64 MigrationSuccessor;     // 0 unless a migration is running
+    float MigrationTimeLeft;
+    double MigrationStartTime;     // BeginOperation stamp of the running migration
+    bool bMigrationTravelled;      // Client: on its way to the new host
+    bool bMigrationMapLoaded;      // Listening (new host) or connected (client)
+    FTSTicker::FDelegateHandle MigrationTicker;
+    FDelegateHandle MigrationMapLoadedHandle;
+
+    void StartSessionSnapshots();
+    void StopSessionSnapshots();
+    bool TickSessionSnapshot(float DeltaTime);
+    bool PublishSessionSnapshot();
+    void BeginHostMigration(uint64 OldHostSteamID);
+    void UpdateHostMigration();
+    bool TickHostMigration(float DeltaTime);
+    void OnMigrationMapLoaded(UWorld* World);
+    void FinishHostMigration(bool bSuccess);
+    void ResetHostMigration();
+    static uint64 ChooseMigrationSuccessor(const FSteamSessionSnapshot& Snapshot, const FSteamLobbyRoster& Roster, uint64 OldHostSteamID);
 };
 ///////////////////////////////////////////
 // MORE COMING SOON  // A.S. - hajddeen //
@@ -0,0 +1,141 @@
+// |------------------------------------|
+// |  !FOLLOW URBAN SHADOWS ON SOCIALS! |
+// |------------------------------------|
+//            \ (^ᴗ^) /
+//             \     /
+//              -----
+//              |   |
+//              |   |
+//              |_  |_
+////////////////////////////////////////////////////////////
+// STEAM P2P SESSIONS - Unreal 5.5 + Steamworks SDK 1.57 //
+//////////////////////////////////////////////////////////////////
+// LICENSE AGREEMENT // LICENSE AGREEMENT // LICENSE AGREEMENT //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                                                                                                                                                                                                                                          //
+// Last Updated: 03/12/2024                                                                                                                                                                                                                                //
+//                                                                                                                                                                                                                                                        //
+// 1. Grant of License                                                                                                                                                                                                                                   //
+// This license permits anyone to use, modify, and distribute the provided code (the "Code") in projects free of charge under the following conditions:                                                                                                 //
+// 1.1. The Code must only be used for lawful purposes.                                                                                                                                                                                                //
+// 1.2. The user must include proper credit in their project as described in Section 3 below.                                                                                                                                                         //
+//                                                                                                                                                                                                                                                   //
+// 2. Restrictions                                                                                                                                                                                                                                  //
+// 2.1. This Code cannot be sold, sublicensed, or redistributed as a standalone product or as part of a similar development toolkit.                                                                                                               //
+// 2.2. The Code must not be used for projects that violate local laws or promote harmful, discriminatory, or illegal activities.                                                                                                                 //
+// 2.3. The user must not remove, alter, or obscure this license agreement, attribution requirements, or copyright notices within the Code.                                                                                                      //
+//                                                                                                                                                                                                                                              //
+// 3. Attribution                                                                                                                                                                                                                              //
+// 3.1. The user must include the following credit in a visible location within their project (e.g., splash screen, credits screen, or documentation):                                                                                        //
+// "Steam Multiplayer Code developed by Adrian Szajewski. Used under license."                                                                                                                                                               //
+// 3.2. For distributed or published projects, a link to https://adrianszajewskidev.wordpress.com/ or other contact details must also be included if applicable.                                                                            //
+//                                                                                                                                                                                                                                         //
+// 4. Breach of Agreement                                                                                                                                                                                                                 //
+// 4.1. If this license is violated, the licensor reserves the right to revoke the user's rights to use the Code immediately.                                                                                                            //
+// 4.2. The licensor may take legal action to recover damages or enforce compliance, depending on the severity of the violation.                                                                                                        //
+// 4.3. Users found in breach of this license may be required to:                                                                                                                                                                      //
+// Remove the Code from their project(s).                                                                                                                                                                                             //
+// Cease distribution of any projects using the Code.                                                                                                                                                                                //
+//                                                                                                                                                                                                                                  //
+// 5. Disclaimer                                                                                                                                                                                                                   //
+// 5.1. The Code is provided "as is" without any warranty, express or implied. The licensor is not liable for any damages arising from the use or misuse of the Code.                                                             //
+// 5.2. It is the user's responsibility to ensure compatibility and safe usage of the Code in their projects.                                                                                                                    //
+//                                                                                                                                                                                                                              //
+// 6. Governing Law                                                                                                                                                                                                            //
+// This agreement shall be governed and construed in accordance with the laws of Poland. Any disputes arising under or in connection with this license will be subject to the exclusive jurisdiction of the courts of Poland. //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////
+// INCLUDE //
+////////////
+#include "SteamMultiplayerStats.h"
+
+DEFINE_LOG_CATEGORY(LogSteamMultiplayer);
+
+DEFINE_STAT(STAT_SteamInitialize);
+DEFINE_STAT(STAT_SteamInitPrewarm);
+DEFINE_STAT(STAT_SteamOnLobbyCreated);
+DEFINE_STAT(STAT_SteamOnLobbyEntered);
+DEFINE_STAT(STAT_SteamOnLobbyListReceived);
+DEFINE_STAT(STAT_SteamOnLobbyDataUpdated);
+DEFINE_STAT(STAT_SteamOnAvatarImageLoaded);
+DEFINE_STAT(STAT_SteamOnPersonaStateChanged);
+DEFINE_STAT(STAT_SteamOnLobbyChatUpdated);
+DEFINE_STAT(STAT_SteamLobbyRosterRebuild);
+DEFINE_STAT(STAT_SteamOnFriendRichPresence);
+DEFINE_STAT(STAT_SteamFriendsRebuild);
+DEFINE_STAT(STAT_SteamFriendsQuery);
+DEFINE_STAT(STAT_SteamLobbyListPage);
+DEFINE_STAT(STAT_SteamLobbyMembers);
+DEFINE_STAT(STAT_SteamAvatarUpload);
+DEFINE_STAT(STAT_SteamAvatarUploadBatch);
+DEFINE_STAT(STAT_SteamAvatarAtlasFlush);
+DEFINE_STAT(STAT_SteamVoiceTick);
+DEFINE_STAT(STAT_SteamVoiceMix);
+DEFINE_STAT(STAT_SteamStatsFlush);
+DEFINE_STAT(STAT_SteamLeaderboardPage);
+DEFINE_STAT(STAT_SteamLobbyChatReceive);
+DEFINE_STAT(STAT_SteamSessionSnapshotPublish);
+
+DEFINE_STAT(STAT_SteamFoundLobbies);
+DEFINE_STAT(STAT_SteamLobbyRosterMembers);
+DEFINE_STAT(STAT_SteamFriends);
+DEFINE_STAT(STAT_SteamAvatarsInFlight);
+DEFINE_STAT(STAT_SteamAvatarCacheEntries);
+DEFINE_STAT(STAT_SteamVoiceDroppedFrames);
+DEFINE_STAT(STAT_SteamStatsPendingWrites);
+DEFINE_STAT(STAT_SteamStatsStores);
+DEFINE_STAT(STAT_SteamLeaderboardPages);
+DEFINE_STAT(STAT_SteamLobbyChatRate);
+DEFINE_STAT(STAT_SteamLobbyChatDropped);
+DEFINE_STAT(STAT_SteamAvatarCacheMemory);
+DEFINE_STAT(STAT_SteamAvatarAtlasMemory);
+
+DEFINE_STAT(STAT_SteamStartupTime);
+DEFINE_STAT(STAT_SteamCreateLobbyLatency);
+DEFINE_STAT(STAT_SteamRequestLobbyListLatency);
+DEFINE_STAT(STAT_SteamJoinLobbyLatency);
+DEFINE_STAT(STAT_SteamQuickMatchLatency);
+DEFINE_STAT(STAT_SteamHostMigrationTime);
+
+#if STEAM_MULTIPLAYER_INSTRUMENTATION && UE_TRACE_ENABLED
+UE_TRACE_CHANNEL_DEFINE(SteamMultiplayerChannel);
+#endif
+/////////////////////////
+// Latency Histogram  //
+////////////////////////////////////////
+// 1 - Record a sample                //
+// 2 - Read a percentile             //
+/////////////////////////////////////
+// - 1 - //
+void FSteamLatencyHistogram::Record(double Ms)
+{
+    const int32 Bucket = Ms < 1.0 ? 0 : FMath::Min(1 + (int32)FMath::FloorLog2((uint32)FMath::Min(Ms, (double)MAX_uint32)), NumBuckets - 1);
+    ++Buckets[Bucket];
+    ++Count;
+    SumMs += Ms;
+    MaxMs = FMath::Max(MaxMs, Ms);
+}
+// - 2 - //
+double FSteamLatencyHistogram::GetPercentileMs(float Percentile) const
+{
+    if (Count == 0)
+    {
+        return 0.0;
+    }
+
+    const uint32 Target = FMath::Max(1u, (uint32)FMath::CeilToInt(Count * FMath::Clamp(Percentile, 0.f, 1.f)));
+    uint32 Seen = 0;
+    for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+    {
+        Seen += Buckets[Bucket];
+        if (Seen >= Target)
+        {
+            const double UpperEdge = Bucket == NumBuckets - 1 ? MaxMs : (double)(1u << Bucket);
+            return FMath::Min(UpperEdge, MaxMs);
+        }
+    }
+    return MaxMs;
+}
+///////////////////////////////////////////
+// MORE COMING SOON  // A.S. - hajddeen //
+/////////////////////////////////////////
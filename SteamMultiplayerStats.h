@@ -0,0 +1,151 @@
+// |------------------------------------|
+// |  !FOLLOW URBAN SHADOWS ON SOCIALS! |
+// |------------------------------------|
+//            \ (^ᴗ^) /
+//             \     /
+//              -----
+//              |   |
+//              |   |
+//              |_  |_ 
+////////////////////////////////////////////////////////////
+// STEAM P2P SESSIONS - Unreal 5.5 + Steamworks SDK 1.57 //
+//////////////////////////////////////////////////////////////////
+// LICENSE AGREEMENT // LICENSE AGREEMENT // LICENSE AGREEMENT //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                                                                                                                                                                                                                                          //
+// Last Updated: 03/12/2024                                                                                                                                                                                                                                //
+//                                                                                                                                                                                                                                                        //
+// 1. Grant of License                                                                                                                                                                                                                                   //
+// This license permits anyone to use, modify, and distribute the provided code (the "Code") in projects free of charge under the following conditions:                                                                                                 //
+// 1.1. The Code must only be used for lawful purposes.                                                                                                                                                                                                //
+// 1.2. The user must include proper credit in their project as described in Section 3 below.                                                                                                                                                         //
+//                                                                                                                                                                                                                                                   //
+// 2. Restrictions                                                                                                                                                                                                                                  //
+// 2.1. This Code cannot be sold, sublicensed, or redistributed as a standalone product or as part of a similar development toolkit.                                                                                                               //
+// 2.2. The Code must not be used for projects that violate local laws or promote harmful, discriminatory, or illegal activities.                                                                                                                 //
+// 2.3. The user must not remove, alter, or obscure this license agreement, attribution requirements, or copyright notices within the Code.                                                                                                      //
+//                                                                                                                                                                                                                                              //
+// 3. Attribution                                                                                                                                                                                                                              //
+// 3.1. The user must include the following credit in a visible location within their project (e.g., splash screen, credits screen, or documentation):                                                                                        //
+// "Steam Multiplayer Code developed by Adrian Szajewski. Used under license."                                                                                                                                                               //
+// 3.2. For distributed or published projects, a link to https://adrianszajewskidev.wordpress.com/ or other contact details must also be included if applicable.                                                                            //
+//                                                                                                                                                                                                                                         //
+// 4. Breach of Agreement                                                                                                                                                                                                                 //
+// 4.1. If this license is violated, the licensor reserves the right to revoke the user's rights to use the Code immediately.                                                                                                            //
+// 4.2. The licensor may take legal action to recover damages or enforce compliance, depending on the severity of the violation.                                                                                                        //
+// 4.3. Users found in breach of this license may be required to:                                                                                                                                                                      //
+// Remove the Code from their project(s).                                                                                                                                                                                             //
+// Cease distribution of any projects using the Code.                                                                                                                                                                                //
+//                                                                                                                                                                                                                                  //
+// 5. Disclaimer                                                                                                                                                                                                                   //
+// 5.1. The Code is provided "as is" without any warranty, express or implied. The licensor is not liable for any damages arising from the use or misuse of the Code.                                                             //
+// 5.2. It is the user's responsibility to ensure compatibility and safe usage of the Code in their projects.                                                                                                                    //
+//                                                                                                                                                                                                                              //
+// 6. Governing Law                                                                                                                                                                                                            //
+// This agreement shall be governed and construed in accordance with the laws of Poland. Any disputes arising under or in connection with this license will be subject to the exclusive jurisdiction of the courts of Poland. //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+/////////////////////////////////////////////////////////
+// INCLUDE //
+////////////
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+/////////////////////////////////////////////////////////////////////////////////////
+// STEAM INSTRUMENTATION - NOTES                                                   //
+/////////////////////////////////////////////////////////////////////////////////////
+// 1. "stat SteamMultiplayer" shows cycle counters, counters and memory.          //
+// 2. Insights: STATS builds trace through the cycle counters, other builds      //
+//    through the SteamMultiplayer trace channel (-trace=cpu,SteamMultiplayer). //
+// 3. Everything here compiles to nothing in Shipping.                         //
+////////////////////////////////////////////////////////////////////////////////
+#ifndef STEAM_MULTIPLAYER_INSTRUMENTATION
+    #define STEAM_MULTIPLAYER_INSTRUMENTATION !UE_BUILD_SHIPPING
+#endif
+
+URBANSHADOWS_API DECLARE_LOG_CATEGORY_EXTERN(LogSteamMultiplayer, Log, All);
+
+DECLARE_STATS_GROUP(TEXT("SteamMultiplayer"), STATGROUP_SteamMultiplayer, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("InitializeSteam"), STAT_SteamInitialize, STATGROUP_SteamMultiplayer, URBANSHADOWS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Init Prewarm"), STAT_SteamInitPrewarm, STATGROUP_SteamMultiplayer, URBANSHADOWS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("OnLobbyCreated"), STAT_SteamOnLobbyCreated, STATGROUP_SteamMultiplayer, URBANSHADOWS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("OnLobbyEntered"), STAT_SteamOnLobbyEntered, STATGROUP_SteamMultiplayer, URBANSHADOWS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("OnLobbyListReceived"), STAT_SteamOnLobbyListReceived, STATGROUP_SteamMultiplayer, URBANSHADOWS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("OnLobbyDataUpdated"), STAT_SteamOnLobbyDataUpdated, STATGROUP_SteamMultiplayer, URBANSHADOWS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("OnAvatarImageLoaded"), STAT_SteamOnAvatarImageLoaded, STATGROUP_SteamMultiplayer, URBANSHADOWS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("OnPersonaStateChanged"), STAT_SteamOnPersonaStateChanged, STATGROUP_SteamMultiplayer, URBANSHADOWS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("OnLobbyChatUpdated"), STAT_SteamOnLobbyChatUpdated, STATGROUP_SteamMultiplayer, URBANSHADOWS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Lobby Roster Rebuild"), STAT_SteamLobbyRosterRebuild, STATGROUP_SteamMultiplayer, URBANSHADOWS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("OnFriendRichPresence"), STAT_SteamOnFriendRichPresence, STATGROUP_SteamMultiplayer, URBANSHADOWS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Friends Rebuild"), STAT_SteamFriendsRebuild, STATGROUP_SteamMultiplayer, URBANSHADOWS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Friends Query"), STAT_SteamFriendsQuery, STATGROUP_SteamMultiplayer, URBANSHADOWS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Lobby List Page"), STAT_SteamLobbyListPage, STATGROUP_SteamMultiplayer, URBANSHADOWS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Lobby Members"), STAT_SteamLobbyMembers, STATGROUP_SteamMultiplayer, URBANSHADOWS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Avatar Upload"), STAT_SteamAvatarUpload, STATGROUP_SteamMultiplayer, URBANSHADOWS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Avatar Upload Batch"), STAT_SteamAvatarUploadBatch, STATGROUP_SteamMultiplayer, URBANSHADOWS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Avatar Atlas Flush"), STAT_SteamAvatarAtlasFlush, STATGROUP_SteamMultiplayer, URBANSHADOWS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Voice Tick"), STAT_SteamVoiceTick, STATGROUP_SteamMultiplayer, URBANSHADOWS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Voice Mix"), STAT_SteamVoiceMix, STATGROUP_SteamMultiplayer, URBANSHADOWS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Stats Flush"), STAT_SteamStatsFlush, STATGROUP_SteamMultiplayer, URBANSHADOWS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Leaderboard Page"), STAT_SteamLeaderboardPage, STATGROUP_SteamMultiplayer, URBANSHADOWS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Lobby Chat Receive"), STAT_SteamLobbyChatReceive, STATGROUP_SteamMultiplayer, URBANSHADOWS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Session Snapshot Publish"), STAT_SteamSessionSnapshotPublish, STATGROUP_SteamMultiplayer, URBANSHADOWS_API);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Found Lobbies"), STAT_SteamFoundLobbies, STATGROUP_SteamMultiplayer, URBANSHADOWS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Lobby Roster Members"), STAT_SteamLobbyRosterMembers, STATGROUP_SteamMultiplayer, URBANSHADOWS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Friends"), STAT_SteamFriends, STATGROUP_SteamMultiplayer, URBANSHADOWS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Avatars In Flight"), STAT_SteamAvatarsInFlight, STATGROUP_SteamMultiplayer, URBANSHADOWS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Avatar Cache Entries"), STAT_SteamAvatarCacheEntries, STATGROUP_SteamMultiplayer, URBANSHADOWS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Voice Frames Dropped"), STAT_SteamVoiceDroppedFrames, STATGROUP_SteamMultiplayer, URBANSHADOWS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Stats Pending Writes"), STAT_SteamStatsPendingWrites, STATGROUP_SteamMultiplayer, URBANSHADOWS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Stats Stores"), STAT_SteamStatsStores, STATGROUP_SteamMultiplayer, URBANSHADOWS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Leaderboard Pages"), STAT_SteamLeaderboardPages, STATGROUP_SteamMultiplayer, URBANSHADOWS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Lobby Chat Msgs/s"), STAT_SteamLobbyChatRate, STATGROUP_SteamMultiplayer, URBANSHADOWS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Lobby Chat Dropped"), STAT_SteamLobbyChatDropped, STATGROUP_SteamMultiplayer, URBANSHADOWS_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Avatar Cache"), STAT_SteamAvatarCacheMemory, STATGROUP_SteamMultiplayer, URBANSHADOWS_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Avatar Atlas"), STAT_SteamAvatarAtlasMemory, STATGROUP_SteamMultiplayer, URBANSHADOWS_API);
+
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("Steam Startup (ms)"), STAT_SteamStartupTime, STATGROUP_SteamMultiplayer, URBANSHADOWS_API);
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("CreateLobby Latency (ms)"), STAT_SteamCreateLobbyLatency, STATGROUP_SteamMultiplayer, URBANSHADOWS_API);
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("RequestLobbyList Latency (ms)"), STAT_SteamRequestLobbyListLatency, STATGROUP_SteamMultiplayer, URBANSHADOWS_API);
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("JoinLobby Latency (ms)"), STAT_SteamJoinLobbyLatency, STATGROUP_SteamMultiplayer, URBANSHADOWS_API);
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("Quick Match Time (ms)"), STAT_SteamQuickMatchLatency, STATGROUP_SteamMultiplayer, URBANSHADOWS_API);
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("Host Migration Time (ms)"), STAT_SteamHostMigrationTime, STATGROUP_SteamMultiplayer, URBANSHADOWS_API);
+
+#if STEAM_MULTIPLAYER_INSTRUMENTATION && UE_TRACE_ENABLED
+UE_TRACE_CHANNEL_EXTERN(SteamMultiplayerChannel, URBANSHADOWS_API);
+#endif
+
+// Cycle counter + Insights scope for one function, named after its stat
+#if STEAM_MULTIPLAYER_INSTRUMENTATION && STATS
+    #define STEAM_MP_SCOPE(StatName) SCOPE_CYCLE_COUNTER(StatName)
+#elif STEAM_MULTIPLAYER_INSTRUMENTATION && UE_TRACE_ENABLED
+    #define STEAM_MP_SCOPE(StatName) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(StatName, SteamMultiplayerChannel)
+#else
+    #define STEAM_MP_SCOPE(StatName)
+#endif
+
+///////////////////////////////////////////////////
+// REQUEST -> CALLBACK LATENCY, LOG2 MS BUCKETS  //
+///////////////////////////////////////////////////
+// [0,1) [1,2) [2,4) ... [4096,inf) ms, fixed size so recording never allocates
+struct URBANSHADOWS_API FSteamLatencyHistogram
+{
+    static constexpr int32 NumBuckets = 14;
+
+    uint32 Buckets[NumBuckets] = {};
+    uint32 Count = 0;
+    double SumMs = 0.0;
+    double MaxMs = 0.0;
+
+    void Record(double Ms);
+
+    // Upper edge of the bucket holding the percentile, clamped to the largest sample
+    double GetPercentileMs(float Percentile) const;
+};
+///////////////////////////////////////////
+// MORE COMING SOON  // A.S. - hajddeen //
+/////////////////////////////////////////
@@ -0,0 +1,125 @@
+// |------------------------------------|
+// |  !FOLLOW URBAN SHADOWS ON SOCIALS! |
+// |------------------------------------|
+//            \ (^ᴗ^) /
+//             \     /
+//              -----
+//              |   |
+//              |   |
+//              |_  |_
+////////////////////////////////////////////////////////////
+// STEAM P2P SESSIONS - Unreal 5.5 + Steamworks SDK 1.57 //
+//////////////////////////////////////////////////////////////////
+// LICENSE AGREEMENT // LICENSE AGREEMENT // LICENSE AGREEMENT //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                                                                                                                                                                                                                                          //
+// Last Updated: 03/12/2024                                                                                                                                                                                                                                //
+//                                                                                                                                                                                                                                                        //
+// 1. Grant of License                                                                                                                                                                                                                                   //
+// This license permits anyone to use, modify, and distribute the provided code (the "Code") in projects free of charge under the following conditions:                                                                                                 //
+// 1.1. The Code must only be used for lawful purposes.                                                                                                                                                                                                //
+// 1.2. The user must include proper credit in their project as described in Section 3 below.                                                                                                                                                         //
+//                                                                                                                                                                                                                                                   //
+// 2. Restrictions                                                                                                                                                                                                                                  //
+// 2.1. This Code cannot be sold, sublicensed, or redistributed as a standalone product or as part of a similar development toolkit.                                                                                                               //
+// 2.2. The Code must not be used for projects that violate local laws or promote harmful, discriminatory, or illegal activities.                                                                                                                 //
+// 2.3. The user must not remove, alter, or obscure this license agreement, attribution requirements, or copyright notices within the Code.                                                                                                      //
+//                                                                                                                                                                                                                                              //
+// 3. Attribution                                                                                                                                                                                                                              //
+// 3.1. The user must include the following credit in a visible location within their project (e.g., splash screen, credits screen, or documentation):                                                                                        //
+// "Steam Multiplayer Code developed by Adrian Szajewski. Used under license."                                                                                                                                                               //
+// 3.2. For distributed or published projects, a link to https://adrianszajewskidev.wordpress.com/ or other contact details must also be included if applicable.                                                                            //
+//                                                                                                                                                                                                                                         //
+// 4. Breach of Agreement                                                                                                                                                                                                                 //
+// 4.1. If this license is violated, the licensor reserves the right to revoke the user's rights to use the Code immediately.                                                                                                            //
+// 4.2. The licensor may take legal action to recover damages or enforce compliance, depending on the severity of the violation.                                                                                                        //
+// 4.3. Users found in breach of this license may be required to:                                                                                                                                                                      //
+// Remove the Code from their project(s).                                                                                                                                                                                             //
+// Cease distribution of any projects using the Code.                                                                                                                                                                                //
+//                                                                                                                                                                                                                                  //
+// 5. Disclaimer                                                                                                                                                                                                                   //
+// 5.1. The Code is provided "as is" without any warranty, express or implied. The licensor is not liable for any damages arising from the use or misuse of the Code.                                                             //
+// 5.2. It is the user's responsibility to ensure compatibility and safe usage of the Code in their projects.                                                                                                                    //
+//                                                                                                                                                                                                                              //
+// 6. Governing Law                                                                                                                                                                                                            //
+// This agreement shall be governed and construed in accordance with the laws of Poland. Any disputes arising under or in connection with this license will be subject to the exclusive jurisdiction of the courts of Poland. //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////
+// INCLUDE //
+////////////
+#include "SteamPingLocation.h"
+#include "HAL/PlatformTime.h"
+/////////////////////////
+// 1. Ping Locations  //
+//////////////////////////////////////////////
+// 1.1 - Refresh the local location        //
+// 1.2 - Is the local location known      //
+// 1.3 - Estimate the ping to a host     //
+// 1.4 - Local location as lobby data   //
+/////////////////////////////////////////
+// - 1.1 - //
+bool FSteamPingLocationCache::Refresh(ISteamBackend& Steam)
+{
+    const double Now = FPlatformTime::Seconds();
+    {
+        FReadScopeLock ReadLock(Lock);
+        if (bHasLocalLocation && Now - LastRefreshTime < RefreshSeconds)
+        {
+            return true;
+        }
+    }
+
+    // Negative age = relay measurements still running, keep whatever we had
+    SteamNetworkPingLocation_t Location;
+    if (Steam.GetLocalPingLocation(Location) < 0.f)
+    {
+        return HasLocalLocation();
+    }
+    else
+    {
+        FWriteScopeLock WriteLock(Lock);
+        LocalLocation = Location;
+        bHasLocalLocation = true;
+        LastRefreshTime = Now;
+        return true;
+    }
+}
+// - 1.2 - //
+bool FSteamPingLocationCache::HasLocalLocation() const
+{
+    FReadScopeLock ReadLock(Lock);
+    return bHasLocalLocation;
+}
+// - 1.3 - //
+int32 FSteamPingLocationCache::EstimatePingTo(ISteamBackend& Steam, const char* LocationString) const
+{
+    // Older hosts publish nothing, an empty string is the common miss
+    SteamNetworkPingLocation_t HostLocation;
+    if (!LocationString || !*LocationString || !Steam.ParsePingLocationString(LocationString, HostLocation))
+    {
+        return -1;
+    }
+    else
+    {
+        FReadScopeLock ReadLock(Lock);
+        return bHasLocalLocation ? FMath::Max(Steam.EstimatePingTimeBetweenTwoLocations(LocalLocation, HostLocation), -1) : -1;
+    }
+}
+// - 1.4 - //
+bool FSteamPingLocationCache::GetLocalLocationString(ISteamBackend& Steam, TArray<ANSICHAR>& OutString) const
+{
+    FReadScopeLock ReadLock(Lock);
+    if (!bHasLocalLocation)
+    {
+        return false;
+    }
+    else
+    {
+        OutString.SetNumZeroed(k_cchMaxSteamNetworkingPingLocationString);
+        Steam.ConvertPingLocationToString(LocalLocation, OutString.GetData(), OutString.Num());
+        return OutString[0] != '\0';
+    }
+}
+///////////////////////////////////////////
+// MORE COMING SOON  // A.S. - hajddeen //
+/////////////////////////////////////////
@@ -0,0 +1,364 @@
+// |------------------------------------|
+// |  !FOLLOW URBAN SHADOWS ON SOCIALS! |
+// |------------------------------------|
+//            \ (^ᴗ^) /
+//             \     /
+//              -----
+//              |   |
+//              |   |
+//              |_  |_
+////////////////////////////////////////////////////////////
+// STEAM P2P SESSIONS - Unreal 5.5 + Steamworks SDK 1.57 //
+//////////////////////////////////////////////////////////////////
+// LICENSE AGREEMENT // LICENSE AGREEMENT // LICENSE AGREEMENT //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                                                                                                                                                                                                                                          //
+// Last Updated: 03/12/2024                                                                                                                                                                                                                                //
+//                                                                                                                                                                                                                                                        //
+// 1. Grant of License                                                                                                                                                                                                                                   //
+// This license permits anyone to use, modify, and distribute the provided code (the "Code") in projects free of charge under the following conditions:                                                                                                 //
+// 1.1. The Code must only be used for lawful purposes.                                                                                                                                                                                                //
+// 1.2. The user must include proper credit in their project as described in Section 3 below.                                                                                                                                                         //
+//                                                                                                                                                                                                                                                   //
+// 2. Restrictions                                                                                                                                                                                                                                  //
+// 2.1. This Code cannot be sold, sublicensed, or redistributed as a standalone product or as part of a similar development toolkit.                                                                                                               //
+// 2.2. The Code must not be used for projects that violate local laws or promote harmful, discriminatory, or illegal activities.                                                                                                                 //
+// 2.3. The user must not remove, alter, or obscure this license agreement, attribution requirements, or copyright notices within the Code.                                                                                                      //
+//                                                                                                                                                                                                                                              //
+// 3. Attribution                                                                                                                                                                                                                              //
+// 3.1. The user must include the following credit in a visible location within their project (e.g., splash screen, credits screen, or documentation):                                                                                        //
+// "Steam Multiplayer Code developed by Adrian Szajewski. Used under license."                                                                                                                                                               //
+// 3.2. For distributed or published projects, a link to https://adrianszajewskidev.wordpress.com/ or other contact details must also be included if applicable.                                                                            //
+//                                                                                                                                                                                                                                         //
+// 4. Breach of Agreement                                                                                                                                                                                                                 //
+// 4.1. If this license is violated, the licensor reserves the right to revoke the user's rights to use the Code immediately.                                                                                                            //
+// 4.2. The licensor may take legal action to recover damages or enforce compliance, depending on the severity of the violation.                                                                                                        //
+// 4.3. Users found in breach of this license may be required to:                                                                                                                                                                      //
+// Remove the Code from their project(s).                                                                                                                                                                                             //
+// Cease distribution of any projects using the Code.                                                                                                                                                                                //
+//                                                                                                                                                                                                                                  //
+// 5. Disclaimer                                                                                                                                                                                                                   //
+// 5.1. The Code is provided "as is" without any warranty, express or implied. The licensor is not liable for any damages arising from the use or misuse of the Code.                                                             //
+// 5.2. It is the user's responsibility to ensure compatibility and safe usage of the Code in their projects.                                                                                                                    //
+//                                                                                                                                                                                                                              //
+// 6. Governing Law                                                                                                                                                                                                            //
+// This agreement shall be governed and construed in accordance with the laws of Poland. Any disputes arising under or in connection with this license will be subject to the exclusive jurisdiction of the courts of Poland. //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////
+// INCLUDE //
+////////////
+#include "SteamQuickMatch.h"
+#include "Algo/StableSort.h"
+//////////////////////////
+// Constructor - Notes //
+////////////////////////////////////////////////////////
+// 1. Nothing is sent until Start() is called.        //
+//////////////////////////////////////////////////////
+FSteamQuickMatch::FSteamQuickMatch(USteamMultiplayer& InOwner, const FSteamQuickMatchSettings& InSettings)
+    : Owner(&InOwner), Settings(InSettings)
+{
+}
+
+FSteamQuickMatch::~FSteamQuickMatch()
+{
+    RemoveTickers();
+    if (bRunning)
+    {
+        // Owner may already be going away, only the promise is settled here
+        bRunning = false;
+        Promise.SetValue(TSteamAsyncResult<FSteamLobbyId>(ESteamAsyncStatus::Cancelled));
+    }
+}
+/////////////////////////
+// 1. Match Flow      //
+//////////////////////////////////////////
+// 1.1 - Start searching                //
+// 1.2 - Search landed, rank it        //
+// 1.3 - Send the next join           //
+// 1.4 - Stagger the joins           //
+// 1.5 - A join answered            //
+// 1.6 - Keep or leave an entry    //
+// 1.7 - Settle the match         //
+// 1.8 - Cancel                  //
+//////////////////////////////////
+// - 1.1 - //
+TFuture<TSteamAsyncResult<FSteamLobbyId>> FSteamQuickMatch::Start()
+{
+    TFuture<TSteamAsyncResult<FSteamLobbyId>> Future = Promise.GetFuture();
+    USteamMultiplayer* Instance = Owner.Get();
+    bRunning = true;
+    if (!Instance)
+    {
+        Finish(ESteamAsyncStatus::Failed);
+        return Future;
+    }
+
+    if (Settings.DeadlineSeconds > 0.f)
+    {
+        DeadlineTicker = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateSPLambda(this, [this](float DeltaTime)
+        {
+            // Returning false removes this ticker, RemoveTickers must not remove it again
+            DeadlineTicker.Reset();
+            Finish(ESteamAsyncStatus::TimedOut);
+            return false;
+        }), Settings.DeadlineSeconds);
+    }
+
+    FLobbySearchQuery Query = Settings.Query;
+    Query.MinOpenSlots = FMath::Max(Query.MinOpenSlots, 1);
+
+    TWeakPtr<FSteamQuickMatch> WeakThis = AsShared();
+    Instance->FindLobbiesAsync(Query, Settings.DeadlineSeconds, &SearchCall).Next([WeakThis](TSteamAsyncResult<TArray<FLobbyInfoData>> Result)
+    {
+        if (TSharedPtr<FSteamQuickMatch> This = WeakThis.Pin())
+        {
+            This->OnSearchDone(Result);
+        }
+    });
+    return Future;
+}
+// - 1.2 - //
+void FSteamQuickMatch::OnSearchDone(const TSteamAsyncResult<TArray<FLobbyInfoData>>& Result)
+{
+    SearchCall = k_uAPICallInvalid;
+    if (!bRunning)
+    {
+        return;
+    }
+    else if (!Result.IsSuccess())
+    {
+        LastSteamResult = Result.SteamResult;
+        Finish(Result.Status);
+        return;
+    }
+
+    RankCandidates(Result.Value, Settings, Candidates);
+    UE_LOG(LogSteamMultiplayer, Log, TEXT("Quick match: %d of %d lobbies are candidates."), Candidates.Num(), Result.Value.Num());
+    if (Candidates.Num() == 0)
+    {
+        Finish(ESteamAsyncStatus::Failed);
+        return;
+    }
+
+    LaunchNextJoin();
+    if (bRunning && FMath::Max(Settings.MaxParallelJoins, 1) > 1)
+    {
+        StaggerTicker = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateSP(this, &FSteamQuickMatch::TickStagger));
+    }
+}
+// - 1.3 - //
+bool FSteamQuickMatch::LaunchNextJoin()
+{
+    USteamMultiplayer* Instance = Owner.Get();
+    if (!bRunning || !Instance || NextCandidate >= Candidates.Num() || JoinsInFlight.Num() >= FMath::Max(Settings.MaxParallelJoins, 1))
+    {
+        return false;
+    }
+    else
+    {
+        const FSteamLobbyId LobbyID = Candidates[NextCandidate++];
+        Attempted.Add(LobbyID);
+        JoinsInFlight.Add(LobbyID, k_uAPICallInvalid);
+        SinceLastLaunch = 0.f;
+
+        SteamAPICall_t Call = k_uAPICallInvalid;
+        TFuture<TSteamAsyncResult<FSteamLobbyId>> Join = Instance->JoinLobbyAsync(LobbyID, Settings.JoinTimeoutSeconds, &Call);
+        if (SteamAPICall_t* InFlight = JoinsInFlight.Find(LobbyID))
+        {
+            *InFlight = Call;
+        }
+
+        // A refused request is already fulfilled, its continuation runs right here
+        TWeakPtr<FSteamQuickMatch> WeakThis = AsShared();
+        Join.Next([WeakThis, LobbyID](TSteamAsyncResult<FSteamLobbyId> Result)
+        {
+            if (TSharedPtr<FSteamQuickMatch> This = WeakThis.Pin())
+            {
+                This->OnJoinDone(LobbyID, Result);
+            }
+        });
+        return true;
+    }
+}
+// - 1.4 - //
+bool FSteamQuickMatch::TickStagger(float DeltaTime)
+{
+    // A slow answer is the usual sign of a lobby that is filling up, hedge with the next one
+    SinceLastLaunch += DeltaTime;
+    if (bRunning && SinceLastLaunch >= Settings.StaggerSeconds)
+    {
+        LaunchNextJoin();
+    }
+    if (!bRunning || NextCandidate >= Candidates.Num())
+    {
+        StaggerTicker.Reset();
+        return false;
+    }
+    return true;
+}
+// - 1.5 - //
+void FSteamQuickMatch::OnJoinDone(FSteamLobbyId LobbyID, const TSteamAsyncResult<FSteamLobbyId>& Result)
+{
+    if (!bRunning || !JoinsInFlight.Contains(LobbyID))
+    {
+        return;
+    }
+    else if (Result.IsSuccess())
+    {
+        // Stays in flight until the LobbyEnter_t broadcast reaches AcceptEnteredLobby
+        return;
+    }
+    else
+    {
+        JoinsInFlight.Remove(LobbyID);
+        LastSteamResult = Result.SteamResult;
+        UE_LOG(LogSteamMultiplayer, Log, TEXT("Quick match: join %llu failed (%s, response %d)."), LobbyID.ToSteamID().ConvertToUint64(), *UEnum::GetValueAsString(Result.Status), Result.SteamResult);
+
+        // Failures skip the stagger, the next candidate goes out right away
+        if (!LaunchNextJoin() && JoinsInFlight.Num() == 0 && NextCandidate >= Candidates.Num())
+        {
+            Finish(ESteamAsyncStatus::Failed);
+        }
+    }
+}
+// - 1.6 - //
+bool FSteamQuickMatch::AcceptEnteredLobby(FSteamLobbyId LobbyID)
+{
+    if (!Attempted.Contains(LobbyID))
+    {
+        return !Stragglers.Contains(LobbyID);
+    }
+    else if (Winner.IsValid())
+    {
+        return Winner == LobbyID;
+    }
+    else if (!bRunning)
+    {
+        // Cancelled or out of time, even a success is left
+        return false;
+    }
+    else
+    {
+        // A join that already timed out on our side still counts, the lobby had room
+        Winner = LobbyID;
+        JoinsInFlight.Remove(LobbyID);
+        Finish(ESteamAsyncStatus::Completed);
+        return true;
+    }
+}
+// - 1.7 - //
+void FSteamQuickMatch::Finish(ESteamAsyncStatus Status)
+{
+    if (!bRunning)
+    {
+        return;
+    }
+
+    bRunning = false;
+    RemoveTickers();
+
+    // Cancelled requests resolve right away, their continuations see bRunning == false
+    USteamMultiplayer* Instance = Owner.Get();
+    TMap<FSteamLobbyId, SteamAPICall_t> Losers = MoveTemp(JoinsInFlight);
+    JoinsInFlight.Reset();
+    if (Instance)
+    {
+        if (SearchCall != k_uAPICallInvalid)
+        {
+            Instance->CancelSteamCall(SearchCall);
+            SearchCall = k_uAPICallInvalid;
+        }
+        for (const TPair<FSteamLobbyId, SteamAPICall_t>& Loser : Losers)
+        {
+            Instance->CancelSteamCall(Loser.Value);
+        }
+    }
+
+    TSteamAsyncResult<FSteamLobbyId> Result(Status);
+    Result.Value = Winner;
+    Result.SteamResult = Status == ESteamAsyncStatus::Completed ? (int32)k_EChatRoomEnterResponseSuccess : LastSteamResult;
+    UE_LOG(LogSteamMultiplayer, Log, TEXT("Quick match finished: %s, lobby %llu, %d joins sent."), *UEnum::GetValueAsString(Status), Winner.ToSteamID().ConvertToUint64(), Attempted.Num());
+    Promise.SetValue(MoveTemp(Result));
+}
+// - 1.8 - //
+void FSteamQuickMatch::Cancel()
+{
+    Finish(ESteamAsyncStatus::Cancelled);
+}
+/////////////////////////
+// 2. Helpers         //
+////////////////////////////////////////
+// 2.1 - Score and pick candidates   //
+// 2.2 - Carry over late joins      //
+// 2.3 - Stop the tickers          //
+// 2.4 - Forget a lobby           //
+///////////////////////////////////
+// - 2.1 - //
+void FSteamQuickMatch::RankCandidates(const TArray<FLobbyInfoData>& Lobbies, const FSteamQuickMatchSettings& Settings, TArray<FSteamLobbyId>& OutCandidates)
+{
+    struct FScoredLobby
+    {
+        FSteamLobbyId LobbyId;
+        int32 Score = 0; // Lower is better
+    };
+
+    TArray<FScoredLobby> Scored;
+    Scored.Reserve(Lobbies.Num());
+    for (const FLobbyInfoData& Lobby : Lobbies)
+    {
+        const int32 FreeSlots = Lobby.MaxPlayers - Lobby.CurrentPlayers;
+        if (FreeSlots > 0 && Lobby.LobbyId.IsValid())
+        {
+            const int32 Ping = Lobby.PingMs >= 0 ? Lobby.PingMs : Settings.UnknownPingMs;
+            Scored.Add({ Lobby.LobbyId, Ping - Settings.FreeSlotWeightMs * FreeSlots });
+        }
+    }
+
+    // Stable, ties keep the search order
+    Algo::StableSortBy(Scored, &FScoredLobby::Score);
+
+    const int32 NumCandidates = FMath::Min(Scored.Num(), FMath::Max(Settings.MaxCandidates, 1));
+    OutCandidates.Reset(NumCandidates);
+    for (int32 i = 0; i < NumCandidates; ++i)
+    {
+        OutCandidates.Add(Scored[i].LobbyId);
+    }
+}
+// - 2.2 - //
+void FSteamQuickMatch::InheritStragglers(const FSteamQuickMatch& Previous)
+{
+    Stragglers.Append(Previous.Stragglers);
+    for (const FSteamLobbyId& LobbyID : Previous.Attempted)
+    {
+        if (LobbyID != Previous.Winner)
+        {
+            Stragglers.Add(LobbyID);
+        }
+    }
+}
+// - 2.3 - //
+void FSteamQuickMatch::RemoveTickers()
+{
+    if (StaggerTicker.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(StaggerTicker);
+        StaggerTicker.Reset();
+    }
+    if (DeadlineTicker.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(DeadlineTicker);
+        DeadlineTicker.Reset();
+    }
+}
+// - 2.4 - //
+void FSteamQuickMatch::ReleaseLobby(FSteamLobbyId LobbyID)
+{
+    if (Winner != LobbyID)
+    {
+        Attempted.Remove(LobbyID);
+        Stragglers.Remove(LobbyID);
+    }
+}
+///////////////////////////////////////////
+// MORE COMING SOON  // A.S. - hajddeen //
+/////////////////////////////////////////
@@ -0,0 +1,118 @@
+// |------------------------------------|
+// |  !FOLLOW URBAN SHADOWS ON SOCIALS! |
+// |------------------------------------|
+//            \ (^ᴗ^) /
+//             \     /
+//              -----
+//              |   |
+//              |   |
+//              |_  |_ 
+////////////////////////////////////////////////////////////
+// STEAM P2P SESSIONS - Unreal 5.5 + Steamworks SDK 1.57 //
+//////////////////////////////////////////////////////////////////
+// LICENSE AGREEMENT // LICENSE AGREEMENT // LICENSE AGREEMENT //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                                                                                                                                                                                                                                          //
+// Last Updated: 03/12/2024                                                                                                                                                                                                                                //
+//                                                                                                                                                                                                                                                        //
+// 1. Grant of License                                                                                                                                                                                                                                   //
+// This license permits anyone to use, modify, and distribute the provided code (the "Code") in projects free of charge under the following conditions:                                                                                                 //
+// 1.1. The Code must only be used for lawful purposes.                                                                                                                                                                                                //
+// 1.2. The user must include proper credit in their project as described in Section 3 below.                                                                                                                                                         //
+//                                                                                                                                                                                                                                                   //
+// 2. Restrictions                                                                                                                                                                                                                                  //
+// 2.1. This Code cannot be sold, sublicensed, or redistributed as a standalone product or as part of a similar development toolkit.                                                                                                               //
+// 2.2. The Code must not be used for projects that violate local laws or promote harmful, discriminatory, or illegal activities.                                                                                                                 //
+// 2.3. The user must not remove, alter, or obscure this license agreement, attribution requirements, or copyright notices within the Code.                                                                                                      //
+//                                                                                                                                                                                                                                              //
+// 3. Attribution                                                                                                                                                                                                                              //
+// 3.1. The user must include the following credit in a visible location within their project (e.g., splash screen, credits screen, or documentation):                                                                                        //
+// "Steam Multiplayer Code developed by Adrian Szajewski. Used under license."                                                                                                                                                               //
+// 3.2. For distributed or published projects, a link to https://adrianszajewskidev.wordpress.com/ or other contact details must also be included if applicable.                                                                            //
+//                                                                                                                                                                                                                                         //
+// 4. Breach of Agreement                                                                                                                                                                                                                 //
+// 4.1. If this license is violated, the licensor reserves the right to revoke the user's rights to use the Code immediately.                                                                                                            //
+// 4.2. The licensor may take legal action to recover damages or enforce compliance, depending on the severity of the violation.                                                                                                        //
+// 4.3. Users found in breach of this license may be required to:                                                                                                                                                                      //
+// Remove the Code from their project(s).                                                                                                                                                                                             //
+// Cease distribution of any projects using the Code.                                                                                                                                                                                //
+//                                                                                                                                                                                                                                  //
+// 5. Disclaimer                                                                                                                                                                                                                   //
+// 5.1. The Code is provided "as is" without any warranty, express or implied. The licensor is not liable for any damages arising from the use or misuse of the Code.                                                             //
+// 5.2. It is the user's responsibility to ensure compatibility and safe usage of the Code in their projects.                                                                                                                    //
+//                                                                                                                                                                                                                              //
+// 6. Governing Law                                                                                                                                                                                                            //
+// This agreement shall be governed and construed in accordance with the laws of Poland. Any disputes arising under or in connection with this license will be subject to the exclusive jurisdiction of the courts of Poland. //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+/////////////////////////////////////////////////////////
+// INCLUDE //
+////////////
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "SteamMultiplayer.h"
+
+/////////////////////////////////////////////////////////////////////////////////////
+// STEAM QUICK MATCH - NOTES                                                       //
+/////////////////////////////////////////////////////////////////////////////////////
+// 1. One search, then candidates are scored by ping and free slots.              //
+// 2. Joins go out staggered: the next candidate starts when a join fails or      //
+//    has been unanswered for StaggerSeconds, up to MaxParallelJoins at once.    //
+// 3. The first LobbyEnter_t success wins (USteamMultiplayer asks through       //
+//    AcceptEnteredLobby), every other join is left the moment it lands,       //
+//    also after the match finished or was cancelled.                         //
+// 4. Game thread only.                                                      //
+//////////////////////////////////////////////////////////////////////////////
+class URBANSHADOWS_API FSteamQuickMatch : public TSharedFromThis<FSteamQuickMatch>
+{
+public:
+    FSteamQuickMatch(USteamMultiplayer& InOwner, const FSteamQuickMatchSettings& InSettings);
+    ~FSteamQuickMatch();
+
+    TFuture<TSteamAsyncResult<FSteamLobbyId>> Start();
+
+    // Resolves as Cancelled, joins still in flight are left once they land
+    void Cancel();
+    bool IsRunning() const { return bRunning; }
+
+    // Asked for every lobby we entered, false = a speculative join that lost and must be left
+    bool AcceptEnteredLobby(FSteamLobbyId LobbyID);
+
+    // Joins of an older match that may still land
+    void InheritStragglers(const FSteamQuickMatch& Previous);
+
+    // The player joins this lobby on purpose now, stop treating it as a loser
+    void ReleaseLobby(FSteamLobbyId LobbyID);
+
+    // Best first, full lobbies dropped, at most Settings.MaxCandidates
+    static void RankCandidates(const TArray<FLobbyInfoData>& Lobbies, const FSteamQuickMatchSettings& Settings, TArray<FSteamLobbyId>& OutCandidates);
+
+private:
+    TWeakObjectPtr<USteamMultiplayer> Owner;
+    FSteamQuickMatchSettings Settings;
+    TPromise<TSteamAsyncResult<FSteamLobbyId>> Promise;
+    bool bRunning = false;
+
+    SteamAPICall_t SearchCall = k_uAPICallInvalid;
+    TArray<FSteamLobbyId> Candidates;
+    int32 NextCandidate = 0;
+    TMap<FSteamLobbyId, SteamAPICall_t> JoinsInFlight;
+    TSet<FSteamLobbyId> Attempted;  // Every lobby a join went out to, all but the winner get left
+    TSet<FSteamLobbyId> Stragglers; // Joins of older matches, never a winner here
+    FSteamLobbyId Winner;
+    int32 LastSteamResult = 0;
+    float SinceLastLaunch = 0.f; // Ticker time, so simulated runs stagger the same way
+
+    FTSTicker::FDelegateHandle StaggerTicker;
+    FTSTicker::FDelegateHandle DeadlineTicker;
+
+    void OnSearchDone(const TSteamAsyncResult<TArray<FLobbyInfoData>>& Result);
+    bool LaunchNextJoin();
+    bool TickStagger(float DeltaTime);
+    void OnJoinDone(FSteamLobbyId LobbyID, const TSteamAsyncResult<FSteamLobbyId>& Result);
+    void Finish(ESteamAsyncStatus Status);
+    void RemoveTickers();
+};
+///////////////////////////////////////////
+// MORE COMING SOON  // A.S. - hajddeen //
+/////////////////////////////////////////
@@ -0,0 +1,600 @@
+// |------------------------------------|
+// |  !FOLLOW URBAN SHADOWS ON SOCIALS! |
+// |------------------------------------|
+//            \ (^ᴗ^) /
+//             \     /
+//              -----
+//              |   |
+//              |   |
+//              |_  |_
+////////////////////////////////////////////////////////////
+// STEAM P2P SESSIONS - Unreal 5.5 + Steamworks SDK 1.57 //
+//////////////////////////////////////////////////////////////////
+// LICENSE AGREEMENT // LICENSE AGREEMENT // LICENSE AGREEMENT //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                                                                                                                                                                                                                                          //
+// Last Updated: 03/12/2024                                                                                                                                                                                                                                //
+//                                                                                                                                                                                                                                                        //
+// 1. Grant of License                                                                                                                                                                                                                                   //
+// This license permits anyone to use, modify, and distribute the provided code (the "Code") in projects free of charge under the following conditions:                                                                                                 //
+// 1.1. The Code must only be used for lawful purposes.                                                                                                                                                                                                //
+// 1.2. The user must include proper credit in their project as described in Section 3 below.                                                                                                                                                         //
+//                                                                                                                                                                                                                                                   //
+// 2. Restrictions                                                                                                                                                                                                                                  //
+// 2.1. This Code cannot be sold, sublicensed, or redistributed as a standalone product or as part of a similar development toolkit.                                                                                                               //
+// 2.2. The Code must not be used for projects that violate local laws or promote harmful, discriminatory, or illegal activities.                                                                                                                 //
+// 2.3. The user must not remove, alter, or obscure this license agreement, attribution requirements, or copyright notices within the Code.                                                                                                      //
+//                                                                                                                                                                                                                                              //
+// 3. Attribution                                                                                                                                                                                                                              //
+// 3.1. The user must include the following credit in a visible location within their project (e.g., splash screen, credits screen, or documentation):                                                                                        //
+// "Steam Multiplayer Code developed by Adrian Szajewski. Used under license."                                                                                                                                                               //
+// 3.2. For distributed or published projects, a link to https://adrianszajewskidev.wordpress.com/ or other contact details must also be included if applicable.                                                                            //
+//                                                                                                                                                                                                                                         //
+// 4. Breach of Agreement                                                                                                                                                                                                                 //
+// 4.1. If this license is violated, the licensor reserves the right to revoke the user's rights to use the Code immediately.                                                                                                            //
+// 4.2. The licensor may take legal action to recover damages or enforce compliance, depending on the severity of the violation.                                                                                                        //
+// 4.3. Users found in breach of this license may be required to:                                                                                                                                                                      //
+// Remove the Code from their project(s).                                                                                                                                                                                             //
+// Cease distribution of any projects using the Code.                                                                                                                                                                                //
+//                                                                                                                                                                                                                                  //
+// 5. Disclaimer                                                                                                                                                                                                                   //
+// 5.1. The Code is provided "as is" without any warranty, express or implied. The licensor is not liable for any damages arising from the use or misuse of the Code.                                                             //
+// 5.2. It is the user's responsibility to ensure compatibility and safe usage of the Code in their projects.                                                                                                                    //
+//                                                                                                                                                                                                                              //
+// 6. Governing Law                                                                                                                                                                                                            //
+// This agreement shall be governed and construed in accordance with the laws of Poland. Any disputes arising under or in connection with this license will be subject to the exclusive jurisdiction of the courts of Poland. //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////
+// INCLUDE //
+////////////
+#include "SteamSocketsNetDriver.h"
+#include "SteamMultiplayerStats.h"
+#include "SteamMultiplayer.h"
+#include "Engine/Engine.h"
+#include "Net/DataChannel.h"
+#include "PacketHandler.h"
+///////////////////////////////
+// Steam Sockets - Internals //
+////////////////////////////////////////////////////////////////////
+// 1. Unreal does its own reliability, Steam only carries packets //
+// 2. One poll group for every connection of this driver         //
+//////////////////////////////////////////////////////////////////
+namespace SteamSockets
+{
+    constexpr int32 SendFlags = k_nSteamNetworkingSend_UnreliableNoNagle; // We batch per frame ourselves
+    constexpr int32 MaxReceivePerTick = 256;
+    constexpr int32 VirtualPort = 0;
+    const TCHAR* URLPrefix = TEXT("steam.");
+
+    // Backend of the running game instance, only when it delivers callbacks through its router
+    ISteamBackend* FindRoutedBackend()
+    {
+        if (GEngine)
+        {
+            for (const FWorldContext& Context : GEngine->GetWorldContexts())
+            {
+                USteamMultiplayer* GameInstance = Cast<USteamMultiplayer>(Context.OwningGameInstance);
+                ISteamBackend* Backend = GameInstance ? GameInstance->GetSteamBackend() : nullptr;
+                if (Backend && Backend->UsesCallbackRouter() && !Backend->IsFake())
+                {
+                    return Backend;
+                }
+            }
+        }
+        return nullptr;
+    }
+}
+//////////////////////////
+// Constructor - Notes //
+////////////////////////////////////////////////////////
+// 1. Nothing touches Steam until InitBase.           //
+//////////////////////////////////////////////////////
+USteamSocketsNetDriver::USteamSocketsNetDriver()
+    : MaxBatchedMessages(256), ListenSocket(k_HSteamListenSocket_Invalid), PollGroup(k_HSteamNetPollGroup_Invalid)
+    , RoutedBackend(nullptr), StatusCallbackHandle(0)
+{
+    NetConnectionClassName = TEXT("/Script/UrbanShadows.SteamSocketsNetConnection");
+}
+/////////////////////////
+// 1. Net Driver      //
+////////////////////////////////////////
+// 1.1 - Steam networking available? //
+// 1.2 - Shared init                //
+// 1.3 - Client: connect to host   //
+// 1.4 - Host: open P2P listen    //
+// 1.5 - Receive                 //
+// 1.6 - Send batched messages  //
+// 1.7 - Connectionless send   //
+// 1.8 - Local address        //
+// 1.9 - Tear down           //
+// 1.10 - Still usable?     //
+/////////////////////////////
+// - 1.1 - //
+bool USteamSocketsNetDriver::IsAvailable() const
+{
+    // Null under the fake backend, the engine then falls back to the IP driver
+    return SteamNetworkingSockets() != nullptr && SteamNetworkingUtils() != nullptr;
+}
+// - 1.2 - //
+bool USteamSocketsNetDriver::InitBase(bool bInitAsClient, FNetworkNotify* InNotify, const FURL& URL, bool bReuseAddressAndPort, FString& Error)
+{
+    if (!Super::InitBase(bInitAsClient, InNotify, URL, bReuseAddressAndPort, Error))
+    {
+        return false;
+    }
+    else if (!IsAvailable())
+    {
+        Error = TEXT("Steam networking sockets are not available.");
+        return false;
+    }
+    else
+    {
+        // Starts fetching the relay network config now, so the first connection does not wait on it
+        SteamNetworkingUtils()->InitRelayNetworkAccess();
+
+        RoutedBackend = SteamSockets::FindRoutedBackend();
+        if (RoutedBackend)
+        {
+            StatusCallbackHandle = RoutedBackend->GetCallbackRouter().Bind<SteamNetConnectionStatusChangedCallback_t>([this](SteamNetConnectionStatusChangedCallback_t* pCallback)
+            {
+                OnConnectionStatusChanged(pCallback);
+            });
+        }
+
+        PollGroup = SteamNetworkingSockets()->CreatePollGroup();
+        IncomingMessages.SetNumZeroed(SteamSockets::MaxReceivePerTick);
+        OutgoingMessages.Reserve(MaxBatchedMessages);
+        SendResults.Reserve(MaxBatchedMessages);
+        return PollGroup != k_HSteamNetPollGroup_Invalid;
+    }
+}
+// - 1.3 - //
+bool USteamSocketsNetDriver::InitConnect(FNetworkNotify* InNotify, const FURL& ConnectURL, FString& Error)
+{
+    CSteamID HostSteamID;
+    if (!ParseSteamURL(ConnectURL, HostSteamID))
+    {
+        Error = FString::Printf(TEXT("Not a Steam address: %s"), *ConnectURL.Host);
+        return false;
+    }
+    else if (!InitBase(true, InNotify, ConnectURL, false, Error))
+    {
+        return false;
+    }
+    else
+    {
+        SteamNetworkingIdentity Identity;
+        Identity.SetSteamID(HostSteamID);
+        const HSteamNetConnection Handle = SteamNetworkingSockets()->ConnectP2P(Identity, SteamSockets::VirtualPort, 0, nullptr);
+        if (Handle == k_HSteamNetConnection_Invalid)
+        {
+            Error = TEXT("ConnectP2P failed.");
+            return false;
+        }
+
+        // Packets sent while Steam is still connecting are queued by Steam
+        USteamSocketsNetConnection* Connection = NewObject<USteamSocketsNetConnection>(GetTransientPackage(), NetConnectionClass);
+        Connection->ConnectionHandle = Handle;
+        Connection->RemoteSteamID = HostSteamID;
+        Connection->InitLocalConnection(this, nullptr, ConnectURL, USOCK_Pending);
+        ServerConnection = Connection;
+        ConnectionsByHandle.Add(Handle, Connection);
+        SteamNetworkingSockets()->SetConnectionPollGroup(Handle, PollGroup);
+
+        CreateInitialClientChannels();
+        UE_LOG(LogSteamMultiplayer, Log, TEXT("Connecting over Steam sockets to %llu"), HostSteamID.ConvertToUint64());
+        return true;
+    }
+}
+// - 1.4 - //
+bool USteamSocketsNetDriver::InitListen(FNetworkNotify* InNotify, FURL& ListenURL, bool bReuseAddressAndPort, FString& Error)
+{
+    if (!InitBase(false, InNotify, ListenURL, bReuseAddressAndPort, Error))
+    {
+        return false;
+    }
+    else
+    {
+        ListenSocket = SteamNetworkingSockets()->CreateListenSocketP2P(SteamSockets::VirtualPort, 0, nullptr);
+        if (ListenSocket == k_HSteamListenSocket_Invalid)
+        {
+            Error = TEXT("CreateListenSocketP2P failed.");
+            return false;
+        }
+
+        UE_LOG(LogSteamMultiplayer, Log, TEXT("Listening over Steam sockets as %s"), *LowLevelGetNetworkNumber());
+        return true;
+    }
+}
+// - 1.5 - //
+void USteamSocketsNetDriver::TickDispatch(float DeltaTime)
+{
+    Super::TickDispatch(DeltaTime);
+
+    if (PollGroup == k_HSteamNetPollGroup_Invalid || !SteamNetworkingSockets())
+    {
+        return;
+    }
+
+    // Pull until Steam runs dry, packets are processed in place and released right after
+    int32 NumMessages = 0;
+    do
+    {
+        NumMessages = SteamNetworkingSockets()->ReceiveMessagesOnPollGroup(PollGroup, IncomingMessages.GetData(), IncomingMessages.Num());
+        for (int32 i = 0; i < NumMessages; ++i)
+        {
+            SteamNetworkingMessage_t* Message = IncomingMessages[i];
+            USteamSocketsNetConnection** Connection = ConnectionsByHandle.Find(Message->m_conn);
+            if (Connection && *Connection && Message->m_cbSize > 0)
+            {
+                (*Connection)->ReceivedRawPacket(Message->m_pData, Message->m_cbSize);
+            }
+            Message->Release();
+        }
+    }
+    while (NumMessages == IncomingMessages.Num());
+}
+// - 1.6 - //
+void USteamSocketsNetDriver::TickFlush(float DeltaSeconds)
+{
+    // Connections flush into OutgoingMessages here, then everything goes to Steam in one call
+    Super::TickFlush(DeltaSeconds);
+    FlushOutgoingMessages();
+}
+// - 1.7 - //
+void USteamSocketsNetDriver::LowLevelSend(TSharedPtr<const FInternetAddr> Address, void* Data, int32 CountBits, FOutPacketTraits& Traits)
+{
+    // Nothing is sent outside a Steam connection, there is no connectionless handshake
+}
+// - 1.8 - //
+FString USteamSocketsNetDriver::LowLevelGetNetworkNumber()
+{
+    return SteamUser() ? FString::Printf(TEXT("%s%llu"), SteamSockets::URLPrefix, SteamUser()->GetSteamID().ConvertToUint64()) : FString();
+}
+// - 1.9 - //
+void USteamSocketsNetDriver::LowLevelDestroy()
+{
+    FlushOutgoingMessages();
+
+    if (ISteamNetworkingSockets* Sockets = SteamNetworkingSockets())
+    {
+        for (const TPair<HSteamNetConnection, USteamSocketsNetConnection*>& Pair : ConnectionsByHandle)
+        {
+            Sockets->CloseConnection(Pair.Key, k_ESteamNetConnectionEnd_App_Generic, "Net driver destroyed", true);
+            if (Pair.Value)
+            {
+                Pair.Value->ConnectionHandle = k_HSteamNetConnection_Invalid;
+            }
+        }
+        if (ListenSocket != k_HSteamListenSocket_Invalid)
+        {
+            Sockets->CloseListenSocket(ListenSocket);
+        }
+        if (PollGroup != k_HSteamNetPollGroup_Invalid)
+        {
+            Sockets->DestroyPollGroup(PollGroup);
+        }
+    }
+
+    if (RoutedBackend)
+    {
+        RoutedBackend->GetCallbackRouter().Unbind(StatusCallbackHandle);
+        RoutedBackend = nullptr;
+    }
+
+    ConnectionsByHandle.Empty();
+    ListenSocket = k_HSteamListenSocket_Invalid;
+    PollGroup = k_HSteamNetPollGroup_Invalid;
+
+    Super::LowLevelDestroy();
+}
+// - 1.10 - //
+bool USteamSocketsNetDriver::IsNetResourceValid()
+{
+    if (PollGroup == k_HSteamNetPollGroup_Invalid)
+    {
+        return false;
+    }
+    else if (IsServer())
+    {
+        return ListenSocket != k_HSteamListenSocket_Invalid;
+    }
+    else
+    {
+        return ServerConnection != nullptr;
+    }
+}
+/////////////////////////
+// 2. Connections     //
+////////////////////////////////////////////
+// 2.1 - Callback: Steam connection state //
+// 2.2 - Host: accept a new client       //
+// 2.3 - Queue one packet for the batch //
+// 2.4 - Hand the batch to Steam       //
+// 2.5 - Close one connection         //
+// 2.6 - Parse steam.<id> URLs       //
+// 2.7 - Per connection stats       //
+/////////////////////////////////////
+// - 2.1 - //
+void USteamSocketsNetDriver::OnConnectionStatusChanged(SteamNetConnectionStatusChangedCallback_t* pCallback)
+{
+    const bool bOurListenSocket = ListenSocket != k_HSteamListenSocket_Invalid && pCallback->m_info.m_hListenSocket == ListenSocket;
+    USteamSocketsNetConnection** Found = ConnectionsByHandle.Find(pCallback->m_hConn);
+    if (!bOurListenSocket && !Found)
+    {
+        // Another driver's connection (or the CDO)
+        return;
+    }
+
+    switch (pCallback->m_info.m_eState)
+    {
+    case k_ESteamNetworkingConnectionState_Connecting:
+        if (bOurListenSocket && !Found)
+        {
+            if (Notify && Notify->NotifyAcceptingConnection() == EAcceptConnection::Accept && SteamNetworkingSockets()->AcceptConnection(pCallback->m_hConn) == k_EResultOK)
+            {
+                SteamNetworkingSockets()->SetConnectionPollGroup(pCallback->m_hConn, PollGroup);
+            }
+            else
+            {
+                SteamNetworkingSockets()->CloseConnection(pCallback->m_hConn, k_ESteamNetConnectionEnd_App_Generic, "Not accepting connections", false);
+            }
+        }
+        break;
+
+    case k_ESteamNetworkingConnectionState_Connected:
+        if (bOurListenSocket && !Found)
+        {
+            HandleIncomingConnection(*pCallback);
+        }
+        else if (Found && *Found && *Found == ServerConnection)
+        {
+            ServerConnection->SetConnectionState(USOCK_Open);
+            UE_LOG(LogSteamMultiplayer, Log, TEXT("Steam socket connected to %llu"), (*Found)->RemoteSteamID.ConvertToUint64());
+        }
+        break;
+
+    case k_ESteamNetworkingConnectionState_ClosedByPeer:
+    case k_ESteamNetworkingConnectionState_ProblemDetectedLocally:
+        UE_LOG(LogSteamMultiplayer, Log, TEXT("Steam socket closed (%d): %s"), pCallback->m_info.m_eEndReason, UTF8_TO_TCHAR(pCallback->m_info.m_szEndDebug));
+        SteamNetworkingSockets()->CloseConnection(pCallback->m_hConn, 0, nullptr, false);
+        if (Found && *Found)
+        {
+            USteamSocketsNetConnection* Connection = *Found;
+            ConnectionsByHandle.Remove(pCallback->m_hConn);
+            Connection->ConnectionHandle = k_HSteamNetConnection_Invalid;
+
+            if (Connection == ServerConnection && Connection->GetConnectionState() == USOCK_Pending && GEngine)
+            {
+                GEngine->BroadcastNetworkFailure(GetWorld(), this, ENetworkFailure::ConnectionLost, UTF8_TO_TCHAR(pCallback->m_info.m_szEndDebug));
+            }
+            Connection->Close();
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+// - 2.2 - //
+void USteamSocketsNetDriver::HandleIncomingConnection(const SteamNetConnectionStatusChangedCallback_t& Status)
+{
+    USteamSocketsNetConnection* Connection = NewObject<USteamSocketsNetConnection>(GetTransientPackage(), NetConnectionClass);
+    Connection->InitSteamRemoteConnection(this, Status.m_hConn, Status.m_info.m_identityRemote.GetSteamID());
+    ConnectionsByHandle.Add(Status.m_hConn, Connection);
+
+    Notify->NotifyAcceptedConnection(Connection);
+    AddClientConnection(Connection);
+    UE_LOG(LogSteamMultiplayer, Log, TEXT("Accepted Steam socket connection from %llu"), Connection->RemoteSteamID.ConvertToUint64());
+}
+// - 2.3 - //
+void USteamSocketsNetDriver::QueueMessage(USteamSocketsNetConnection* Connection, const uint8* Data, int32 CountBytes)
+{
+    if (CountBytes <= 0 || Connection->ConnectionHandle == k_HSteamNetConnection_Invalid)
+    {
+        return;
+    }
+
+    // The packet is written once, straight into the buffer Steam will send from
+    SteamNetworkingMessage_t* Message = SteamNetworkingUtils()->AllocateMessage(CountBytes);
+    FMemory::Memcpy(Message->m_pData, Data, CountBytes);
+    Message->m_conn = Connection->ConnectionHandle;
+    Message->m_nFlags = SteamSockets::SendFlags;
+    OutgoingMessages.Add(Message);
+    ++Connection->BatchedMessages;
+
+    if (OutgoingMessages.Num() >= MaxBatchedMessages)
+    {
+        FlushOutgoingMessages();
+    }
+}
+// - 2.4 - //
+void USteamSocketsNetDriver::FlushOutgoingMessages()
+{
+    if (OutgoingMessages.Num() == 0)
+    {
+        return;
+    }
+    else if (!SteamNetworkingSockets())
+    {
+        for (SteamNetworkingMessage_t* Message : OutgoingMessages)
+        {
+            Message->Release();
+        }
+    }
+    else
+    {
+        // Steam takes ownership of every message, sent or not
+        SendResults.SetNumUninitialized(OutgoingMessages.Num(), EAllowShrinking::No);
+        SteamNetworkingSockets()->SendMessages(OutgoingMessages.Num(), OutgoingMessages.GetData(), SendResults.GetData());
+    }
+
+    OutgoingMessages.Reset();
+    for (const TPair<HSteamNetConnection, USteamSocketsNetConnection*>& Pair : ConnectionsByHandle)
+    {
+        if (Pair.Value)
+        {
+            Pair.Value->BatchedMessages = 0;
+        }
+    }
+}
+// - 2.5 - //
+void USteamSocketsNetDriver::CloseSteamConnection(USteamSocketsNetConnection* Connection)
+{
+    if (Connection->ConnectionHandle != k_HSteamNetConnection_Invalid)
+    {
+        // Send whatever is still batched for it, then let Steam linger until it is delivered
+        FlushOutgoingMessages();
+        if (SteamNetworkingSockets())
+        {
+            SteamNetworkingSockets()->CloseConnection(Connection->ConnectionHandle, k_ESteamNetConnectionEnd_App_Generic, "Connection closed", true);
+        }
+        ConnectionsByHandle.Remove(Connection->ConnectionHandle);
+        Connection->ConnectionHandle = k_HSteamNetConnection_Invalid;
+    }
+}
+// - 2.6 - //
+bool USteamSocketsNetDriver::ParseSteamURL(const FURL& URL, CSteamID& OutSteamID)
+{
+    if (!URL.Host.StartsWith(SteamSockets::URLPrefix))
+    {
+        return false;
+    }
+    else
+    {
+        uint64 SteamID64 = 0;
+        LexFromString(SteamID64, *URL.Host.RightChop(FCString::Strlen(SteamSockets::URLPrefix)));
+        OutSteamID.SetFromUint64(SteamID64);
+        return OutSteamID.IsValid() && OutSteamID.BIndividualAccount();
+    }
+}
+// - 2.7 - //
+TArray<FSteamConnectionStats> USteamSocketsNetDriver::GetConnectionStats() const
+{
+    TArray<FSteamConnectionStats> Stats;
+    Stats.Reserve(ConnectionsByHandle.Num());
+    for (const TPair<HSteamNetConnection, USteamSocketsNetConnection*>& Pair : ConnectionsByHandle)
+    {
+        if (Pair.Value)
+        {
+            Pair.Value->GetSteamStats(Stats.AddDefaulted_GetRef());
+        }
+    }
+    return Stats;
+}
+/////////////////////////
+// 3. Net Connection  //
+////////////////////////////////////////
+// 3.1 - Client side init            //
+// 3.2 - Server side init (IP API)  //
+// 3.3 - Server side init (Steam)  //
+// 3.4 - Send one packet          //
+// 3.5 - Describe                //
+// 3.6 - Clean up               //
+// 3.7 - Real-time stats       //
+// 3.8 - Packet handler stack //
+//////////////////////////////
+// - 3.1 - //
+void USteamSocketsNetConnection::InitLocalConnection(UNetDriver* InDriver, FSocket* InSocket, const FURL& InURL, EConnectionState InState, int32 InMaxPacket, int32 InPacketOverhead)
+{
+    InitBase(InDriver, InSocket, InURL, InState, InMaxPacket, InPacketOverhead);
+    InitSendBuffer();
+}
+// - 3.2 - //
+void USteamSocketsNetConnection::InitRemoteConnection(UNetDriver* InDriver, FSocket* InSocket, const FURL& InURL, const FInternetAddr& InRemoteAddr, EConnectionState InState, int32 InMaxPacket, int32 InPacketOverhead)
+{
+    // Steam connections have no IP address, this only exists to satisfy UNetConnection
+    InitBase(InDriver, InSocket, InURL, InState, InMaxPacket, InPacketOverhead);
+    InitSendBuffer();
+    SetClientLoginState(EClientLoginState::LoggingIn);
+    SetExpectedClientLoginMsgType(NMT_Hello);
+}
+// - 3.3 - //
+void USteamSocketsNetConnection::InitSteamRemoteConnection(UNetDriver* InDriver, HSteamNetConnection InHandle, CSteamID InRemoteSteamID)
+{
+    ConnectionHandle = InHandle;
+    RemoteSteamID = InRemoteSteamID;
+
+    InitBase(InDriver, nullptr, FURL(), USOCK_Open);
+    InitSendBuffer();
+    SetClientLoginState(EClientLoginState::LoggingIn);
+    SetExpectedClientLoginMsgType(NMT_Hello);
+}
+// - 3.4 - //
+void USteamSocketsNetConnection::LowLevelSend(void* Data, int32 CountBits, FOutPacketTraits& Traits)
+{
+    const uint8* DataToSend = reinterpret_cast<uint8*>(Data);
+    if (Handler.IsValid() && !Handler->GetRawSend())
+    {
+        const ProcessedPacket ProcessedData = Handler->Outgoing(reinterpret_cast<uint8*>(Data), CountBits, Traits);
+        if (ProcessedData.bError)
+        {
+            return;
+        }
+        DataToSend = ProcessedData.Data;
+        CountBits = ProcessedData.CountBits;
+    }
+
+    if (USteamSocketsNetDriver* SteamDriver = Cast<USteamSocketsNetDriver>(Driver))
+    {
+        SteamDriver->QueueMessage(this, DataToSend, FMath::DivideAndRoundUp(CountBits, 8));
+    }
+}
+// - 3.5 - //
+FString USteamSocketsNetConnection::LowLevelGetRemoteAddress(bool bAppendPort)
+{
+    return FString::Printf(TEXT("%s%llu"), SteamSockets::URLPrefix, RemoteSteamID.ConvertToUint64());
+}
+FString USteamSocketsNetConnection::LowLevelDescribe()
+{
+    return FString::Printf(TEXT("Steam socket %u, remote %llu, state %d"), ConnectionHandle, RemoteSteamID.ConvertToUint64(), (int32)GetConnectionState());
+}
+// - 3.6 - //
+void USteamSocketsNetConnection::CleanUp()
+{
+    if (USteamSocketsNetDriver* SteamDriver = Cast<USteamSocketsNetDriver>(Driver))
+    {
+        SteamDriver->CloseSteamConnection(this);
+    }
+    Super::CleanUp();
+}
+// - 3.7 - //
+bool USteamSocketsNetConnection::GetSteamStats(FSteamConnectionStats& OutStats) const
+{
+    OutStats.RemoteSteamID = (int64)RemoteSteamID.ConvertToUint64();
+    OutStats.BatchedMessages = BatchedMessages;
+
+    SteamNetConnectionRealTimeStatus_t Status;
+    if (ConnectionHandle == k_HSteamNetConnection_Invalid || !SteamNetworkingSockets()
+        || SteamNetworkingSockets()->GetConnectionRealTimeStatus(ConnectionHandle, &Status, 0, nullptr) != k_EResultOK)
+    {
+        return false;
+    }
+    else
+    {
+        OutStats.PingMs = Status.m_nPing;
+        OutStats.OutBytesPerSec = Status.m_flOutBytesPerSec;
+        OutStats.InBytesPerSec = Status.m_flInBytesPerSec;
+        OutStats.PendingBytes = Status.m_cbPendingUnreliable + Status.m_cbPendingReliable;
+        OutStats.QueueTimeMs = (float)(Status.m_usecQueueTime / 1000.0);
+        OutStats.ConnectionQuality = Status.m_flConnectionQualityLocal;
+        return true;
+    }
+}
+// - 3.8 - //
+void USteamSocketsNetConnection::InitHandler()
+{
+    // Same stack UNetConnection builds, minus StatelessConnectHandlerComponent. The client's challenge
+    // would wait forever, the server side has no connectionless handler to answer it and needs none.
+    check(!Handler.IsValid());
+    Handler = MakeUnique<PacketHandler>(&Driver->DDoS);
+
+    const UE::Handler::Mode Mode = Driver->ServerConnection != nullptr ? UE::Handler::Mode::Client : UE::Handler::Mode::Server;
+    Handler->InitializeDelegates(FPacketHandlerLowLevelSendTraits::CreateUObject(this, &UNetConnection::LowLevelSend), FPacketHandlerNotifyAddHandler::CreateUObject(this, &UNetConnection::NotifyAnalyticsProvider));
+    Handler->Initialize(Mode, MaxPacket * 8, false, nullptr, nullptr, Driver->GetNetDriverDefinition());
+    Handler->InitializeComponents();
+    MaxPacketHandlerBits = Handler->GetTotalReservedPacketBits();
+}
+///////////////////////////////////////////
+// MORE COMING SOON  // A.S. - hajddeen //
+/////////////////////////////////////////
@@ -0,0 +1,210 @@
+// |------------------------------------|
+// |  !FOLLOW URBAN SHADOWS ON SOCIALS! |
+// |------------------------------------|
+//            \ (^ᴗ^) /
+//             \     /
+//              -----
+//              |   |
+//              |   |
+//              |_  |_ 
+////////////////////////////////////////////////////////////
+// STEAM P2P SESSIONS - Unreal 5.5 + Steamworks SDK 1.57 //
+//////////////////////////////////////////////////////////////////
+// LICENSE AGREEMENT // LICENSE AGREEMENT // LICENSE AGREEMENT //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                                                                                                                                                                                                                                          //
+// Last Updated: 03/12/2024                                                                                                                                                                                                                                //
+//                                                                                                                                                                                                                                                        //
+// 1. Grant of License                                                                                                                                                                                                                                   //
+// This license permits anyone to use, modify, and distribute the provided code (the "Code") in projects free of charge under the following conditions:                                                                                                 //
+// 1.1. The Code must only be used for lawful purposes.                                                                                                                                                                                                //
+// 1.2. The user must include proper credit in their project as described in Section 3 below.                                                                                                                                                         //
+//                                                                                                                                                                                                                                                   //
+// 2. Restrictions                                                                                                                                                                                                                                  //
+// 2.1. This Code cannot be sold, sublicensed, or redistributed as a standalone product or as part of a similar development toolkit.                                                                                                               //
+// 2.2. The Code must not be used for projects that violate local laws or promote harmful, discriminatory, or illegal activities.                                                                                                                 //
+// 2.3. The user must not remove, alter, or obscure this license agreement, attribution requirements, or copyright notices within the Code.                                                                                                      //
+//                                                                                                                                                                                                                                              //
+// 3. Attribution                                                                                                                                                                                                                              //
+// 3.1. The user must include the following credit in a visible location within their project (e.g., splash screen, credits screen, or documentation):                                                                                        //
+// "Steam Multiplayer Code developed by Adrian Szajewski. Used under license."                                                                                                                                                               //
+// 3.2. For distributed or published projects, a link to https://adrianszajewskidev.wordpress.com/ or other contact details must also be included if applicable.                                                                            //
+//                                                                                                                                                                                                                                         //
+// 4. Breach of Agreement                                                                                                                                                                                                                 //
+// 4.1. If this license is violated, the licensor reserves the right to revoke the user's rights to use the Code immediately.                                                                                                            //
+// 4.2. The licensor may take legal action to recover damages or enforce compliance, depending on the severity of the violation.                                                                                                        //
+// 4.3. Users found in breach of this license may be required to:                                                                                                                                                                      //
+// Remove the Code from their project(s).                                                                                                                                                                                             //
+// Cease distribution of any projects using the Code.                                                                                                                                                                                //
+//                                                                                                                                                                                                                                  //
+// 5. Disclaimer                                                                                                                                                                                                                   //
+// 5.1. The Code is provided "as is" without any warranty, express or implied. The licensor is not liable for any damages arising from the use or misuse of the Code.                                                             //
+// 5.2. It is the user's responsibility to ensure compatibility and safe usage of the Code in their projects.                                                                                                                    //
+//                                                                                                                                                                                                                              //
+// 6. Governing Law                                                                                                                                                                                                            //
+// This agreement shall be governed and construed in accordance with the laws of Poland. Any disputes arising under or in connection with this license will be subject to the exclusive jurisdiction of the courts of Poland. //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+/////////////////////////////////////////////////////////
+// INCLUDE //
+////////////
+#include "CoreMinimal.h"
+#include "Engine/NetDriver.h"
+#include "Engine/NetConnection.h"
+#include "steam/steam_api.h"
+#include "steam/isteamnetworkingsockets.h"
+#include "steam/isteamnetworkingutils.h"
+#include "SteamBackend.h"
+#include "SteamSocketsNetDriver.generated.h"
+
+class USteamSocketsNetConnection;
+
+/////////////////////////////////////////////////////////////////////////////////////
+// STEAM SOCKETS NET DRIVER - NOTES                                                //
+/////////////////////////////////////////////////////////////////////////////////////
+// 1. Replication runs over ISteamNetworkingSockets P2P (relayed, NAT friendly).  //
+// 2. Connect URL is "steam.<host SteamID64>", listen URLs work as usual.        //
+// 3. Outgoing packets are written once into Steam-allocated messages and       //
+//    handed over in one SendMessages call per frame (Steam frees them).       //
+// 4. Incoming packets are read straight out of Steam's message buffers.      //
+// 5. Steam sets up and authenticates the connection, so there is no         //
+//    stateless handshake: no connectionless handler, and the               //
+//    PacketHandler stack leaves StatelessConnectHandlerComponent out.     //
+// 6. USteamMultiplayer registers it as GameNetDriver, IP is fallback.    //
+// 7. Works with STEAM_CALLBACK and manual dispatch (callback router).   //
+//////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////
+// STRUCT TO HOLD PER CONNECTION NET STATS   //
+///////////////////////////////////////////////
+USTRUCT(BlueprintType)
+struct FSteamConnectionStats
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Steam|Net")
+    int64 RemoteSteamID = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Steam|Net")
+    int32 PingMs = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Steam|Net")
+    float OutBytesPerSec = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Steam|Net")
+    float InBytesPerSec = 0.f;
+
+    // Bytes Steam still has to put on the wire
+    UPROPERTY(BlueprintReadOnly, Category = "Steam|Net")
+    int32 PendingBytes = 0;
+
+    // Estimated wait before a message queued now would be sent
+    UPROPERTY(BlueprintReadOnly, Category = "Steam|Net")
+    float QueueTimeMs = 0.f;
+
+    // Messages waiting for this frame's SendMessages batch
+    UPROPERTY(BlueprintReadOnly, Category = "Steam|Net")
+    int32 BatchedMessages = 0;
+
+    // 0..1, fraction of packets delivered intact and in order
+    UPROPERTY(BlueprintReadOnly, Category = "Steam|Net")
+    float ConnectionQuality = 0.f;
+};
+////////////////
+// NET DRIVER //
+////////////////
+UCLASS(transient, config = Engine)
+class URBANSHADOWS_API USteamSocketsNetDriver : public UNetDriver
+{
+    GENERATED_BODY()
+
+public:
+    USteamSocketsNetDriver();
+
+    //////////////////////////////////////////////
+    // 1. UNetDriver                           //
+    ////////////////////////////////////////////
+    virtual bool IsAvailable() const override;
+    virtual bool InitBase(bool bInitAsClient, FNetworkNotify* InNotify, const FURL& URL, bool bReuseAddressAndPort, FString& Error) override;
+    virtual bool InitConnect(FNetworkNotify* InNotify, const FURL& ConnectURL, FString& Error) override;
+    virtual bool InitListen(FNetworkNotify* InNotify, FURL& ListenURL, bool bReuseAddressAndPort, FString& Error) override;
+    virtual void InitConnectionlessHandler() override {} // Steam establishes connections itself
+    virtual void TickDispatch(float DeltaTime) override;
+    virtual void TickFlush(float DeltaSeconds) override;
+    virtual void LowLevelSend(TSharedPtr<const FInternetAddr> Address, void* Data, int32 CountBits, FOutPacketTraits& Traits) override;
+    virtual FString LowLevelGetNetworkNumber() override;
+    virtual void LowLevelDestroy() override;
+    virtual bool IsNetResourceValid() override;
+    virtual class ISocketSubsystem* GetSocketSubsystem() override { return nullptr; }
+
+    //////////////////////////////////////////////
+    // 2. Stats                                //
+    ////////////////////////////////////////////
+    UFUNCTION(BlueprintCallable, Category = "Steam|Net")
+    TArray<FSteamConnectionStats> GetConnectionStats() const;
+
+    // Largest batch handed to SendMessages at once, full batches are flushed early
+    UPROPERTY(Config)
+    int32 MaxBatchedMessages;
+
+    //////////////////////////////////////////////
+    // 3. Used by USteamSocketsNetConnection   //
+    ////////////////////////////////////////////
+    void QueueMessage(USteamSocketsNetConnection* Connection, const uint8* Data, int32 CountBytes);
+    void CloseSteamConnection(USteamSocketsNetConnection* Connection);
+
+    static bool ParseSteamURL(const FURL& URL, CSteamID& OutSteamID);
+
+private:
+    HSteamListenSocket ListenSocket;
+    HSteamNetPollGroup PollGroup;
+    TMap<HSteamNetConnection, USteamSocketsNetConnection*> ConnectionsByHandle; // Owned through ServerConnection / ClientConnections
+
+    TArray<SteamNetworkingMessage_t*> OutgoingMessages; // Filled by LowLevelSend, drained by FlushOutgoingMessages
+    TArray<int64> SendResults;
+    TArray<SteamNetworkingMessage_t*> IncomingMessages; // Fixed size, reused every TickDispatch
+
+    // Manual dispatch: STEAM_CALLBACK never fires, status changes come through the backend router
+    ISteamBackend* RoutedBackend;
+    FSteamCallbackRouter::FHandle StatusCallbackHandle;
+
+    void FlushOutgoingMessages();
+    void HandleIncomingConnection(const SteamNetConnectionStatusChangedCallback_t& Status);
+
+    STEAM_CALLBACK(USteamSocketsNetDriver, OnConnectionStatusChanged, SteamNetConnectionStatusChangedCallback_t);
+};
+////////////////////
+// NET CONNECTION //
+////////////////////
+UCLASS(transient, config = Engine)
+class URBANSHADOWS_API USteamSocketsNetConnection : public UNetConnection
+{
+    GENERATED_BODY()
+
+public:
+    //////////////////////////////////////////////
+    // 1. UNetConnection                       //
+    ////////////////////////////////////////////
+    virtual void InitLocalConnection(UNetDriver* InDriver, FSocket* InSocket, const FURL& InURL, EConnectionState InState, int32 InMaxPacket = 0, int32 InPacketOverhead = 0) override;
+    virtual void InitRemoteConnection(UNetDriver* InDriver, FSocket* InSocket, const FURL& InURL, const FInternetAddr& InRemoteAddr, EConnectionState InState, int32 InMaxPacket = 0, int32 InPacketOverhead = 0) override;
+    virtual void InitHandler() override;
+    virtual void LowLevelSend(void* Data, int32 CountBits, FOutPacketTraits& Traits) override;
+    virtual FString LowLevelGetRemoteAddress(bool bAppendPort = false) override;
+    virtual FString LowLevelDescribe() override;
+    virtual void CleanUp() override;
+
+    //////////////////////////////////////////////
+    // 2. Steam                                //
+    ////////////////////////////////////////////
+    // Server side: wraps a connection Steam already accepted
+    void InitSteamRemoteConnection(UNetDriver* InDriver, HSteamNetConnection InHandle, CSteamID InRemoteSteamID);
+
+    bool GetSteamStats(FSteamConnectionStats& OutStats) const;
+
+    HSteamNetConnection ConnectionHandle = k_HSteamNetConnection_Invalid;
+    CSteamID RemoteSteamID;
+    int32 BatchedMessages = 0; // Queued in the driver, not yet handed to Steam
+};
+///////////////////////////////////////////
+// MORE COMING SOON  // A.S. - hajddeen //
+/////////////////////////////////////////
@@ -0,0 +1,274 @@
+// |------------------------------------|
+// |  !FOLLOW URBAN SHADOWS ON SOCIALS! |
+// |------------------------------------|
+//            \ (^ᴗ^) /
+//             \     /
+//              -----
+//              |   |
+//              |   |
+//              |_  |_
+////////////////////////////////////////////////////////////
+// STEAM P2P SESSIONS - Unreal 5.5 + Steamworks SDK 1.57 //
+//////////////////////////////////////////////////////////////////
+// LICENSE AGREEMENT // LICENSE AGREEMENT // LICENSE AGREEMENT //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                                                                                                                                                                                                                                          //
+// Last Updated: 03/12/2024                                                                                                                                                                                                                                //
+//                                                                                                                                                                                                                                                        //
+// 1. Grant of License                                                                                                                                                                                                                                   //
+// This license permits anyone to use, modify, and distribute the provided code (the "Code") in projects free of charge under the following conditions:                                                                                                 //
+// 1.1. The Code must only be used for lawful purposes.                                                                                                                                                                                                //
+// 1.2. The user must include proper credit in their project as described in Section 3 below.                                                                                                                                                         //
+//                                                                                                                                                                                                                                                   //
+// 2. Restrictions                                                                                                                                                                                                                                  //
+// 2.1. This Code cannot be sold, sublicensed, or redistributed as a standalone product or as part of a similar development toolkit.                                                                                                               //
+// 2.2. The Code must not be used for projects that violate local laws or promote harmful, discriminatory, or illegal activities.                                                                                                                 //
+// 2.3. The user must not remove, alter, or obscure this license agreement, attribution requirements, or copyright notices within the Code.                                                                                                      //
+//                                                                                                                                                                                                                                              //
+// 3. Attribution                                                                                                                                                                                                                              //
+// 3.1. The user must include the following credit in a visible location within their project (e.g., splash screen, credits screen, or documentation):                                                                                        //
+// "Steam Multiplayer Code developed by Adrian Szajewski. Used under license."                                                                                                                                                               //
+// 3.2. For distributed or published projects, a link to https://adrianszajewskidev.wordpress.com/ or other contact details must also be included if applicable.                                                                            //
+//                                                                                                                                                                                                                                         //
+// 4. Breach of Agreement                                                                                                                                                                                                                 //
+// 4.1. If this license is violated, the licensor reserves the right to revoke the user's rights to use the Code immediately.                                                                                                            //
+// 4.2. The licensor may take legal action to recover damages or enforce compliance, depending on the severity of the violation.                                                                                                        //
+// 4.3. Users found in breach of this license may be required to:                                                                                                                                                                      //
+// Remove the Code from their project(s).                                                                                                                                                                                             //
+// Cease distribution of any projects using the Code.                                                                                                                                                                                //
+//                                                                                                                                                                                                                                  //
+// 5. Disclaimer                                                                                                                                                                                                                   //
+// 5.1. The Code is provided "as is" without any warranty, express or implied. The licensor is not liable for any damages arising from the use or misuse of the Code.                                                             //
+// 5.2. It is the user's responsibility to ensure compatibility and safe usage of the Code in their projects.                                                                                                                    //
+//                                                                                                                                                                                                                              //
+// 6. Governing Law                                                                                                                                                                                                            //
+// This agreement shall be governed and construed in accordance with the laws of Poland. Any disputes arising under or in connection with this license will be subject to the exclusive jurisdiction of the courts of Poland. //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////
+// INCLUDE //
+////////////
+#include "SteamSocketsNetDriver.h"
+#include "SteamMultiplayer.h"
+#include "Engine/Engine.h"
+#include "Engine/Channel.h"
+#include "Net/DataChannel.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/NetworkVersion.h"
+#include "PacketHandler.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+//////////////////////////////////////
+// Steam Sockets Tests - Internals //
+////////////////////////////////////////////////////////////////////////
+// 1. Needs a logged in Steam client, the host is the local user      //
+// 2. Steam loops the P2P connection back to ourselves               //
+// 3. Client must get from Hello to Welcome with no stateless reply //
+/////////////////////////////////////////////////////////////////////
+namespace SteamSocketsTests
+{
+    constexpr double TimeoutSeconds = 20.0;
+    constexpr float TickSeconds = 1.0f / 60.0f;
+
+    // Bare bones of UWorld (server) and UPendingNetGame (client), only the control channel matters
+    class FLoopbackNotify : public FNetworkNotify
+    {
+    public:
+        explicit FLoopbackNotify(bool bInServer)
+            : bServer(bInServer)
+        {
+        }
+
+        virtual EAcceptConnection::Type NotifyAcceptingConnection() override
+        {
+            return bServer ? EAcceptConnection::Accept : EAcceptConnection::Reject;
+        }
+
+        virtual void NotifyAcceptedConnection(UNetConnection* Connection) override
+        {
+        }
+
+        virtual bool NotifyAcceptingChannel(UChannel* Channel) override
+        {
+            return Channel->ChName == NAME_Control;
+        }
+
+        virtual void NotifyControlMessage(UNetConnection* Connection, uint8 MessageType, FInBunch& Bunch) override
+        {
+            if (bServer && MessageType == NMT_Hello)
+            {
+                uint8 IsLittleEndian = 0;
+                uint32 RemoteNetworkVersion = 0;
+                FString EncryptionToken;
+                EEngineNetworkRuntimeFeatures RemoteFeatures = EEngineNetworkRuntimeFeatures::None;
+                if (FNetControlMessage<NMT_Hello>::Receive(Bunch, IsLittleEndian, RemoteNetworkVersion, EncryptionToken, RemoteFeatures))
+                {
+                    bReceivedHello = true;
+                    FString LevelName = TEXT("/Game/SteamSocketsTest");
+                    FString GameName;
+                    FString RedirectURL;
+                    FNetControlMessage<NMT_Welcome>::Send(Connection, LevelName, GameName, RedirectURL);
+                    Connection->FlushNet();
+                }
+            }
+            else if (!bServer && MessageType == NMT_Welcome)
+            {
+                bReceivedWelcome = true;
+            }
+        }
+
+        bool bServer;
+        bool bReceivedHello = false;
+        bool bReceivedWelcome = false;
+    };
+
+    struct FLoopbackState
+    {
+        FLoopbackNotify ServerNotify{true};
+        FLoopbackNotify ClientNotify{false};
+        USteamSocketsNetDriver* Server = nullptr;
+        USteamSocketsNetDriver* Client = nullptr;
+        bool bHandshakeStarted = false;
+        bool bHandshakeComplete = false;
+        bool bSentHello = false;
+        double Deadline = 0.0;
+    };
+
+    // Under manual dispatch the game instance pumps the router, otherwise STEAM_CALLBACK needs RunCallbacks
+    bool UsesManualDispatch()
+    {
+        if (GEngine)
+        {
+            for (const FWorldContext& Context : GEngine->GetWorldContexts())
+            {
+                USteamMultiplayer* GameInstance = Cast<USteamMultiplayer>(Context.OwningGameInstance);
+                ISteamBackend* Backend = GameInstance ? GameInstance->GetSteamBackend() : nullptr;
+                if (Backend && Backend->UsesCallbackRouter())
+                {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    void SendHello(UNetConnection* Connection)
+    {
+        // Same fields UPendingNetGame::SendInitialJoin sends
+        uint8 IsLittleEndian = uint8(PLATFORM_LITTLE_ENDIAN);
+        uint32 LocalNetworkVersion = FNetworkVersion::GetLocalNetworkVersion();
+        FString EncryptionToken;
+        EEngineNetworkRuntimeFeatures LocalFeatures = Connection->Driver->GetNetworkRuntimeFeatures();
+        FNetControlMessage<NMT_Hello>::Send(Connection, IsLittleEndian, LocalNetworkVersion, EncryptionToken, LocalFeatures);
+        Connection->FlushNet();
+    }
+
+    void Destroy(USteamSocketsNetDriver*& Driver)
+    {
+        if (Driver)
+        {
+            Driver->Shutdown();
+            Driver->LowLevelDestroy();
+            Driver->RemoveFromRoot();
+            Driver = nullptr;
+        }
+    }
+}
+/////////////////////////
+// 1. Loopback        //
+//////////////////////////////////////////////
+// 1.1 - Client reaches Welcome over Steam //
+////////////////////////////////////////////
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSteamSocketsLoopbackTest, "UrbanShadows.Steam.Sockets.ClientReachesWelcome", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+// - 1.1 - //
+bool FSteamSocketsLoopbackTest::RunTest(const FString& Parameters)
+{
+    if (!SteamUser() || !SteamNetworkingSockets())
+    {
+        AddWarning(TEXT("Skipped, needs a running Steam client."));
+        return true;
+    }
+
+    TSharedRef<SteamSocketsTests::FLoopbackState> State = MakeShared<SteamSocketsTests::FLoopbackState>();
+    FString Error;
+
+    State->Server = NewObject<USteamSocketsNetDriver>();
+    State->Server->AddToRoot();
+    FURL ListenURL;
+    if (!State->Server->InitListen(&State->ServerNotify, ListenURL, false, Error))
+    {
+        AddError(FString::Printf(TEXT("Listen failed: %s"), *Error));
+        SteamSocketsTests::Destroy(State->Server);
+        return false;
+    }
+
+    State->Client = NewObject<USteamSocketsNetDriver>();
+    State->Client->AddToRoot();
+    FURL ConnectURL;
+    ConnectURL.Host = State->Server->LowLevelGetNetworkNumber();
+    if (!State->Client->InitConnect(&State->ClientNotify, ConnectURL, Error))
+    {
+        AddError(FString::Printf(TEXT("Connect failed: %s"), *Error));
+        SteamSocketsTests::Destroy(State->Client);
+        SteamSocketsTests::Destroy(State->Server);
+        return false;
+    }
+
+    State->Deadline = FPlatformTime::Seconds() + SteamSocketsTests::TimeoutSeconds;
+    ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, State]()
+    {
+        if (!SteamSocketsTests::UsesManualDispatch())
+        {
+            SteamAPI_RunCallbacks();
+        }
+
+        State->Server->TickDispatch(SteamSocketsTests::TickSeconds);
+        State->Client->TickDispatch(SteamSocketsTests::TickSeconds);
+
+        // What UPendingNetGame does once the connection opens, the handler must not hold the Hello back
+        UNetConnection* ServerConnection = State->Client->ServerConnection;
+        if (!State->bHandshakeStarted && ServerConnection && ServerConnection->GetConnectionState() == USOCK_Open)
+        {
+            State->bHandshakeStarted = true;
+            if (ServerConnection->Handler.IsValid())
+            {
+                ServerConnection->Handler->BeginHandshaking(FPacketHandlerHandshakeComplete::CreateLambda([State]()
+                {
+                    State->bHandshakeComplete = true;
+                }));
+                State->bHandshakeComplete |= ServerConnection->Handler->IsFullyInitialized();
+            }
+            else
+            {
+                State->bHandshakeComplete = true;
+            }
+            TestTrue(TEXT("Client packet handler needs no handshake round trip"), State->bHandshakeComplete);
+        }
+        if (State->bHandshakeComplete && !State->bSentHello)
+        {
+            State->bSentHello = true;
+            SteamSocketsTests::SendHello(ServerConnection);
+        }
+
+        State->Server->TickFlush(SteamSocketsTests::TickSeconds);
+        State->Client->TickFlush(SteamSocketsTests::TickSeconds);
+
+        if (State->ClientNotify.bReceivedWelcome || FPlatformTime::Seconds() > State->Deadline)
+        {
+            TestTrue(TEXT("Client connection opened"), State->bHandshakeStarted);
+            TestTrue(TEXT("Server received Hello"), State->ServerNotify.bReceivedHello);
+            TestTrue(TEXT("Client received Welcome"), State->ClientNotify.bReceivedWelcome);
+            SteamSocketsTests::Destroy(State->Client);
+            SteamSocketsTests::Destroy(State->Server);
+            return true;
+        }
+        else
+        {
+            return false;
+        }
+    }));
+    return true;
+}
+#endif // WITH_DEV_AUTOMATION_TESTS
+///////////////////////////////////////////
+// MORE COMING SOON  // A.S. - hajddeen //
+/////////////////////////////////////////
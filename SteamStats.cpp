@@ -0,0 +1,873 @@
+// |------------------------------------|
+// |  !FOLLOW URBAN SHADOWS ON SOCIALS! |
+// |------------------------------------|
+//            \ (^ᴗ^) /
+//             \     /
+//              -----
+//              |   |
+//              |   |
+//              |_  |_
+////////////////////////////////////////////////////////////
+// STEAM P2P SESSIONS - Unreal 5.5 + Steamworks SDK 1.57 //
+//////////////////////////////////////////////////////////////////
+// LICENSE AGREEMENT // LICENSE AGREEMENT // LICENSE AGREEMENT //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                                                                                                                                                                                                                                          //
+// Last Updated: 03/12/2024                                                                                                                                                                                                                                //
+//                                                                                                                                                                                                                                                        //
+// 1. Grant of License                                                                                                                                                                                                                                   //
+// This license permits anyone to use, modify, and distribute the provided code (the "Code") in projects free of charge under the following conditions:                                                                                                 //
+// 1.1. The Code must only be used for lawful purposes.                                                                                                                                                                                                //
+// 1.2. The user must include proper credit in their project as described in Section 3 below.                                                                                                                                                         //
+//                                                                                                                                                                                                                                                   //
+// 2. Restrictions                                                                                                                                                                                                                                  //
+// 2.1. This Code cannot be sold, sublicensed, or redistributed as a standalone product or as part of a similar development toolkit.                                                                                                               //
+// 2.2. The Code must not be used for projects that violate local laws or promote harmful, discriminatory, or illegal activities.                                                                                                                 //
+// 2.3. The user must not remove, alter, or obscure this license agreement, attribution requirements, or copyright notices within the Code.                                                                                                      //
+//                                                                                                                                                                                                                                              //
+// 3. Attribution                                                                                                                                                                                                                              //
+// 3.1. The user must include the following credit in a visible location within their project (e.g., splash screen, credits screen, or documentation):                                                                                        //
+// "Steam Multiplayer Code developed by Adrian Szajewski. Used under license."                                                                                                                                                               //
+// 3.2. For distributed or published projects, a link to https://adrianszajewskidev.wordpress.com/ or other contact details must also be included if applicable.                                                                            //
+//                                                                                                                                                                                                                                         //
+// 4. Breach of Agreement                                                                                                                                                                                                                 //
+// 4.1. If this license is violated, the licensor reserves the right to revoke the user's rights to use the Code immediately.                                                                                                            //
+// 4.2. The licensor may take legal action to recover damages or enforce compliance, depending on the severity of the violation.                                                                                                        //
+// 4.3. Users found in breach of this license may be required to:                                                                                                                                                                      //
+// Remove the Code from their project(s).                                                                                                                                                                                             //
+// Cease distribution of any projects using the Code.                                                                                                                                                                                //
+//                                                                                                                                                                                                                                  //
+// 5. Disclaimer                                                                                                                                                                                                                   //
+// 5.1. The Code is provided "as is" without any warranty, express or implied. The licensor is not liable for any damages arising from the use or misuse of the Code.                                                             //
+// 5.2. It is the user's responsibility to ensure compatibility and safe usage of the Code in their projects.                                                                                                                    //
+//                                                                                                                                                                                                                              //
+// 6. Governing Law                                                                                                                                                                                                            //
+// This agreement shall be governed and construed in accordance with the laws of Poland. Any disputes arising under or in connection with this license will be subject to the exclusive jurisdiction of the courts of Poland. //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////
+// INCLUDE //
+////////////
+#include "SteamStats.h"
+#include "SteamMultiplayer.h"
+#include "SteamMultiplayerStats.h"
+#include "HAL/PlatformTime.h"
+/////////////////////////////
+// Steam Stats - Internals //
+///////////////////////////////////////////////////////////////////
+// 1. Steam rate limits StoreStats, a few per minute is plenty  //
+// 2. Stale pages are handed out while their refresh runs      //
+////////////////////////////////////////////////////////////////
+namespace SteamStats
+{
+    constexpr float TickSeconds = 0.25f;
+    constexpr double MinFlushGapSeconds = 5.0;
+    constexpr double StatsRetrySeconds = 10.0;
+    constexpr double PageSeconds = 60.0;
+    constexpr float RequestTimeoutSeconds = 10.f;
+
+    // Stat, achievement and leaderboard API names are plain ASCII
+    TArray<ANSICHAR> ToAnsi(FName Name)
+    {
+        const FString String = Name.ToString();
+        const auto Ansi = StringCast<ANSICHAR>(*String);
+        return TArray<ANSICHAR>(Ansi.Get(), Ansi.Length() + 1);
+    }
+
+    bool ReadValue(ISteamBackend& Steam, const char* Name, bool bFloat, double& OutValue)
+    {
+        if (bFloat)
+        {
+            float Value = 0.f;
+            const bool bRead = Steam.GetStatFloat(Name, &Value);
+            OutValue = bRead ? Value : OutValue;
+            return bRead;
+        }
+        else
+        {
+            int32 Value = 0;
+            const bool bRead = Steam.GetStatInt(Name, &Value);
+            OutValue = bRead ? Value : OutValue;
+            return bRead;
+        }
+    }
+
+    int32 FirstPage(int32 FirstRank)
+    {
+        return (FMath::Max(FirstRank, 1) - 1) / USteamStatsSubsystem::RowsPerPage;
+    }
+
+    int32 LastPage(int32 FirstRank, int32 NumRows)
+    {
+        return (FMath::Max(FirstRank, 1) + FMath::Max(NumRows, 1) - 2) / USteamStatsSubsystem::RowsPerPage;
+    }
+}
+/////////////////////////
+// 1. Lifecycle       //
+//////////////////////////////////////////
+// 1.1 - Only for USteamMultiplayer    //
+// 1.2 - Teardown                     //
+// 1.3 - Start once Steam is up      //
+// 1.4 - Stop before Steam goes     //
+// 1.5 - Get the game instance     //
+////////////////////////////////////
+// - 1.1 - //
+bool USteamStatsSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+    return Outer && Outer->IsA<USteamMultiplayer>();
+}
+// - 1.2 - //
+void USteamStatsSubsystem::Deinitialize()
+{
+    StopStats();
+    Super::Deinitialize();
+}
+// - 1.3 - //
+void USteamStatsSubsystem::StartStats()
+{
+    USteamMultiplayer* Multiplayer = GetMultiplayer();
+    ISteamBackend* Steam = Multiplayer ? Multiplayer->GetSteamBackend() : nullptr;
+    if (bStarted || !Steam || !Steam->IsRunning())
+    {
+        return;
+    }
+
+    bStarted = true;
+    bStatsReady = false;
+    AsyncCalls = MakeUnique<FSteamAsyncCalls>(*Steam);
+
+    if (Steam->UsesCallbackRouter())
+    {
+        RoutedBackend = Steam;
+        StatsReceivedHandle = Steam->GetCallbackRouter().Bind<UserStatsReceived_t>([this](UserStatsReceived_t* pCallback)
+        {
+            OnUserStatsReceived(pCallback);
+        });
+        StatsStoredHandle = Steam->GetCallbackRouter().Bind<UserStatsStored_t>([this](UserStatsStored_t* pCallback)
+        {
+            OnUserStatsStored(pCallback);
+        });
+    }
+
+    StatsRequestTime = FPlatformTime::Seconds();
+    LastFlushTime = StatsRequestTime;
+    if (!Steam->RequestCurrentStats())
+    {
+        UE_LOG(LogSteamMultiplayer, Warning, TEXT("Steam refused to load the user's stats, retrying in %.0f s."), SteamStats::StatsRetrySeconds);
+    }
+    FlushTicker = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &USteamStatsSubsystem::Tick), SteamStats::TickSeconds);
+
+    // Boards used before Steam was up, then the ones the game wants warm
+    for (TPair<FName, FBoard>& Pair : Boards)
+    {
+        if (Pair.Value.WantedPages.Num() > 0 || Pair.Value.PendingScore.IsSet())
+        {
+            FindBoard(Pair.Key, Pair.Value);
+        }
+    }
+    for (const FName& Leaderboard : Multiplayer->PrefetchLeaderboards)
+    {
+        PrefetchLeaderboard(Leaderboard, 1, RowsPerPage);
+    }
+}
+// - 1.4 - //
+void USteamStatsSubsystem::StopStats()
+{
+    if (!bStarted)
+    {
+        return;
+    }
+
+    // Steam keeps stored stats and issued uploads even when we stop listening right after
+    FlushNow();
+    const int32 NumLeft = GetNumPendingWrites();
+    if (NumLeft > 0)
+    {
+        UE_LOG(LogSteamMultiplayer, Warning, TEXT("%d stat writes could not reach Steam before it shut down (stats loaded: %s)."), NumLeft, bStatsReady ? TEXT("yes") : TEXT("no"));
+    }
+
+    FTSTicker::GetCoreTicker().RemoveTicker(FlushTicker);
+    FlushTicker.Reset();
+    if (RoutedBackend)
+    {
+        RoutedBackend->GetCallbackRouter().Unbind(StatsReceivedHandle);
+        RoutedBackend->GetCallbackRouter().Unbind(StatsStoredHandle);
+        RoutedBackend = nullptr;
+    }
+
+    // Resolves whatever is in flight as Cancelled, handles and pages belong to this Steam session
+    AsyncCalls.Reset();
+    for (TPair<FName, FBoard>& Pair : Boards)
+    {
+        Pair.Value.Handle = 0;
+        Pair.Value.bFinding = false;
+        Pair.Value.Pages.Reset();
+        Pair.Value.PagesInFlight.Reset();
+        Pair.Value.WantedPages.Reset();
+    }
+    PagePool.Reset();
+    SET_DWORD_STAT(STAT_SteamLeaderboardPages, 0);
+
+    bStarted = false;
+    bStatsReady = false;
+}
+// - 1.5 - //
+USteamMultiplayer* USteamStatsSubsystem::GetMultiplayer() const
+{
+    return Cast<USteamMultiplayer>(GetGameInstance());
+}
+
+ISteamBackend* USteamStatsSubsystem::GetBackend() const
+{
+    USteamMultiplayer* Multiplayer = GetMultiplayer();
+    return Multiplayer ? Multiplayer->GetSteamBackend() : nullptr;
+}
+//////////////////////////////
+// 2. Stats + Achievements //
+////////////////////////////////////////////
+// 2.1 - Coalesce a stat write           //
+// 2.2 - Read through the cache         //
+// 2.3 - Achievements                  //
+// 2.4 - Cache entry for a stat       //
+// 2.5 - Callback: Stats received    //
+// 2.6 - Re-read Steam's values     //
+/////////////////////////////////////
+// - 2.1 - //
+void USteamStatsSubsystem::IncrementStat(FName Name, int32 Delta)
+{
+    FStat& Stat = FindOrAddStat(Name, false);
+    Stat.Pending += Delta;
+    if (!Stat.bDirty)
+    {
+        Stat.bDirty = true;
+        DirtyStats.Add(Name);
+    }
+}
+
+void USteamStatsSubsystem::AddToStatFloat(FName Name, float Delta)
+{
+    FStat& Stat = FindOrAddStat(Name, true);
+    Stat.Pending += Delta;
+    if (!Stat.bDirty)
+    {
+        Stat.bDirty = true;
+        DirtyStats.Add(Name);
+    }
+}
+
+void USteamStatsSubsystem::SetStatInt(FName Name, int32 Value)
+{
+    FStat& Stat = FindOrAddStat(Name, false);
+    Stat.Pending = Value;
+    Stat.bPendingSet = true;
+    if (!Stat.bDirty)
+    {
+        Stat.bDirty = true;
+        DirtyStats.Add(Name);
+    }
+}
+
+void USteamStatsSubsystem::SetStatFloat(FName Name, float Value)
+{
+    FStat& Stat = FindOrAddStat(Name, true);
+    Stat.Pending = Value;
+    Stat.bPendingSet = true;
+    if (!Stat.bDirty)
+    {
+        Stat.bDirty = true;
+        DirtyStats.Add(Name);
+    }
+}
+// - 2.2 - //
+int32 USteamStatsSubsystem::GetStatInt(FName Name) const
+{
+    if (const FStat* Stat = Stats.Find(Name))
+    {
+        return FMath::RoundToInt32(Stat->GetValue());
+    }
+
+    // Never written here, Steam's copy is a local read once the stats are in
+    double Value = 0.0;
+    ISteamBackend* Steam = GetBackend();
+    if (bStatsReady && Steam)
+    {
+        SteamStats::ReadValue(*Steam, FindOrAddReadName(Name), false, Value);
+    }
+    return FMath::RoundToInt32(Value);
+}
+
+float USteamStatsSubsystem::GetStatFloat(FName Name) const
+{
+    if (const FStat* Stat = Stats.Find(Name))
+    {
+        return (float)Stat->GetValue();
+    }
+
+    double Value = 0.0;
+    ISteamBackend* Steam = GetBackend();
+    if (bStatsReady && Steam)
+    {
+        SteamStats::ReadValue(*Steam, FindOrAddReadName(Name), true, Value);
+    }
+    return (float)Value;
+}
+// - 2.3 - //
+void USteamStatsSubsystem::UnlockAchievement(FName Name)
+{
+    FAchievement* Achievement = Achievements.Find(Name);
+    if (!Achievement)
+    {
+        Achievement = &Achievements.Add(Name);
+        Achievement->SteamName = SteamStats::ToAnsi(Name);
+    }
+
+    if (!Achievement->bUnlocked && !Achievement->bDirty)
+    {
+        Achievement->bUnlocked = true;
+        Achievement->bDirty = true;
+        DirtyAchievements.Add(Name);
+    }
+}
+
+bool USteamStatsSubsystem::IsAchievementUnlocked(FName Name) const
+{
+    if (const FAchievement* Achievement = Achievements.Find(Name))
+    {
+        return Achievement->bUnlocked;
+    }
+
+    bool bAchieved = false;
+    ISteamBackend* Steam = GetBackend();
+    if (bStatsReady && Steam)
+    {
+        Steam->GetAchievement(FindOrAddReadName(Name), &bAchieved);
+    }
+    return bAchieved;
+}
+// - 2.4 - //
+USteamStatsSubsystem::FStat& USteamStatsSubsystem::FindOrAddStat(FName Name, bool bFloat)
+{
+    if (FStat* Existing = Stats.Find(Name))
+    {
+        return *Existing;
+    }
+
+    FStat& Stat = Stats.Add(Name);
+    Stat.SteamName = SteamStats::ToAnsi(Name);
+    Stat.bFloat = bFloat;
+
+    ISteamBackend* Steam = GetBackend();
+    if (bStatsReady && Steam)
+    {
+        SteamStats::ReadValue(*Steam, Stat.SteamName.GetData(), bFloat, Stat.SteamValue);
+    }
+    return Stat;
+}
+
+const char* USteamStatsSubsystem::FindOrAddReadName(FName Name) const
+{
+    if (const TArray<ANSICHAR>* Existing = ReadNames.Find(Name))
+    {
+        return Existing->GetData();
+    }
+    return ReadNames.Add(Name, SteamStats::ToAnsi(Name)).GetData();
+}
+// - 2.5 - //
+void USteamStatsSubsystem::OnUserStatsReceived(UserStatsReceived_t* pCallback)
+{
+    ISteamBackend* Steam = GetBackend();
+    if (!bStarted || !Steam || pCallback->m_steamIDUser != Steam->GetLocalSteamID())
+    {
+        return;
+    }
+    else if (pCallback->m_eResult != k_EResultOK)
+    {
+        // Tick asks again after StatsRetrySeconds
+        UE_LOG(LogSteamMultiplayer, Warning, TEXT("Loading the user's stats failed (%d)."), (int32)pCallback->m_eResult);
+        return;
+    }
+
+    bStatsReady = true;
+    ReadSteamValues(*Steam);
+
+    // Whatever piled up while waiting goes out with the next tick
+    if (DirtyStats.Num() > 0 || DirtyAchievements.Num() > 0)
+    {
+        bFlushRequested = true;
+    }
+    UE_LOG(LogSteamMultiplayer, Log, TEXT("Steam stats loaded, %d writes waiting."), DirtyStats.Num() + DirtyAchievements.Num());
+}
+// - 2.6 - //
+void USteamStatsSubsystem::ReadSteamValues(ISteamBackend& Steam)
+{
+    for (TPair<FName, FStat>& Pair : Stats)
+    {
+        if (!SteamStats::ReadValue(Steam, Pair.Value.SteamName.GetData(), Pair.Value.bFloat, Pair.Value.SteamValue))
+        {
+            UE_LOG(LogSteamMultiplayer, Warning, TEXT("Stat %s is not in the app's Steamworks stats."), *Pair.Key.ToString());
+        }
+    }
+
+    for (TPair<FName, FAchievement>& Pair : Achievements)
+    {
+        bool bAchieved = false;
+        if (Steam.GetAchievement(Pair.Value.SteamName.GetData(), &bAchieved))
+        {
+            Pair.Value.bUnlocked |= bAchieved;
+        }
+    }
+}
+/////////////////////////
+// 3. Leaderboards    //
+////////////////////////////////////////////
+// 3.1 - Coalesce a score                //
+// 3.2 - Prefetch a rank range          //
+// 3.3 - Cached rows                   //
+// 3.4 - Find a board                 //
+// 3.5 - Board found                 //
+// 3.6 - Upload a score             //
+// 3.7 - Download a page           //
+// 3.8 - Store a page             //
+// 3.9 - Read entries off-thread //
+//////////////////////////////////
+// - 3.1 - //
+void USteamStatsSubsystem::SubmitLeaderboardScore(FName Leaderboard, int32 Score, bool bKeepBest)
+{
+    // A keep-best score on top of anything pending keeps the higher one under the pending method,
+    // which is what Steam would end up with after both uploads
+    FBoard& Board = FindOrAddBoard(Leaderboard);
+    if (bKeepBest && Board.PendingScore.IsSet())
+    {
+        Board.PendingScore = FMath::Max(Board.PendingScore.GetValue(), Score);
+    }
+    else
+    {
+        Board.PendingScore = Score;
+        Board.bPendingKeepBest = bKeepBest;
+    }
+}
+// - 3.2 - //
+void USteamStatsSubsystem::PrefetchLeaderboard(FName Leaderboard, int32 FirstRank, int32 NumRows)
+{
+    FBoard& Board = FindOrAddBoard(Leaderboard);
+    const double Now = FPlatformTime::Seconds();
+
+    for (int32 Page = SteamStats::FirstPage(FirstRank); Page <= SteamStats::LastPage(FirstRank, NumRows); ++Page)
+    {
+        const int32* Slot = Board.Pages.Find(Page);
+        if ((Slot && Now - PagePool[*Slot].FetchedAt < SteamStats::PageSeconds) || Board.PagesInFlight.Contains(Page))
+        {
+            continue;
+        }
+        else if (Board.Handle)
+        {
+            RequestPage(Leaderboard, Board, Page);
+        }
+        else
+        {
+            Board.WantedPages.AddUnique(Page);
+        }
+    }
+
+    if (!Board.Handle)
+    {
+        FindBoard(Leaderboard, Board);
+    }
+}
+// - 3.3 - //
+bool USteamStatsSubsystem::GetLeaderboardRows(FName Leaderboard, int32 FirstRank, int32 NumRows, TArray<FSteamLeaderboardRow>& OutRows)
+{
+    OutRows.Reset();
+    FirstRank = FMath::Max(FirstRank, 1);
+    if (NumRows <= 0)
+    {
+        return true;
+    }
+
+    const FBoard* Board = Boards.Find(Leaderboard);
+    const double Now = FPlatformTime::Seconds();
+    const int32 LastRank = FirstRank + NumRows - 1;
+    bool bComplete = Board != nullptr;
+
+    for (int32 Page = SteamStats::FirstPage(FirstRank); Board && Page <= SteamStats::LastPage(FirstRank, NumRows); ++Page)
+    {
+        const int32* Slot = Board->Pages.Find(Page);
+        if (!Slot)
+        {
+            bComplete = false;
+            continue;
+        }
+
+        // Stale rows still beat an empty panel while the refresh is out
+        const FPage& Cached = PagePool[*Slot];
+        bComplete &= Now - Cached.FetchedAt < SteamStats::PageSeconds;
+        for (int32 i = 0; i < Cached.NumRows; ++i)
+        {
+            if (Cached.Rows[i].GlobalRank >= FirstRank && Cached.Rows[i].GlobalRank <= LastRank)
+            {
+                OutRows.Add(Cached.Rows[i]);
+            }
+        }
+    }
+
+    if (!bComplete)
+    {
+        PrefetchLeaderboard(Leaderboard, FirstRank, NumRows);
+    }
+    return bComplete;
+}
+// - 3.4 - //
+USteamStatsSubsystem::FBoard& USteamStatsSubsystem::FindOrAddBoard(FName Name)
+{
+    if (FBoard* Existing = Boards.Find(Name))
+    {
+        return *Existing;
+    }
+
+    FBoard& Board = Boards.Add(Name);
+    Board.SteamName = SteamStats::ToAnsi(Name);
+    return Board;
+}
+
+void USteamStatsSubsystem::FindBoard(FName Leaderboard, FBoard& Board)
+{
+    ISteamBackend* Steam = GetBackend();
+    if (Board.Handle || Board.bFinding || !AsyncCalls.IsValid() || !Steam)
+    {
+        return;
+    }
+
+    Board.bFinding = true;
+    AsyncCalls->Watch<LeaderboardFindResult_t, uint64>(Steam->FindLeaderboard(Board.SteamName.GetData()), SteamStats::RequestTimeoutSeconds,
+        [](const LeaderboardFindResult_t& Found, const void* Prepared, TSteamAsyncResult<uint64>& Out)
+        {
+            Out.Value = Found.m_hSteamLeaderboard;
+            Out.SteamResult = Found.m_bLeaderboardFound ? k_EResultOK : k_EResultFileNotFound;
+            return Found.m_bLeaderboardFound != 0;
+        }).Next([this, Leaderboard](TSteamAsyncResult<uint64> Result)
+        {
+            OnBoardFound(Leaderboard, Result);
+        });
+}
+// - 3.5 - //
+void USteamStatsSubsystem::OnBoardFound(FName Leaderboard, const TSteamAsyncResult<uint64>& Result)
+{
+    FBoard* Board = Boards.Find(Leaderboard);
+    if (!Board)
+    {
+        return;
+    }
+
+    Board->bFinding = false;
+    if (Result.Status == ESteamAsyncStatus::Failed && Result.SteamResult == k_EResultFileNotFound)
+    {
+        // Steam answered, the board is not set up for this app, so the score has nowhere to go
+        UE_LOG(LogSteamMultiplayer, Warning, TEXT("Leaderboard %s does not exist, dropping its pending score."), *Leaderboard.ToString());
+        Board->PendingScore.Reset();
+        Board->bUploadWhenFound = false;
+        Board->WantedPages.Reset();
+        return;
+    }
+    else if (!Result.IsSuccess())
+    {
+        // Refused, timed out or cancelled, the next flush or prefetch asks again
+        Board->WantedPages.Reset();
+        return;
+    }
+
+    Board->Handle = Result.Value;
+    for (int32 Page : Board->WantedPages)
+    {
+        RequestPage(Leaderboard, *Board, Page);
+    }
+    Board->WantedPages.Reset();
+
+    if (Board->bUploadWhenFound && Board->PendingScore.IsSet())
+    {
+        UploadScore(Leaderboard, *Board);
+    }
+}
+// - 3.6 - //
+void USteamStatsSubsystem::UploadScore(FName Leaderboard, FBoard& Board)
+{
+    ISteamBackend* Steam = GetBackend();
+    const int32 Score = Board.PendingScore.GetValue();
+    const bool bKeepBest = Board.bPendingKeepBest;
+    Board.PendingScore.Reset();
+    Board.bUploadWhenFound = false;
+
+    const ELeaderboardUploadScoreMethod Method = bKeepBest ? k_ELeaderboardUploadScoreMethodKeepBest : k_ELeaderboardUploadScoreMethodForceUpdate;
+    AsyncCalls->Watch<LeaderboardScoreUploaded_t, int32>(Steam->UploadLeaderboardScore(Board.Handle, Method, Score), SteamStats::RequestTimeoutSeconds,
+        [this, Leaderboard](const LeaderboardScoreUploaded_t& Uploaded, const void* Prepared, TSteamAsyncResult<int32>& Out)
+        {
+            // Ranks moved, cached pages are served until their refresh lands
+            FBoard* Uploading = Boards.Find(Leaderboard);
+            if (Uploaded.m_bSuccess && Uploaded.m_bScoreChanged && Uploading)
+            {
+                for (const TPair<int32, int32>& Page : Uploading->Pages)
+                {
+                    PagePool[Page.Value].FetchedAt = 0.0;
+                }
+            }
+            Out.Value = Uploaded.m_nGlobalRankNew;
+            return Uploaded.m_bSuccess != 0;
+        }).Next([this, Leaderboard, Score, bKeepBest](TSteamAsyncResult<int32> Result)
+        {
+            // Once Steam has the call it finishes it, only a refused or failed upload goes back in the queue
+            if (Result.Status == ESteamAsyncStatus::Failed || Result.Status == ESteamAsyncStatus::IOFailure)
+            {
+                UE_LOG(LogSteamMultiplayer, Warning, TEXT("Uploading %d to leaderboard %s failed, retrying with the next flush."), Score, *Leaderboard.ToString());
+                SubmitLeaderboardScore(Leaderboard, Score, bKeepBest);
+            }
+        });
+}
+// - 3.7 - //
+void USteamStatsSubsystem::RequestPage(FName Leaderboard, FBoard& Board, int32 PageIndex)
+{
+    ISteamBackend* Steam = GetBackend();
+    if (!AsyncCalls.IsValid() || !Steam)
+    {
+        return;
+    }
+
+    const SteamAPICall_t Call = Steam->DownloadLeaderboardEntries(Board.Handle, k_ELeaderboardDataRequestGlobal, PageIndex * RowsPerPage + 1, (PageIndex + 1) * RowsPerPage);
+    Board.PagesInFlight.Add(PageIndex);
+
+    // Rows were copied out by the preparer while Steam still had them
+    AsyncCalls->Watch<LeaderboardScoresDownloaded_t, int32, FSteamLeaderboardDownload>(Call, SteamStats::RequestTimeoutSeconds,
+        [this, Leaderboard, PageIndex](const LeaderboardScoresDownloaded_t& Downloaded, const FSteamLeaderboardDownload* Download, TSteamAsyncResult<int32>& Out)
+        {
+            if (!Download)
+            {
+                return false;
+            }
+            StorePage(Leaderboard, PageIndex, Download->Rows);
+            Out.Value = Download->Rows.Num();
+            return true;
+        }).Next([this, Leaderboard, PageIndex](TSteamAsyncResult<int32> Result)
+        {
+            if (FBoard* Requested = Boards.Find(Leaderboard))
+            {
+                Requested->PagesInFlight.Remove(PageIndex);
+            }
+            if (Result.IsSuccess())
+            {
+                OnLeaderboardRowsCached.Broadcast(Leaderboard, PageIndex * RowsPerPage + 1, Result.Value);
+            }
+        });
+}
+// - 3.8 - //
+void USteamStatsSubsystem::StorePage(FName Leaderboard, int32 PageIndex, const TArray<FSteamLeaderboardRow>& Rows)
+{
+    STEAM_MP_SCOPE(STAT_SteamLeaderboardPage);
+
+    FBoard* Board = Boards.Find(Leaderboard);
+    if (!Board)
+    {
+        return;
+    }
+
+    const int32* Existing = Board->Pages.Find(PageIndex);
+    const int32 Slot = Existing ? *Existing : AllocatePage();
+    FPage& Page = PagePool[Slot];
+    Page.Leaderboard = Leaderboard;
+    Page.PageIndex = PageIndex;
+    Page.FetchedAt = FPlatformTime::Seconds();
+    Page.NumRows = FMath::Min(Rows.Num(), RowsPerPage);
+    FMemory::Memcpy(Page.Rows, Rows.GetData(), Page.NumRows * sizeof(FSteamLeaderboardRow));
+    Board->Pages.Add(PageIndex, Slot);
+
+    SET_DWORD_STAT(STAT_SteamLeaderboardPages, PagePool.Num());
+}
+
+int32 USteamStatsSubsystem::AllocatePage()
+{
+    if (PagePool.Num() < MaxPages)
+    {
+        return PagePool.AddDefaulted();
+    }
+
+    int32 Oldest = 0;
+    for (int32 i = 1; i < PagePool.Num(); ++i)
+    {
+        Oldest = PagePool[i].FetchedAt < PagePool[Oldest].FetchedAt ? i : Oldest;
+    }
+
+    if (FBoard* Owner = Boards.Find(PagePool[Oldest].Leaderboard))
+    {
+        Owner->Pages.Remove(PagePool[Oldest].PageIndex);
+    }
+    return Oldest;
+}
+// - 3.9 - //
+void USteamStatsSubsystem::PrepareLeaderboardDownload(ISteamBackend& Steam, const LeaderboardScoresDownloaded_t& Callback, FSteamLeaderboardDownload& OutDownload)
+{
+    OutDownload.Rows.Reserve(Callback.m_cEntryCount);
+    for (int32 i = 0; i < Callback.m_cEntryCount; ++i)
+    {
+        LeaderboardEntry_t Entry;
+        if (Steam.GetDownloadedLeaderboardEntry(Callback.m_hSteamLeaderboardEntries, i, &Entry))
+        {
+            FSteamLeaderboardRow& Row = OutDownload.Rows.AddDefaulted_GetRef();
+            Row.GlobalRank = Entry.m_nGlobalRank;
+            Row.Score = Entry.m_nScore;
+            Row.SteamID = Entry.m_steamIDUser.ConvertToUint64();
+        }
+    }
+}
+/////////////////////////
+// 4. Flushing        //
+////////////////////////////////////////////
+// 4.1 - Ask for a flush                 //
+// 4.2 - Rate-limited tick              //
+// 4.3 - Flush                         //
+// 4.4 - Callback: Stats stored       //
+// 4.5 - Pending writes              //
+//////////////////////////////////////
+// - 4.1 - //
+void USteamStatsSubsystem::FlushStats()
+{
+    bFlushRequested = true;
+}
+
+void USteamStatsSubsystem::FlushNow()
+{
+    Flush();
+}
+// - 4.2 - //
+bool USteamStatsSubsystem::Tick(float DeltaTime)
+{
+    USteamMultiplayer* Multiplayer = GetMultiplayer();
+    ISteamBackend* Steam = Multiplayer ? Multiplayer->GetSteamBackend() : nullptr;
+    if (!Steam || !Steam->IsRunning())
+    {
+        return true;
+    }
+
+    const double Now = FPlatformTime::Seconds();
+    if (!bStatsReady && Now - StatsRequestTime >= SteamStats::StatsRetrySeconds)
+    {
+        StatsRequestTime = Now;
+        Steam->RequestCurrentStats();
+    }
+
+    const int32 NumPending = GetNumPendingWrites();
+    const double Gap = bFlushRequested ? SteamStats::MinFlushGapSeconds : Multiplayer->StatsFlushIntervalSeconds;
+    if ((NumPending > 0 || bStoreRetry) && Now - LastFlushTime >= Gap)
+    {
+        Flush();
+    }
+    SET_DWORD_STAT(STAT_SteamStatsPendingWrites, GetNumPendingWrites());
+    return true;
+}
+// - 4.3 - //
+void USteamStatsSubsystem::Flush()
+{
+    STEAM_MP_SCOPE(STAT_SteamStatsFlush);
+
+    ISteamBackend* Steam = GetBackend();
+    LastFlushTime = FPlatformTime::Seconds();
+    bFlushRequested = false;
+    if (!bStarted || !Steam || !Steam->IsRunning())
+    {
+        return;
+    }
+
+    // Stats wait for UserStatsReceived_t, Steam would refuse them before
+    if (bStatsReady)
+    {
+        int32 NumWritten = 0;
+        for (const FName& Name : DirtyStats)
+        {
+            FStat& Stat = Stats.FindChecked(Name);
+            const double Value = Stat.GetValue();
+            const bool bWritten = Stat.bFloat ? Steam->SetStatFloat(Stat.SteamName.GetData(), (float)Value) : Steam->SetStatInt(Stat.SteamName.GetData(), FMath::RoundToInt32(Value));
+            if (bWritten)
+            {
+                ++NumWritten;
+                Stat.SteamValue = Value;
+            }
+            else
+            {
+                // Our mirror goes back to whatever Steam still holds, not the value it refused
+                UE_LOG(LogSteamMultiplayer, Warning, TEXT("Steam refused stat %s, dropping the write."), *Name.ToString());
+                SteamStats::ReadValue(*Steam, Stat.SteamName.GetData(), Stat.bFloat, Stat.SteamValue);
+            }
+            Stat.Pending = 0.0;
+            Stat.bPendingSet = false;
+            Stat.bDirty = false;
+        }
+        DirtyStats.Reset();
+
+        for (const FName& Name : DirtyAchievements)
+        {
+            FAchievement& Achievement = Achievements.FindChecked(Name);
+            NumWritten += Steam->SetAchievement(Achievement.SteamName.GetData()) ? 1 : 0;
+            Achievement.bDirty = false;
+        }
+        DirtyAchievements.Reset();
+
+        if (NumWritten > 0 || bStoreRetry)
+        {
+            bStoreRetry = !Steam->StoreStats();
+            ++NumStores;
+            SET_DWORD_STAT(STAT_SteamStatsStores, NumStores);
+        }
+    }
+
+    // One upload per board per flush, however many scores were submitted
+    for (TPair<FName, FBoard>& Pair : Boards)
+    {
+        FBoard& Board = Pair.Value;
+        if (!Board.PendingScore.IsSet())
+        {
+            continue;
+        }
+        else if (Board.Handle)
+        {
+            UploadScore(Pair.Key, Board);
+        }
+        else
+        {
+            Board.bUploadWhenFound = true;
+            FindBoard(Pair.Key, Board);
+        }
+    }
+}
+// - 4.4 - //
+void USteamStatsSubsystem::OnUserStatsStored(UserStatsStored_t* pCallback)
+{
+    if (!bStarted)
+    {
+        return;
+    }
+
+    const bool bSuccess = pCallback->m_eResult == k_EResultOK;
+    if (pCallback->m_eResult == k_EResultInvalidParam)
+    {
+        // Some values broke the stat's limits, Steam reverted those and kept the rest
+        UE_LOG(LogSteamMultiplayer, Warning, TEXT("Steam rejected some stat values and reverted them."));
+        if (ISteamBackend* Steam = GetBackend())
+        {
+            ReadSteamValues(*Steam);
+        }
+    }
+    else if (!bSuccess)
+    {
+        UE_LOG(LogSteamMultiplayer, Warning, TEXT("Storing stats failed (%d), retrying with the next flush."), (int32)pCallback->m_eResult);
+        bStoreRetry = true;
+    }
+    OnStatsStored.Broadcast(bSuccess);
+}
+// - 4.5 - //
+int32 USteamStatsSubsystem::GetNumPendingWrites() const
+{
+    int32 NumPending = DirtyStats.Num() + DirtyAchievements.Num();
+    for (const TPair<FName, FBoard>& Pair : Boards)
+    {
+        NumPending += Pair.Value.PendingScore.IsSet() ? 1 : 0;
+    }
+    return NumPending;
+}
+///////////////////////////////////////////
+// MORE COMING SOON  // A.S. - hajddeen //
+/////////////////////////////////////////
@@ -0,0 +1,284 @@
+// |------------------------------------|
+// |  !FOLLOW URBAN SHADOWS ON SOCIALS! |
+// |------------------------------------|
+//            \ (^ᴗ^) /
+//             \     /
+//              -----
+//              |   |
+//              |   |
+//              |_  |_ 
+////////////////////////////////////////////////////////////
+// STEAM P2P SESSIONS - Unreal 5.5 + Steamworks SDK 1.57 //
+//////////////////////////////////////////////////////////////////
+// LICENSE AGREEMENT // LICENSE AGREEMENT // LICENSE AGREEMENT //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                                                                                                                                                                                                                                          //
+// Last Updated: 03/12/2024                                                                                                                                                                                                                                //
+//                                                                                                                                                                                                                                                        //
+// 1. Grant of License                                                                                                                                                                                                                                   //
+// This license permits anyone to use, modify, and distribute the provided code (the "Code") in projects free of charge under the following conditions:                                                                                                 //
+// 1.1. The Code must only be used for lawful purposes.                                                                                                                                                                                                //
+// 1.2. The user must include proper credit in their project as described in Section 3 below.                                                                                                                                                         //
+//                                                                                                                                                                                                                                                   //
+// 2. Restrictions                                                                                                                                                                                                                                  //
+// 2.1. This Code cannot be sold, sublicensed, or redistributed as a standalone product or as part of a similar development toolkit.                                                                                                               //
+// 2.2. The Code must not be used for projects that violate local laws or promote harmful, discriminatory, or illegal activities.                                                                                                                 //
+// 2.3. The user must not remove, alter, or obscure this license agreement, attribution requirements, or copyright notices within the Code.                                                                                                      //
+//                                                                                                                                                                                                                                              //
+// 3. Attribution                                                                                                                                                                                                                              //
+// 3.1. The user must include the following credit in a visible location within their project (e.g., splash screen, credits screen, or documentation):                                                                                        //
+// "Steam Multiplayer Code developed by Adrian Szajewski. Used under license."                                                                                                                                                               //
+// 3.2. For distributed or published projects, a link to https://adrianszajewskidev.wordpress.com/ or other contact details must also be included if applicable.                                                                            //
+//                                                                                                                                                                                                                                         //
+// 4. Breach of Agreement                                                                                                                                                                                                                 //
+// 4.1. If this license is violated, the licensor reserves the right to revoke the user's rights to use the Code immediately.                                                                                                            //
+// 4.2. The licensor may take legal action to recover damages or enforce compliance, depending on the severity of the violation.                                                                                                        //
+// 4.3. Users found in breach of this license may be required to:                                                                                                                                                                      //
+// Remove the Code from their project(s).                                                                                                                                                                                             //
+// Cease distribution of any projects using the Code.                                                                                                                                                                                //
+//                                                                                                                                                                                                                                  //
+// 5. Disclaimer                                                                                                                                                                                                                   //
+// 5.1. The Code is provided "as is" without any warranty, express or implied. The licensor is not liable for any damages arising from the use or misuse of the Code.                                                             //
+// 5.2. It is the user's responsibility to ensure compatibility and safe usage of the Code in their projects.                                                                                                                    //
+//                                                                                                                                                                                                                              //
+// 6. Governing Law                                                                                                                                                                                                            //
+// This agreement shall be governed and construed in accordance with the laws of Poland. Any disputes arising under or in connection with this license will be subject to the exclusive jurisdiction of the courts of Poland. //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+/////////////////////////////////////////////////////////
+// INCLUDE //
+////////////
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Containers/Ticker.h"
+#include "steam/steam_api.h"
+#include "steam/isteamuserstats.h"
+#include "SteamBackend.h"
+#include "SteamAsync.h"
+#include "SteamStats.generated.h"
+
+class USteamMultiplayer;
+
+/////////////////////////////////////////////////////////////////////////////////////
+// STEAM STATS - NOTES                                                             //
+/////////////////////////////////////////////////////////////////////////////////////
+// 1. Gameplay only writes the local cache. Increments to one stat coalesce       //
+//    into a single delta, scores keep the best one per leaderboard.             //
+// 2. A flush sets every dirty stat and achievement, then calls StoreStats      //
+//    once. Flushes are StatsFlushIntervalSeconds apart, FlushStats brings     //
+//    the next one forward but never closer than MinFlushGapSeconds.          //
+// 3. Before UserStatsReceived_t nothing is written, deltas wait and land    //
+//    on top of whatever Steam had.                                         //
+// 4. Leaderboard rows sit in fixed pages of global ranks, fetched ahead   //
+//    asynchronously, reused until they go stale, oldest page evicted.    //
+// 5. ShutdownSteam flushes one last time, ignoring the rate limit.      //
+//////////////////////////////////////////////////////////////////////////
+
+USTRUCT(BlueprintType)
+struct FSteamLeaderboardRow
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Steam|Stats")
+    int32 GlobalRank = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Steam|Stats")
+    int32 Score = 0;
+
+    UPROPERTY()
+    uint64 SteamID = 0;
+};
+
+// Rows read by the call result preparer, Steam frees the entries once the callback returns
+struct FSteamLeaderboardDownload
+{
+    TArray<FSteamLeaderboardRow> Rows;
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnSteamStatsStored, bool, bSuccess);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnLeaderboardRowsCached, FName, Leaderboard, int32, FirstRank, int32, NumRows);
+////////////////
+// MAIN BODY //
+////////////////
+UCLASS()
+class URBANSHADOWS_API USteamStatsSubsystem : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    static constexpr int32 RowsPerPage = 50;
+    static constexpr int32 MaxPages = 64;
+
+    //////////////////////////////////////////////
+    // 1. Subsystem Lifecycle                  //
+    ////////////////////////////////////////////
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+    virtual void Deinitialize() override;
+
+    // Called by USteamMultiplayer once Steam is up and right before it shuts down, stopping flushes first
+    void StartStats();
+    void StopStats();
+
+    //////////////////////////////////////////////
+    // 2. Stats + Achievements                 //
+    ////////////////////////////////////////////
+    UFUNCTION(BlueprintCallable, Category = "Steam|Stats")
+    void IncrementStat(FName Name, int32 Delta = 1);
+
+    UFUNCTION(BlueprintCallable, Category = "Steam|Stats")
+    void AddToStatFloat(FName Name, float Delta);
+
+    UFUNCTION(BlueprintCallable, Category = "Steam|Stats")
+    void SetStatInt(FName Name, int32 Value);
+
+    UFUNCTION(BlueprintCallable, Category = "Steam|Stats")
+    void SetStatFloat(FName Name, float Value);
+
+    // Steam's value plus whatever still waits for a flush, pending deltas alone until Steam sent the stats
+    UFUNCTION(BlueprintPure, Category = "Steam|Stats")
+    int32 GetStatInt(FName Name) const;
+
+    UFUNCTION(BlueprintPure, Category = "Steam|Stats")
+    float GetStatFloat(FName Name) const;
+
+    UFUNCTION(BlueprintCallable, Category = "Steam|Stats")
+    void UnlockAchievement(FName Name);
+
+    UFUNCTION(BlueprintPure, Category = "Steam|Stats")
+    bool IsAchievementUnlocked(FName Name) const;
+
+    UFUNCTION(BlueprintPure, Category = "Steam|Stats")
+    bool AreStatsReady() const { return bStatsReady; }
+
+    //////////////////////////////////////////////
+    // 3. Leaderboards                         //
+    ////////////////////////////////////////////
+    // Coalesced until the next flush. bKeepBest keeps the highest score submitted meanwhile, otherwise the last one wins
+    UFUNCTION(BlueprintCallable, Category = "Steam|Stats")
+    void SubmitLeaderboardScore(FName Leaderboard, int32 Score, bool bKeepBest = true);
+
+    // Fetches the pages covering [FirstRank, FirstRank + NumRows) that are missing or stale
+    UFUNCTION(BlueprintCallable, Category = "Steam|Stats")
+    void PrefetchLeaderboard(FName Leaderboard, int32 FirstRank = 1, int32 NumRows = 50);
+
+    // Cached rows only, never waits. False when part of the range was missing or stale, that part gets prefetched
+    UFUNCTION(BlueprintCallable, Category = "Steam|Stats")
+    bool GetLeaderboardRows(FName Leaderboard, int32 FirstRank, int32 NumRows, TArray<FSteamLeaderboardRow>& OutRows);
+
+    // A page landed, rows [FirstRank, FirstRank + NumRows) are cached
+    UPROPERTY(BlueprintAssignable, Category = "Steam|Stats")
+    FOnLeaderboardRowsCached OnLeaderboardRowsCached;
+
+    // Thread-safe part of a leaderboard download, run by the call result preparer
+    static void PrepareLeaderboardDownload(ISteamBackend& Steam, const LeaderboardScoresDownloaded_t& Callback, FSteamLeaderboardDownload& OutDownload);
+
+    //////////////////////////////////////////////
+    // 4. Flushing                             //
+    ////////////////////////////////////////////
+    // Next flush as soon as the rate limit allows, e.g. at match end
+    UFUNCTION(BlueprintCallable, Category = "Steam|Stats")
+    void FlushStats();
+
+    // Right now, ignoring the rate limit. ShutdownSteam does this
+    void FlushNow();
+
+    // Stats, achievements and scores waiting for a flush
+    UFUNCTION(BlueprintPure, Category = "Steam|Stats")
+    int32 GetNumPendingWrites() const;
+
+    UPROPERTY(BlueprintAssignable, Category = "Steam|Stats")
+    FOnSteamStatsStored OnStatsStored;
+
+private:
+    //////////////////////////////////////////////
+    // 1. Private Data Members                 //
+    ////////////////////////////////////////////
+    struct FStat
+    {
+        TArray<ANSICHAR> SteamName; // Converted once, on first use
+        double SteamValue = 0.0;    // Last value read from or written to Steam
+        double Pending = 0.0;       // Delta, or the value itself when bPendingSet
+        bool bFloat = false;
+        bool bPendingSet = false;
+        bool bDirty = false;
+
+        double GetValue() const { return bPendingSet ? Pending : SteamValue + Pending; }
+    };
+
+    struct FAchievement
+    {
+        TArray<ANSICHAR> SteamName;
+        bool bUnlocked = false;
+        bool bDirty = false;
+    };
+
+    struct FPage
+    {
+        FName Leaderboard;
+        int32 PageIndex = INDEX_NONE;
+        double FetchedAt = 0.0;
+        int32 NumRows = 0; // Short past the end of the board
+        FSteamLeaderboardRow Rows[RowsPerPage];
+    };
+
+    struct FBoard
+    {
+        TArray<ANSICHAR> SteamName;
+        SteamLeaderboard_t Handle = 0;
+        bool bFinding = false;
+        TOptional<int32> PendingScore;
+        bool bPendingKeepBest = true;
+        bool bUploadWhenFound = false; // A flush wanted the score out before the handle was known
+        TMap<int32, int32> Pages;      // Page index -> slot in PagePool
+        TArray<int32, TInlineAllocator<4>> PagesInFlight;
+        TArray<int32, TInlineAllocator<4>> WantedPages; // Asked for before the handle was known
+    };
+
+    bool bStarted = false;
+    bool bStatsReady = false;
+    bool bFlushRequested = false;
+    bool bStoreRetry = false; // Last StoreStats failed, Steam still holds the values for the next one
+    double StatsRequestTime = 0.0;
+    double LastFlushTime = 0.0;
+    int32 NumStores = 0;
+
+    TMap<FName, FStat> Stats;
+    TMap<FName, FAchievement> Achievements;
+    mutable TMap<FName, TArray<ANSICHAR>> ReadNames; // Stats and achievements only ever read, converted on first read
+    TArray<FName> DirtyStats;
+    TArray<FName> DirtyAchievements;
+    TMap<FName, FBoard> Boards;
+    TArray<FPage> PagePool; // Grows up to MaxPages, then the oldest page is reused
+
+    TUniquePtr<FSteamAsyncCalls> AsyncCalls; // Gone before the backend
+    FTSTicker::FDelegateHandle FlushTicker;
+
+    // Manual dispatch: STEAM_CALLBACK never fires, the callbacks come through the backend router
+    ISteamBackend* RoutedBackend = nullptr;
+    FSteamCallbackRouter::FHandle StatsReceivedHandle = 0;
+    FSteamCallbackRouter::FHandle StatsStoredHandle = 0;
+
+    //////////////////////////////////////////////
+    // 2. Private Functions                    //
+    ////////////////////////////////////////////
+    USteamMultiplayer* GetMultiplayer() const;
+    ISteamBackend* GetBackend() const;
+    bool Tick(float DeltaTime);
+    void Flush();
+    FStat& FindOrAddStat(FName Name, bool bFloat);
+    const char* FindOrAddReadName(FName Name) const;
+    FBoard& FindOrAddBoard(FName Name);
+    void ReadSteamValues(ISteamBackend& Steam);
+    void FindBoard(FName Leaderboard, FBoard& Board);
+    void OnBoardFound(FName Leaderboard, const TSteamAsyncResult<uint64>& Result);
+    void UploadScore(FName Leaderboard, FBoard& Board);
+    void RequestPage(FName Leaderboard, FBoard& Board, int32 PageIndex);
+    void StorePage(FName Leaderboard, int32 PageIndex, const TArray<FSteamLeaderboardRow>& Rows);
+    int32 AllocatePage();
+
+    STEAM_CALLBACK(USteamStatsSubsystem, OnUserStatsReceived, UserStatsReceived_t);
+    STEAM_CALLBACK(USteamStatsSubsystem, OnUserStatsStored, UserStatsStored_t);
+};
+///////////////////////////////////////////
+// MORE COMING SOON  // A.S. - hajddeen //
+/////////////////////////////////////////
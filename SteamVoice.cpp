@@ -0,0 +1,705 @@
+// |------------------------------------|
+// |  !FOLLOW URBAN SHADOWS ON SOCIALS! |
+// |------------------------------------|
+//            \ (^ᴗ^) /
+//             \     /
+//              -----
+//              |   |
+//              |   |
+//              |_  |_
+////////////////////////////////////////////////////////////
+// STEAM P2P SESSIONS - Unreal 5.5 + Steamworks SDK 1.57 //
+//////////////////////////////////////////////////////////////////
+// LICENSE AGREEMENT // LICENSE AGREEMENT // LICENSE AGREEMENT //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                                                                                                                                                                                                                                          //
+// Last Updated: 03/12/2024                                                                                                                                                                                                                                //
+//                                                                                                                                                                                                                                                        //
+// 1. Grant of License                                                                                                                                                                                                                                   //
+// This license permits anyone to use, modify, and distribute the provided code (the "Code") in projects free of charge under the following conditions:                                                                                                 //
+// 1.1. The Code must only be used for lawful purposes.                                                                                                                                                                                                //
+// 1.2. The user must include proper credit in their project as described in Section 3 below.                                                                                                                                                         //
+//                                                                                                                                                                                                                                                   //
+// 2. Restrictions                                                                                                                                                                                                                                  //
+// 2.1. This Code cannot be sold, sublicensed, or redistributed as a standalone product or as part of a similar development toolkit.                                                                                                               //
+// 2.2. The Code must not be used for projects that violate local laws or promote harmful, discriminatory, or illegal activities.                                                                                                                 //
+// 2.3. The user must not remove, alter, or obscure this license agreement, attribution requirements, or copyright notices within the Code.                                                                                                      //
+//                                                                                                                                                                                                                                              //
+// 3. Attribution                                                                                                                                                                                                                              //
+// 3.1. The user must include the following credit in a visible location within their project (e.g., splash screen, credits screen, or documentation):                                                                                        //
+// "Steam Multiplayer Code developed by Adrian Szajewski. Used under license."                                                                                                                                                               //
+// 3.2. For distributed or published projects, a link to https://adrianszajewskidev.wordpress.com/ or other contact details must also be included if applicable.                                                                            //
+//                                                                                                                                                                                                                                         //
+// 4. Breach of Agreement                                                                                                                                                                                                                 //
+// 4.1. If this license is violated, the licensor reserves the right to revoke the user's rights to use the Code immediately.                                                                                                            //
+// 4.2. The licensor may take legal action to recover damages or enforce compliance, depending on the severity of the violation.                                                                                                        //
+// 4.3. Users found in breach of this license may be required to:                                                                                                                                                                      //
+// Remove the Code from their project(s).                                                                                                                                                                                             //
+// Cease distribution of any projects using the Code.                                                                                                                                                                                //
+//                                                                                                                                                                                                                                  //
+// 5. Disclaimer                                                                                                                                                                                                                   //
+// 5.1. The Code is provided "as is" without any warranty, express or implied. The licensor is not liable for any damages arising from the use or misuse of the Code.                                                             //
+// 5.2. It is the user's responsibility to ensure compatibility and safe usage of the Code in their projects.                                                                                                                    //
+//                                                                                                                                                                                                                              //
+// 6. Governing Law                                                                                                                                                                                                            //
+// This agreement shall be governed and construed in accordance with the laws of Poland. Any disputes arising under or in connection with this license will be subject to the exclusive jurisdiction of the courts of Poland. //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////
+// INCLUDE //
+////////////
+#include "SteamVoice.h"
+#include "SteamMultiplayerStats.h"
+#include "Components/AudioComponent.h"
+#include "Kismet/GameplayStatics.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+/////////////////////////////
+// Steam Voice - Internals //
+//////////////////////////////////////////////////////////////////////
+// 1. Batch: [version][frame count] then per frame [seq][size][data] //
+// 2. Sequences are per sender, older frames than the last are late  //
+// 3. Talker slots go to whoever spoke least recently when full      //
+/////////////////////////////////////////////////////////////////////
+namespace SteamVoice
+{
+    constexpr uint8 BatchVersion = 1;
+    constexpr int32 Channel = 7;            // ISteamNetworkingMessages channel, gameplay uses sockets
+    constexpr int32 SendFlags = k_nSteamNetworkingSend_UnreliableNoNagle | k_nSteamNetworkingSend_AutoRestartBrokenSession;
+    constexpr float CapturePeriodMs = 10.f; // Worker poll, also the longest a queued frame waits for decode
+    constexpr float JitterMs = 60.f;
+    constexpr float MaxBufferedMs = 250.f;
+    constexpr float RingSeconds = 0.5f;     // PCM per talker slot
+    constexpr int32 CaptureBytes = 8192;    // Steam's suggested GetVoice buffer
+    constexpr int32 MaxCaptureBytes = 65536; // Past this a capture or reassembly is dropped
+    constexpr double TalkingSeconds = 0.25; // Heard this recently = talking
+    constexpr double SlotIdleSeconds = 2.0; // Quiet this long = slot may go to someone else
+
+    // Sequence A came after B, wrap-around safe
+    bool IsNewer(uint16 A, uint16 B)
+    {
+        return (int16)(A - B) > 0;
+    }
+}
+/////////////////////////
+// 1. PCM Ring        //
+///////////////////////////////////////
+// 1.1 - Allocate the ring          //
+// 1.2 - Buffered samples          //
+// 1.3 - Write (worker)           //
+// 1.4 - Mix + skip (audio)      //
+//////////////////////////////////
+// - 1.1 - //
+void FSteamVoicePcmRing::Init(int32 MinCapacity)
+{
+    const uint32 Capacity = FMath::RoundUpToPowerOfTwo((uint32)FMath::Max(MinCapacity, 2));
+    Samples.SetNumZeroed(Capacity);
+    Mask = Capacity - 1;
+    Head.store(0, std::memory_order_relaxed);
+    Tail.store(0, std::memory_order_relaxed);
+}
+// - 1.2 - //
+int32 FSteamVoicePcmRing::Num() const
+{
+    return (int32)(Head.load(std::memory_order_acquire) - Tail.load(std::memory_order_acquire));
+}
+// - 1.3 - //
+int32 FSteamVoicePcmRing::Write(const int16* InSamples, int32 NumSamples)
+{
+    const uint32 WriteIndex = Head.load(std::memory_order_relaxed);
+    const uint32 Free = (uint32)Samples.Num() - (WriteIndex - Tail.load(std::memory_order_acquire));
+    const uint32 Count = FMath::Min((uint32)NumSamples, Free);
+
+    // At most two copies, the second one after wrapping
+    const uint32 Start = WriteIndex & Mask;
+    const uint32 First = FMath::Min(Count, (uint32)Samples.Num() - Start);
+    FMemory::Memcpy(Samples.GetData() + Start, InSamples, First * sizeof(int16));
+    FMemory::Memcpy(Samples.GetData(), InSamples + First, (Count - First) * sizeof(int16));
+
+    Head.store(WriteIndex + Count, std::memory_order_release);
+    return (int32)Count;
+}
+// - 1.4 - //
+int32 FSteamVoicePcmRing::MixInto(int32* Accumulator, int32 NumSamples)
+{
+    const uint32 ReadIndex = Tail.load(std::memory_order_relaxed);
+    const uint32 Count = FMath::Min((uint32)NumSamples, Head.load(std::memory_order_acquire) - ReadIndex);
+    for (uint32 i = 0; i < Count; ++i)
+    {
+        Accumulator[i] += Samples[(ReadIndex + i) & Mask];
+    }
+
+    Tail.store(ReadIndex + Count, std::memory_order_release);
+    return (int32)Count;
+}
+
+void FSteamVoicePcmRing::Skip(int32 NumSamples)
+{
+    const uint32 ReadIndex = Tail.load(std::memory_order_relaxed);
+    const uint32 Count = FMath::Min((uint32)NumSamples, Head.load(std::memory_order_acquire) - ReadIndex);
+    Tail.store(ReadIndex + Count, std::memory_order_release);
+}
+/////////////////////////
+// 2. Mixer           //
+///////////////////////////////////////////
+// 2.1 - Constructor                    //
+// 2.2 - Hand a slot to a talker       //
+// 2.3 - Decoded PCM in (worker)      //
+// 2.4 - Mix active talkers (audio)  //
+//////////////////////////////////////
+// - 2.1 - //
+FSteamVoiceMixer::FSteamVoiceMixer(uint32 InSampleRate, float JitterMs, float MaxBufferedMs)
+    : SampleRate(InSampleRate)
+    , JitterSamples(FMath::CeilToInt(InSampleRate * JitterMs / 1000.f))
+    , MaxBufferedSamples(FMath::CeilToInt(InSampleRate * MaxBufferedMs / 1000.f))
+{
+}
+// - 2.2 - //
+void FSteamVoiceMixer::AcquireSlot(int32 Slot)
+{
+    // Pooled: a slot handed to a new talker keeps its ring, the old talker's tail has long played out
+    FTalker& Talker = Talkers[Slot];
+    if (!Talker.bReady.load(std::memory_order_acquire))
+    {
+        Talker.Ring.Init(FMath::CeilToInt(SampleRate * SteamVoice::RingSeconds));
+        Talker.bReady.store(true, std::memory_order_release);
+    }
+}
+// - 2.3 - //
+void FSteamVoiceMixer::Push(int32 Slot, const int16* InSamples, int32 NumSamples)
+{
+    FTalker& Talker = Talkers[Slot];
+    if (Talker.bReady.load(std::memory_order_acquire) && Talker.Ring.Write(InSamples, NumSamples) > 0)
+    {
+        ActiveTalkers.fetch_or(1ull << Slot, std::memory_order_release);
+    }
+}
+// - 2.4 - //
+void FSteamVoiceMixer::Mix(int16* Out, int32 NumSamples)
+{
+    STEAM_MP_SCOPE(STAT_SteamVoiceMix);
+
+    // Grows on the first callbacks only, the renderer asks for the same block size every time
+    if (Accumulator.Num() < NumSamples)
+    {
+        Accumulator.SetNumUninitialized(NumSamples);
+    }
+    FMemory::Memzero(Accumulator.GetData(), NumSamples * sizeof(int32));
+
+    uint64 Active = ActiveTalkers.load(std::memory_order_acquire);
+    while (Active != 0)
+    {
+        const int32 Slot = (int32)FMath::CountTrailingZeros64(Active);
+        const uint64 Bit = 1ull << Slot;
+        Active &= Active - 1;
+
+        // Jitter buffer: hold a talker back until JitterSamples are queued, then play until dry
+        FTalker& Talker = Talkers[Slot];
+        const int32 Buffered = Talker.Ring.Num();
+        if (!Talker.bPrimed && Buffered < JitterSamples)
+        {
+            continue;
+        }
+        else if (Buffered > MaxBufferedSamples)
+        {
+            Talker.Ring.Skip(Buffered - JitterSamples);
+        }
+
+        Talker.bPrimed = true;
+        if (Talker.Ring.MixInto(Accumulator.GetData(), NumSamples) < NumSamples)
+        {
+            // Ran dry, re-prime. Re-check after clearing so a Push racing us keeps its bit
+            Talker.bPrimed = false;
+            ActiveTalkers.fetch_and(~Bit, std::memory_order_acq_rel);
+            if (Talker.Ring.Num() > 0)
+            {
+                ActiveTalkers.fetch_or(Bit, std::memory_order_release);
+            }
+        }
+    }
+
+    for (int32 i = 0; i < NumSamples; ++i)
+    {
+        Out[i] = (int16)FMath::Clamp(Accumulator[i], (int32)MIN_int16, (int32)MAX_int16);
+    }
+}
+/////////////////////////
+// 3. Worker Thread   //
+///////////////////////////////////////
+// 3.1 - Constructor / destructor   //
+// 3.2 - Thread loop               //
+// 3.3 - Capture with GetVoice    //
+// 3.4 - Decode received frames  //
+// 3.5 - Decompress one capture //
+/////////////////////////////////
+// - 3.1 - //
+FSteamVoiceWorker::FSteamVoiceWorker(TSharedRef<FSteamVoiceMixer, ESPMode::ThreadSafe> InMixer)
+    : Captured(64), Received(256), Mixer(InMixer), WakeEvent(FPlatformProcess::GetSynchEventFromPool())
+{
+    CaptureScratch.SetNumUninitialized(SteamVoice::CaptureBytes);
+    Reassembly.Reserve(SteamVoice::CaptureBytes);
+    // Half a second of PCM at the optimal rate, Decompress grows it if Steam asks for more
+    Decoded.SetNumUninitialized(FMath::Max(Mixer->GetSampleRate() / 2, 4096));
+}
+
+FSteamVoiceWorker::~FSteamVoiceWorker()
+{
+    FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+}
+// - 3.2 - //
+uint32 FSteamVoiceWorker::Run()
+{
+    while (!bStopping.load(std::memory_order_acquire))
+    {
+        WakeEvent->Wait(FTimespan::FromMilliseconds(SteamVoice::CapturePeriodMs));
+        Capture();
+        Decode();
+    }
+    return 0;
+}
+
+void FSteamVoiceWorker::Stop()
+{
+    bStopping.store(true, std::memory_order_release);
+    WakeEvent->Trigger();
+}
+
+void FSteamVoiceWorker::Wake()
+{
+    WakeEvent->Trigger();
+}
+// - 3.3 - //
+void FSteamVoiceWorker::Capture()
+{
+    // NotRecording while push to talk is released, that is the cheap common case
+    uint32 Available = 0;
+    while (SteamUser()->GetAvailableVoice(&Available) == k_EVoiceResultOK && Available > 0)
+    {
+        if ((int32)Available > CaptureScratch.Num())
+        {
+            CaptureScratch.SetNumUninitialized(FMath::Min((int32)Available, SteamVoice::MaxCaptureBytes));
+        }
+
+        uint32 Written = 0;
+        const EVoiceResult Result = SteamUser()->GetVoice(true, CaptureScratch.GetData(), CaptureScratch.Num(), &Written);
+        if (Result == k_EVoiceResultBufferTooSmall)
+        {
+            // Nothing was consumed, grow and try again or voice stays stuck behind this capture
+            if (CaptureScratch.Num() >= SteamVoice::MaxCaptureBytes)
+            {
+                return;
+            }
+            CaptureScratch.SetNumUninitialized(FMath::Min(CaptureScratch.Num() * 2, SteamVoice::MaxCaptureBytes));
+            continue;
+        }
+        else if (Result != k_EVoiceResultOK || Written == 0)
+        {
+            return;
+        }
+
+        // Split into fixed frames, the receiver joins them back before DecompressVoice
+        for (uint32 Offset = 0; Offset < Written; Offset += Frame.Size)
+        {
+            Frame.Size = (uint16)FMath::Min<uint32>(Written - Offset, FSteamVoiceFrame::MaxBytes);
+            Frame.bMore = Offset + Frame.Size < Written;
+            Frame.Sequence = NextSequence++;
+            FMemory::Memcpy(Frame.Data, CaptureScratch.GetData() + Offset, Frame.Size);
+            if (!Captured.Enqueue(Frame))
+            {
+                DroppedFrames.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }
+}
+// - 3.4 - //
+void FSteamVoiceWorker::Decode()
+{
+    while (Received.Dequeue(Frame))
+    {
+        // A lost or foreign fragment breaks the capture being joined, it would not decode
+        if (Reassembly.Num() > 0 && (Frame.TalkerSlot != ReassemblySlot || Frame.Sequence != ReassemblyNext))
+        {
+            Reassembly.Reset();
+            DroppedFrames.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        if (!Frame.bMore && Reassembly.Num() == 0)
+        {
+            Decompress(Frame.TalkerSlot, Frame.Data, Frame.Size);
+        }
+        else if (Reassembly.Num() + Frame.Size > SteamVoice::MaxCaptureBytes)
+        {
+            Reassembly.Reset();
+            DroppedFrames.fetch_add(1, std::memory_order_relaxed);
+        }
+        else
+        {
+            Reassembly.Append(Frame.Data, Frame.Size);
+            ReassemblySlot = Frame.TalkerSlot;
+            ReassemblyNext = Frame.Sequence + 1;
+            if (!Frame.bMore)
+            {
+                Decompress(ReassemblySlot, Reassembly.GetData(), Reassembly.Num());
+                Reassembly.Reset();
+            }
+        }
+    }
+}
+// - 3.5 - //
+void FSteamVoiceWorker::Decompress(int32 TalkerSlot, const uint8* Data, uint32 Size)
+{
+    uint32 Written = 0;
+    EVoiceResult Result = SteamUser()->DecompressVoice(Data, Size, Decoded.GetData(), Decoded.Num() * sizeof(int16), &Written, Mixer->GetSampleRate());
+    if (Result == k_EVoiceResultBufferTooSmall && Written > 0)
+    {
+        // Steam reports the size it needs in Written, grow once and decode again
+        Decoded.SetNumUninitialized(Written / sizeof(int16) + 1);
+        Result = SteamUser()->DecompressVoice(Data, Size, Decoded.GetData(), Decoded.Num() * sizeof(int16), &Written, Mixer->GetSampleRate());
+    }
+
+    if (Result == k_EVoiceResultOK)
+    {
+        Mixer->Push(TalkerSlot, Decoded.GetData(), (int32)(Written / sizeof(int16)));
+    }
+    else
+    {
+        DroppedFrames.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+/////////////////////////
+// 4. Voice Wave      //
+////////////////////////////////////
+// 4.1 - Attach the mixer        //
+// 4.2 - Render a block         //
+/////////////////////////////////
+// - 4.1 - //
+void USteamVoiceSoundWave::SetMixer(TSharedPtr<FSteamVoiceMixer, ESPMode::ThreadSafe> InMixer)
+{
+    Mixer = InMixer;
+    NumChannels = 1;
+    SetSampleRate(Mixer->GetSampleRate());
+    Duration = INDEFINITELY_LOOPING_DURATION;
+    SoundGroup = SOUNDGROUP_Voice;
+    bLooping = false;
+}
+// - 4.2 - //
+int32 USteamVoiceSoundWave::GeneratePCMData(uint8* PCMData, const int32 SamplesNeeded)
+{
+    if (!Mixer.IsValid())
+    {
+        return 0;
+    }
+    else
+    {
+        Mixer->Mix((int16*)PCMData, SamplesNeeded);
+        return SamplesNeeded * sizeof(int16);
+    }
+}
+/////////////////////////
+// 5. Lobby Voice     //
+//////////////////////////////////////////////
+// 5.1 - Subsystem teardown                //
+// 5.2 - Start voice for a lobby          //
+// 5.3 - Stop voice                      //
+// 5.4 - Push to talk                   //
+// 5.5 - Is a member talking           //
+// 5.6 - Tick: send and receive       //
+// 5.7 - Send the captured batch     //
+// 5.8 - Receive and queue decodes  //
+// 5.9 - Talker slot for a sender  //
+// 5.10 - Keep the wave playing   //
+// 5.11 - Callback: P2P session  //
+// 5.12 - Get the game instance //
+/////////////////////////////////
+// - 5.1 - //
+void USteamVoiceSubsystem::Deinitialize()
+{
+    StopLobbyVoice();
+    Super::Deinitialize();
+}
+// - 5.2 - //
+void USteamVoiceSubsystem::StartLobbyVoice(FSteamLobbyId InLobbyID)
+{
+    USteamMultiplayer* Multiplayer = GetMultiplayer();
+    ISteamBackend* Steam = Multiplayer ? Multiplayer->GetSteamBackend() : nullptr;
+    if (!Steam || !Steam->IsRunning() || Steam->IsFake() || !SteamUser() || !SteamNetworkingMessages())
+    {
+        return;
+    }
+    else if (LobbyID == InLobbyID)
+    {
+        return;
+    }
+
+    StopLobbyVoice();
+    LobbyID = InLobbyID;
+
+    // Mixer and its talker pool live as long as the subsystem, lobbies only borrow them
+    if (!Mixer.IsValid())
+    {
+        Mixer = MakeShared<FSteamVoiceMixer, ESPMode::ThreadSafe>(SteamUser()->GetVoiceOptimalSampleRate(), SteamVoice::JitterMs, SteamVoice::MaxBufferedMs);
+        VoiceWave = NewObject<USteamVoiceSoundWave>(this);
+        VoiceWave->SetMixer(Mixer);
+    }
+
+    Worker = MakeUnique<FSteamVoiceWorker>(Mixer.ToSharedRef());
+    WorkerThread = FRunnableThread::Create(Worker.Get(), TEXT("SteamVoice"), 0, TPri_AboveNormal);
+
+    if (Steam->UsesCallbackRouter())
+    {
+        RoutedBackend = Steam;
+        SessionRequestHandle = Steam->GetCallbackRouter().Bind<SteamNetworkingMessagesSessionRequest_t>([this](SteamNetworkingMessagesSessionRequest_t* pCallback)
+        {
+            OnSessionRequest(pCallback);
+        });
+    }
+
+    TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &USteamVoiceSubsystem::Tick));
+    EnsureVoiceComponent();
+    UE_LOG(LogSteamMultiplayer, Log, TEXT("Lobby voice started for %llu at %u Hz."), LobbyID.Value, Mixer->GetSampleRate());
+}
+// - 5.3 - //
+void USteamVoiceSubsystem::StopLobbyVoice()
+{
+    if (!LobbyID.IsValid())
+    {
+        return;
+    }
+
+    SetTransmitting(false);
+    FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+    TickHandle.Reset();
+
+    if (RoutedBackend)
+    {
+        RoutedBackend->GetCallbackRouter().Unbind(SessionRequestHandle);
+        RoutedBackend = nullptr;
+    }
+
+    // Joins the thread, the wave keeps draining whatever PCM is already buffered
+    if (WorkerThread)
+    {
+        WorkerThread->Kill(true);
+        delete WorkerThread;
+        WorkerThread = nullptr;
+    }
+    Worker.Reset();
+
+    if (VoiceComponent)
+    {
+        VoiceComponent->Stop();
+        VoiceComponent = nullptr;
+    }
+
+    for (FTalkerState& Talker : Talkers)
+    {
+        Talker = FTalkerState();
+    }
+    TalkerSlots.Reset();
+    LobbyID = FSteamLobbyId();
+}
+// - 5.4 - //
+void USteamVoiceSubsystem::SetTransmitting(bool bTransmit)
+{
+    if (bTransmit == bTransmitting || (bTransmit && !LobbyID.IsValid()))
+    {
+        return;
+    }
+    else if (bTransmit)
+    {
+        SteamUser()->StartVoiceRecording();
+        bTransmitting = true;
+    }
+    else
+    {
+        // Steam keeps handing out the tail of the sentence for a moment, the worker still sends it
+        SteamUser()->StopVoiceRecording();
+        bTransmitting = false;
+    }
+}
+// - 5.5 - //
+bool USteamVoiceSubsystem::IsMemberTalking(const FSteamLobbyMember& Member) const
+{
+    const int32* Slot = TalkerSlots.Find(Member.SteamID);
+    return Slot && FPlatformTime::Seconds() - Talkers[*Slot].LastHeardTime < SteamVoice::TalkingSeconds;
+}
+// - 5.6 - //
+bool USteamVoiceSubsystem::Tick(float DeltaTime)
+{
+    STEAM_MP_SCOPE(STAT_SteamVoiceTick);
+
+    SendCaptured();
+    ReceiveIncoming();
+    EnsureVoiceComponent();
+    SET_DWORD_STAT(STAT_SteamVoiceDroppedFrames, Worker->DroppedFrames.load(std::memory_order_relaxed));
+    return true;
+}
+// - 5.7 - //
+void USteamVoiceSubsystem::SendCaptured()
+{
+    // Everything captured since the last tick goes out as one message per member
+    OutgoingBatch.Reset();
+    OutgoingBatch.Add(SteamVoice::BatchVersion);
+    OutgoingBatch.Add(0);
+    while (OutgoingBatch[1] < MAX_uint8)
+    {
+        const FSteamVoiceFrame* Captured = Worker->Captured.Peek();
+        if (!Captured)
+        {
+            break;
+        }
+
+        const uint16 WireSize = Captured->Size | (Captured->bMore ? FSteamVoiceFrame::MoreFlag : 0);
+        const uint8 Header[4] = { (uint8)(Captured->Sequence & 0xFF), (uint8)(Captured->Sequence >> 8), (uint8)(WireSize & 0xFF), (uint8)(WireSize >> 8) };
+        OutgoingBatch.Append(Header, 4);
+        OutgoingBatch.Append(Captured->Data, Captured->Size);
+        ++OutgoingBatch[1];
+        Worker->Captured.Dequeue();
+    }
+
+    const FSteamLobbyRoster& Roster = GetMultiplayer()->GetLobbyRosterView();
+    if (OutgoingBatch[1] == 0 || !Roster.IsFor(LobbyID.ToSteamID()))
+    {
+        return;
+    }
+
+    const uint64 LocalSteamID = SteamUser()->GetSteamID().ConvertToUint64();
+    for (const FSteamLobbyMember& Member : Roster.GetMembers())
+    {
+        if (Member.SteamID != LocalSteamID)
+        {
+            SteamNetworkingIdentity Identity;
+            Identity.SetSteamID64(Member.SteamID);
+            SteamNetworkingMessages()->SendMessageToUser(Identity, OutgoingBatch.GetData(), OutgoingBatch.Num(), SteamVoice::SendFlags, SteamVoice::Channel);
+        }
+    }
+}
+// - 5.8 - //
+void USteamVoiceSubsystem::ReceiveIncoming()
+{
+    const FSteamLobbyRoster& Roster = GetMultiplayer()->GetLobbyRosterView();
+    const double Now = FPlatformTime::Seconds();
+    bool bQueued = false;
+
+    const int32 NumMessages = SteamNetworkingMessages()->ReceiveMessagesOnChannel(SteamVoice::Channel, IncomingMessages, UE_ARRAY_COUNT(IncomingMessages));
+    for (int32 m = 0; m < NumMessages; ++m)
+    {
+        // Read straight out of Steam's buffer, only frames for the decoder are copied
+        SteamNetworkingMessage_t* Message = IncomingMessages[m];
+        const uint64 Sender = Message->m_identityPeer.GetSteamID64();
+        const uint8* Data = (const uint8*)Message->m_pData;
+        const int32 Size = Message->m_cbSize;
+
+        const int32 Slot = Roster.IsFor(LobbyID.ToSteamID()) && Roster.FindMember(Sender) && Size >= 2 && Data[0] == SteamVoice::BatchVersion ? FindOrAssignTalker(Sender, Now) : INDEX_NONE;
+        int32 Offset = 2;
+        for (int32 f = 0; Slot != INDEX_NONE && f < Data[1] && Offset + 4 <= Size; ++f)
+        {
+            const uint16 Sequence = (uint16)(Data[Offset] | (Data[Offset + 1] << 8));
+            const uint16 WireSize = (uint16)(Data[Offset + 2] | (Data[Offset + 3] << 8));
+            const int32 FrameSize = WireSize & ~FSteamVoiceFrame::MoreFlag;
+            Offset += 4;
+            if (FrameSize > FSteamVoiceFrame::MaxBytes || Offset + FrameSize > Size)
+            {
+                break;
+            }
+
+            FTalkerState& Talker = Talkers[Slot];
+            if (!Talker.bHasSequence || SteamVoice::IsNewer(Sequence, Talker.LastSequence))
+            {
+                Talker.LastSequence = Sequence;
+                Talker.bHasSequence = true;
+                Talker.LastHeardTime = Now;
+
+                IncomingFrame.Sequence = Sequence;
+                IncomingFrame.Size = (uint16)FrameSize;
+                IncomingFrame.TalkerSlot = Slot;
+                IncomingFrame.bMore = (WireSize & FSteamVoiceFrame::MoreFlag) != 0;
+                FMemory::Memcpy(IncomingFrame.Data, Data + Offset, FrameSize);
+                if (Worker->Received.Enqueue(IncomingFrame))
+                {
+                    bQueued = true;
+                }
+                else
+                {
+                    Worker->DroppedFrames.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+            Offset += FrameSize;
+        }
+        Message->Release();
+    }
+
+    if (bQueued)
+    {
+        Worker->Wake();
+    }
+}
+// - 5.9 - //
+int32 USteamVoiceSubsystem::FindOrAssignTalker(uint64 SteamID, double Now)
+{
+    if (const int32* Slot = TalkerSlots.Find(SteamID))
+    {
+        return *Slot;
+    }
+
+    // Free slot first, otherwise whoever has been quiet the longest
+    int32 Best = INDEX_NONE;
+    for (int32 Slot = 0; Slot < FSteamVoiceMixer::MaxTalkers; ++Slot)
+    {
+        if (Talkers[Slot].SteamID == 0)
+        {
+            Best = Slot;
+            break;
+        }
+        else if (Now - Talkers[Slot].LastHeardTime > SteamVoice::SlotIdleSeconds && (Best == INDEX_NONE || Talkers[Slot].LastHeardTime < Talkers[Best].LastHeardTime))
+        {
+            Best = Slot;
+        }
+    }
+
+    if (Best == INDEX_NONE)
+    {
+        return INDEX_NONE;
+    }
+    else
+    {
+        TalkerSlots.Remove(Talkers[Best].SteamID);
+        Talkers[Best] = FTalkerState();
+        Talkers[Best].SteamID = SteamID;
+        TalkerSlots.Add(SteamID, Best);
+        Mixer->AcquireSlot(Best);
+        return Best;
+    }
+}
+// - 5.10 - //
+void USteamVoiceSubsystem::EnsureVoiceComponent()
+{
+    // One 2D component for every talker, it survives travel
+    if (VoiceComponent && VoiceComponent->IsPlaying())
+    {
+        return;
+    }
+    else if (UWorld* World = GetGameInstance()->GetWorld())
+    {
+        VoiceComponent = UGameplayStatics::SpawnSound2D(World, VoiceWave, 1.f, 1.f, 0.f, nullptr, true, false);
+    }
+}
+// - 5.11 - //
+void USteamVoiceSubsystem::OnSessionRequest(SteamNetworkingMessagesSessionRequest_t* pCallback)
+{
+    // Voice only from people in our lobby, anyone else stays unanswered
+    const USteamMultiplayer* Multiplayer = GetMultiplayer();
+    const uint64 Requester = pCallback->m_identityRemote.GetSteamID64();
+    if (LobbyID.IsValid() && Multiplayer && Multiplayer->GetLobbyRosterView().IsFor(LobbyID.ToSteamID()) && Multiplayer->GetLobbyRosterView().FindMember(Requester))
+    {
+        SteamNetworkingMessages()->AcceptSessionWithUser(pCallback->m_identityRemote);
+    }
+}
+// - 5.12 - //
+USteamMultiplayer* USteamVoiceSubsystem::GetMultiplayer() const
+{
+    return Cast<USteamMultiplayer>(GetGameInstance());
+}
+///////////////////////////////////////////
+// MORE COMING SOON  // A.S. - hajddeen //
+/////////////////////////////////////////
@@ -0,0 +1,289 @@
+// |------------------------------------|
+// |  !FOLLOW URBAN SHADOWS ON SOCIALS! |
+// |------------------------------------|
+//            \ (^ᴗ^) /
+//             \     /
+//              -----
+//              |   |
+//              |   |
+//              |_  |_ 
+////////////////////////////////////////////////////////////
+// STEAM P2P SESSIONS - Unreal 5.5 + Steamworks SDK 1.57 //
+//////////////////////////////////////////////////////////////////
+// LICENSE AGREEMENT // LICENSE AGREEMENT // LICENSE AGREEMENT //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                                                                                                                                                                                                                                          //
+// Last Updated: 03/12/2024                                                                                                                                                                                                                                //
+//                                                                                                                                                                                                                                                        //
+// 1. Grant of License                                                                                                                                                                                                                                   //
+// This license permits anyone to use, modify, and distribute the provided code (the "Code") in projects free of charge under the following conditions:                                                                                                 //
+// 1.1. The Code must only be used for lawful purposes.                                                                                                                                                                                                //
+// 1.2. The user must include proper credit in their project as described in Section 3 below.                                                                                                                                                         //
+//                                                                                                                                                                                                                                                   //
+// 2. Restrictions                                                                                                                                                                                                                                  //
+// 2.1. This Code cannot be sold, sublicensed, or redistributed as a standalone product or as part of a similar development toolkit.                                                                                                               //
+// 2.2. The Code must not be used for projects that violate local laws or promote harmful, discriminatory, or illegal activities.                                                                                                                 //
+// 2.3. The user must not remove, alter, or obscure this license agreement, attribution requirements, or copyright notices within the Code.                                                                                                      //
+//                                                                                                                                                                                                                                              //
+// 3. Attribution                                                                                                                                                                                                                              //
+// 3.1. The user must include the following credit in a visible location within their project (e.g., splash screen, credits screen, or documentation):                                                                                        //
+// "Steam Multiplayer Code developed by Adrian Szajewski. Used under license."                                                                                                                                                               //
+// 3.2. For distributed or published projects, a link to https://adrianszajewskidev.wordpress.com/ or other contact details must also be included if applicable.                                                                            //
+//                                                                                                                                                                                                                                         //
+// 4. Breach of Agreement                                                                                                                                                                                                                 //
+// 4.1. If this license is violated, the licensor reserves the right to revoke the user's rights to use the Code immediately.                                                                                                            //
+// 4.2. The licensor may take legal action to recover damages or enforce compliance, depending on the severity of the violation.                                                                                                        //
+// 4.3. Users found in breach of this license may be required to:                                                                                                                                                                      //
+// Remove the Code from their project(s).                                                                                                                                                                                             //
+// Cease distribution of any projects using the Code.                                                                                                                                                                                //
+//                                                                                                                                                                                                                                  //
+// 5. Disclaimer                                                                                                                                                                                                                   //
+// 5.1. The Code is provided "as is" without any warranty, express or implied. The licensor is not liable for any damages arising from the use or misuse of the Code.                                                             //
+// 5.2. It is the user's responsibility to ensure compatibility and safe usage of the Code in their projects.                                                                                                                    //
+//                                                                                                                                                                                                                              //
+// 6. Governing Law                                                                                                                                                                                                            //
+// This agreement shall be governed and construed in accordance with the laws of Poland. Any disputes arising under or in connection with this license will be subject to the exclusive jurisdiction of the courts of Poland. //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+/////////////////////////////////////////////////////////
+// INCLUDE //
+////////////
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Sound/SoundWaveProcedural.h"
+#include "Containers/CircularQueue.h"
+#include "Containers/Ticker.h"
+#include "HAL/Runnable.h"
+#include "steam/steam_api.h"
+#include "steam/isteamnetworkingmessages.h"
+#include "SteamMultiplayer.h"
+#include <atomic>
+#include "SteamVoice.generated.h"
+
+class UAudioComponent;
+
+/////////////////////////////////////////////////////////////////////////////////////
+// STEAM VOICE - NOTES                                                             //
+/////////////////////////////////////////////////////////////////////////////////////
+// 1. Worker thread: GetVoice (capture) and DecompressVoice (decode) only.        //
+// 2. Game thread: one batched message per member per tick over                  //
+//    ISteamNetworkingMessages, incoming frames are handed to the worker.       //
+// 3. Audio render thread: one procedural wave mixes every talker with         //
+//    buffered audio, a bigger lobby adds no audio voices.                    //
+// 4. Threads only meet in SPSC rings (TCircularQueue for compressed frames, //
+//    FSteamVoicePcmRing for PCM). Frames and PCM rings are fixed size and  //
+//    pooled, nothing is allocated per packet. Capture and decode scratch  //
+//    only grow when Steam reports a bigger buffer is needed.             //
+// 5. Needs the Steam client, it stays off with the fake backend.        //
+//////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////
+// COMPRESSED VOICE FRAME - FIXED SIZE        //
+////////////////////////////////////////////////
+struct FSteamVoiceFrame
+{
+    static constexpr int32 MaxBytes = 1024;     // Bigger GetVoice results go out as several fragments
+    static constexpr uint16 MoreFlag = 0x8000;  // Wire only, top bit of the size: another fragment follows
+
+    uint16 Size = 0;
+    uint16 Sequence = 0;
+    int32 TalkerSlot = INDEX_NONE; // Incoming frames only
+    bool bMore = false;            // Not the last fragment of one GetVoice result
+    uint8 Data[MaxBytes];
+};
+////////////////////////////////////////////////
+// SPSC PCM RING - ONE WRITER, ONE READER     //
+////////////////////////////////////////////////
+class URBANSHADOWS_API FSteamVoicePcmRing
+{
+public:
+    // Before the ring is shared, capacity is rounded up to a power of two
+    void Init(int32 MinCapacity);
+    bool IsInitialized() const { return Samples.Num() > 0; }
+
+    // Either side
+    int32 Num() const;
+
+    // Writer. Whatever does not fit is dropped, returns samples written
+    int32 Write(const int16* InSamples, int32 NumSamples);
+
+    // Reader. Adds up to NumSamples into Accumulator, returns samples consumed
+    int32 MixInto(int32* Accumulator, int32 NumSamples);
+    void Skip(int32 NumSamples);
+
+private:
+    TArray<int16> Samples;
+    uint32 Mask = 0;
+    std::atomic<uint32> Head{ 0 }; // Next write, only the writer moves it
+    std::atomic<uint32> Tail{ 0 }; // Next read, only the reader moves it
+};
+////////////////////////////////////////////////
+// TALKER POOL + MIXER - AUDIO THREAD SIDE    //
+////////////////////////////////////////////////
+class URBANSHADOWS_API FSteamVoiceMixer
+{
+public:
+    static constexpr int32 MaxTalkers = 64; // One bit each in ActiveTalkers
+
+    FSteamVoiceMixer(uint32 InSampleRate, float JitterMs, float MaxBufferedMs);
+
+    uint32 GetSampleRate() const { return SampleRate; }
+
+    // Game thread. Ring storage is allocated on the slot's first use and kept for the next talker
+    void AcquireSlot(int32 Slot);
+
+    // Worker thread
+    void Push(int32 Slot, const int16* InSamples, int32 NumSamples);
+
+    // Audio render thread. Always fills Out, silence when nobody talks
+    void Mix(int16* Out, int32 NumSamples);
+
+private:
+    struct FTalker
+    {
+        FSteamVoicePcmRing Ring;
+        std::atomic<bool> bReady{ false }; // Ring initialized, published by AcquireSlot
+        bool bPrimed = false;              // Audio thread only, jitter buffer filled at least once since it ran dry
+    };
+
+    uint32 SampleRate;
+    int32 JitterSamples;      // Buffered before a talker starts playing
+    int32 MaxBufferedSamples; // Above this a talker skips ahead instead of drifting behind
+    FTalker Talkers[MaxTalkers];
+    std::atomic<uint64> ActiveTalkers{ 0 }; // Slots with PCM waiting, so mixing cost follows who talks, not lobby size
+    TArray<int32> Accumulator;              // Audio thread only
+};
+///////////////////////////////////////////////
+// WORKER THREAD - CAPTURE + DECODE          //
+///////////////////////////////////////////////
+class FSteamVoiceWorker : public FRunnable
+{
+public:
+    FSteamVoiceWorker(TSharedRef<FSteamVoiceMixer, ESPMode::ThreadSafe> InMixer);
+    virtual ~FSteamVoiceWorker();
+
+    virtual uint32 Run() override;
+    virtual void Stop() override;
+
+    // Wakes the worker early, after the game thread queued frames to decode
+    void Wake();
+
+    TCircularQueue<FSteamVoiceFrame> Captured; // Worker -> game thread
+    TCircularQueue<FSteamVoiceFrame> Received; // Game thread -> worker
+    std::atomic<int32> DroppedFrames{ 0 };     // Either queue full
+
+private:
+    TSharedRef<FSteamVoiceMixer, ESPMode::ThreadSafe> Mixer;
+    FEvent* WakeEvent;
+    std::atomic<bool> bStopping{ false };
+    uint16 NextSequence = 0;
+    FSteamVoiceFrame Frame;                 // Scratch, one frame in flight at a time
+    TArray<uint8> CaptureScratch;           // One whole GetVoice result, grows to what Steam has
+    TArray<uint8> Reassembly;               // Fragments of one incoming GetVoice result
+    int32 ReassemblySlot = INDEX_NONE;
+    uint16 ReassemblyNext = 0;              // Sequence the next fragment must carry
+    TArray<int16> Decoded;                  // Scratch PCM, grows to what DecompressVoice asks for
+
+    void Capture();
+    void Decode();
+    void Decompress(int32 TalkerSlot, const uint8* Data, uint32 Size);
+};
+/////////////////////////////////////////////
+// PROCEDURAL WAVE THAT PULLS FROM MIXER   //
+/////////////////////////////////////////////
+UCLASS()
+class URBANSHADOWS_API USteamVoiceSoundWave : public USoundWaveProcedural
+{
+    GENERATED_BODY()
+
+public:
+    void SetMixer(TSharedPtr<FSteamVoiceMixer, ESPMode::ThreadSafe> InMixer);
+
+    // Mixes straight into the audio renderer's buffer instead of going through QueueAudio
+    virtual int32 GeneratePCMData(uint8* PCMData, const int32 SamplesNeeded) override;
+
+private:
+    TSharedPtr<FSteamVoiceMixer, ESPMode::ThreadSafe> Mixer;
+};
+////////////////
+// MAIN BODY //
+////////////////
+UCLASS()
+class URBANSHADOWS_API USteamVoiceSubsystem : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    //////////////////////////////////////////////
+    // 1. Subsystem Lifecycle                  //
+    ////////////////////////////////////////////
+    virtual void Deinitialize() override;
+
+    //////////////////////////////////////////////
+    // 2. Lobby Voice                          //
+    ////////////////////////////////////////////
+    // Called by USteamMultiplayer when a lobby is entered / left
+    void StartLobbyVoice(FSteamLobbyId LobbyID);
+    void StopLobbyVoice();
+
+    UFUNCTION(BlueprintPure, Category = "Steam|Voice")
+    bool IsLobbyVoiceActive() const { return LobbyID.IsValid(); }
+
+    // Push to talk, the microphone is only opened while transmitting
+    UFUNCTION(BlueprintCallable, Category = "Steam|Voice")
+    void SetTransmitting(bool bTransmit);
+
+    UFUNCTION(BlueprintPure, Category = "Steam|Voice")
+    bool IsTransmitting() const { return bTransmitting; }
+
+    UFUNCTION(BlueprintPure, Category = "Steam|Voice")
+    bool IsMemberTalking(const FSteamLobbyMember& Member) const;
+
+private:
+    //////////////////////////////////////////////
+    // 1. Private Data Members                 //
+    ////////////////////////////////////////////
+    struct FTalkerState // Game thread only
+    {
+        uint64 SteamID = 0;
+        uint16 LastSequence = 0;
+        bool bHasSequence = false;
+        double LastHeardTime = 0.0;
+    };
+
+    FSteamLobbyId LobbyID;
+    bool bTransmitting = false;
+
+    TSharedPtr<FSteamVoiceMixer, ESPMode::ThreadSafe> Mixer; // Created once, kept across lobbies
+    TUniquePtr<FSteamVoiceWorker> Worker;
+    FRunnableThread* WorkerThread = nullptr;
+    FTSTicker::FDelegateHandle TickHandle;
+
+    UPROPERTY()
+    TObjectPtr<USteamVoiceSoundWave> VoiceWave;
+
+    UPROPERTY()
+    TObjectPtr<UAudioComponent> VoiceComponent;
+
+    FTalkerState Talkers[FSteamVoiceMixer::MaxTalkers];
+    TMap<uint64, int32> TalkerSlots; // SteamID -> slot in Talkers and the mixer
+    TArray<uint8> OutgoingBatch;     // Reused every tick
+    SteamNetworkingMessage_t* IncomingMessages[64];
+    FSteamVoiceFrame IncomingFrame;  // Scratch for the Received queue
+
+    // Manual dispatch: STEAM_CALLBACK never fires, session requests come through the backend router
+    ISteamBackend* RoutedBackend = nullptr;
+    FSteamCallbackRouter::FHandle SessionRequestHandle = 0;
+
+    USteamMultiplayer* GetMultiplayer() const;
+    bool Tick(float DeltaTime);
+    void SendCaptured();
+    void ReceiveIncoming();
+    int32 FindOrAssignTalker(uint64 SteamID, double Now);
+    void EnsureVoiceComponent();
+
+    STEAM_CALLBACK(USteamVoiceSubsystem, OnSessionRequest, SteamNetworkingMessagesSessionRequest_t);
+};
+///////////////////////////////////////////
+// MORE COMING SOON  // A.S. - hajddeen //
+/////////////////////////////////////////